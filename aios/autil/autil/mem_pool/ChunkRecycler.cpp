@@ -0,0 +1,156 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "autil/mem_pool/ChunkRecycler.h"
+
+#include <algorithm>
+#include <new>
+#include <string>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace autil {
+namespace mem_pool {
+
+AUTIL_LOG_SETUP(autil, ChunkRecycler);
+
+ChunkRecycler::ChunkRecycler()
+    : _nodeCount(detectNodeCount()), _maxIdleBytes(0), _retainedBytes(0), _hitCount(0), _missCount(0) {}
+
+ChunkRecycler::~ChunkRecycler() {
+    for (auto &cache : _nodeCaches) {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        freeChunks(cache, cache.idleBytes);
+    }
+}
+
+ChunkRecycler *ChunkRecycler::getInstance() {
+    // never destructed, pools may return chunks during static destruction
+    static ChunkRecycler *instance = new ChunkRecycler();
+    return instance;
+}
+
+size_t ChunkRecycler::getClassSize(size_t numBytes) {
+    size_t granularity = MIN_CLASS_GRANULARITY;
+    while (granularity * 8 < numBytes) {
+        granularity <<= 1;
+    }
+    return (numBytes + granularity - 1) / granularity * granularity;
+}
+
+size_t ChunkRecycler::detectNodeCount() {
+    size_t nodeCount = 0;
+    while (nodeCount < MAX_NUMA_NODE_COUNT) {
+        std::string nodePath = "/sys/devices/system/node/node" + std::to_string(nodeCount);
+        if (access(nodePath.c_str(), F_OK) != 0) {
+            break;
+        }
+        ++nodeCount;
+    }
+    return std::max(nodeCount, (size_t)1);
+}
+
+size_t ChunkRecycler::currentNode() const {
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+        return 0;
+    }
+    return node % _nodeCount;
+}
+
+void *ChunkRecycler::allocate(size_t numBytes) {
+    size_t classSize = getClassSize(numBytes);
+    if (getMaxIdleBytes() > 0) {
+        auto &cache = _nodeCaches[currentNode()];
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        auto iter = cache.freeChunks.find(classSize);
+        if (iter != cache.freeChunks.end() && !iter->second.empty()) {
+            void *addr = iter->second.back();
+            iter->second.pop_back();
+            cache.idleBytes -= classSize;
+            cache.idleLowWatermark = std::min(cache.idleLowWatermark, cache.idleBytes);
+            _retainedBytes.fetch_sub(classSize, std::memory_order_relaxed);
+            _hitCount.fetch_add(1, std::memory_order_relaxed);
+            return addr;
+        }
+    }
+    _missCount.fetch_add(1, std::memory_order_relaxed);
+    return static_cast<void *>(new (std::nothrow) char[classSize]);
+}
+
+void ChunkRecycler::deallocate(void *addr, size_t numBytes) {
+    size_t classSize = getClassSize(numBytes);
+    size_t maxNodeIdleBytes = getMaxNodeIdleBytes();
+    if (maxNodeIdleBytes > 0) {
+        // kept on the node of the releasing thread, which usually is the one that touched it
+        auto &cache = _nodeCaches[currentNode()];
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        if (cache.idleBytes + classSize <= maxNodeIdleBytes) {
+            cache.freeChunks[classSize].push_back(addr);
+            cache.idleBytes += classSize;
+            _retainedBytes.fetch_add(classSize, std::memory_order_relaxed);
+            return;
+        }
+    }
+    delete[](char *) addr;
+}
+
+void ChunkRecycler::setMaxIdleBytes(size_t maxIdleBytes) {
+    _maxIdleBytes.store(maxIdleBytes, std::memory_order_relaxed);
+    size_t maxNodeIdleBytes = getMaxNodeIdleBytes();
+    for (auto &cache : _nodeCaches) {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        if (cache.idleBytes > maxNodeIdleBytes) {
+            freeChunks(cache, cache.idleBytes - maxNodeIdleBytes);
+        }
+    }
+}
+
+size_t ChunkRecycler::trim() {
+    size_t freedBytes = 0;
+    for (auto &cache : _nodeCaches) {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        freedBytes += freeChunks(cache, cache.idleLowWatermark);
+        cache.idleLowWatermark = cache.idleBytes;
+    }
+    if (freedBytes > 0) {
+        AUTIL_LOG(INFO,
+                  "trim [%lu] idle chunk bytes, retained idle bytes [%lu]",
+                  freedBytes,
+                  _retainedBytes.load(std::memory_order_relaxed));
+    }
+    return freedBytes;
+}
+
+size_t ChunkRecycler::freeChunks(NodeCache &cache, size_t bytesToFree) {
+    size_t freedBytes = 0;
+    // free large classes first, they are the most expensive to keep
+    for (auto iter = cache.freeChunks.rbegin(); iter != cache.freeChunks.rend() && freedBytes < bytesToFree; ++iter) {
+        auto &chunks = iter->second;
+        while (!chunks.empty() && freedBytes < bytesToFree) {
+            delete[](char *) chunks.back();
+            chunks.pop_back();
+            freedBytes += iter->first;
+        }
+    }
+    cache.idleBytes -= freedBytes;
+    cache.idleLowWatermark = std::min(cache.idleLowWatermark, cache.idleBytes);
+    _retainedBytes.fetch_sub(freedBytes, std::memory_order_relaxed);
+    return freedBytes;
+}
+
+} // namespace mem_pool
+} // namespace autil
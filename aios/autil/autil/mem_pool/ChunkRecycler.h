@@ -0,0 +1,111 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "autil/Log.h"
+#include "autil/mem_pool/ChunkAllocatorBase.h"
+
+namespace autil {
+namespace mem_pool {
+
+/**
+ * Process-wide cache of idle pool chunks, so that pools created per query
+ * reuse chunk memory instead of returning it to the system allocator.
+ * Chunks are kept in size classes (at most 1/8 rounding waste) per NUMA
+ * node, bounded by maxIdleBytes split evenly over the nodes present on the
+ * machine. trim() should be called periodically, it
+ * frees idle chunks that were not needed since the last trim.
+ */
+class ChunkRecycler {
+public:
+    static const size_t MIN_CLASS_GRANULARITY = 64 * 1024;
+    static const size_t MAX_NUMA_NODE_COUNT = 8;
+
+public:
+    ChunkRecycler();
+    ~ChunkRecycler();
+
+private:
+    ChunkRecycler(const ChunkRecycler &);
+    void operator=(const ChunkRecycler &);
+
+public:
+    static ChunkRecycler *getInstance();
+
+    void *allocate(size_t numBytes);
+    void deallocate(void *addr, size_t numBytes);
+
+    // 0 disables recycling, idle chunks beyond the budget are freed
+    void setMaxIdleBytes(size_t maxIdleBytes);
+    size_t getMaxIdleBytes() const { return _maxIdleBytes.load(std::memory_order_relaxed); }
+    // free idle chunks not reused since last trim, return freed bytes
+    size_t trim();
+
+    // idle chunk bytes held by the recycler
+    size_t getRetainedBytes() const { return _retainedBytes.load(std::memory_order_relaxed); }
+    uint64_t getHitCount() const { return _hitCount.load(std::memory_order_relaxed); }
+    uint64_t getMissCount() const { return _missCount.load(std::memory_order_relaxed); }
+
+    static size_t getClassSize(size_t numBytes);
+
+private:
+    struct NodeCache {
+        std::mutex mutex;
+        std::map<size_t, std::vector<void *>> freeChunks;
+        size_t idleBytes = 0;
+        // lowest idleBytes since last trim, idle memory nobody asked for
+        size_t idleLowWatermark = 0;
+    };
+
+    static size_t detectNodeCount();
+    size_t currentNode() const;
+    size_t getMaxNodeIdleBytes() const { return getMaxIdleBytes() / _nodeCount; }
+    size_t freeChunks(NodeCache &cache, size_t bytesToFree);
+
+private:
+    NodeCache _nodeCaches[MAX_NUMA_NODE_COUNT];
+    const size_t _nodeCount;
+    std::atomic<size_t> _maxIdleBytes;
+    std::atomic<size_t> _retainedBytes;
+    std::atomic<uint64_t> _hitCount;
+    std::atomic<uint64_t> _missCount;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+class RecycleChunkAllocator : public ChunkAllocatorBase {
+public:
+    RecycleChunkAllocator(ChunkRecycler *recycler = ChunkRecycler::getInstance()) : _recycler(recycler) {}
+    ~RecycleChunkAllocator() {}
+
+public:
+    void *doAllocate(size_t numBytes) override { return _recycler->allocate(numBytes); }
+    void doDeallocate(void *const addr, size_t numBytes) override { _recycler->deallocate(addr, numBytes); }
+
+private:
+    ChunkRecycler *_recycler;
+};
+
+} // namespace mem_pool
+} // namespace autil
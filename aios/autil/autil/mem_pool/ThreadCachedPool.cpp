@@ -0,0 +1,128 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "autil/mem_pool/ThreadCachedPool.h"
+
+#include <algorithm>
+
+namespace autil {
+namespace mem_pool {
+
+AUTIL_LOG_SETUP(autil, ThreadCachedPool);
+
+namespace {
+std::atomic<uint64_t> globalThreadToken(0);
+}
+
+ThreadCachedPool::ThreadCachedPool(AllocatePolicy *allocatePolicy, size_t alignSize)
+    : Pool(allocatePolicy, alignSize) {}
+
+ThreadCachedPool::ThreadCachedPool(ChunkAllocatorBase *allocator, size_t chunkSize, size_t alignSize)
+    : Pool(allocator, chunkSize, alignSize) {}
+
+ThreadCachedPool::ThreadCachedPool(size_t chunkSize, size_t alignSize) : Pool(chunkSize, alignSize) {}
+
+ThreadCachedPool::~ThreadCachedPool() {}
+
+void *ThreadCachedPool::allocate(size_t numBytes) {
+    size_t allocSize = alignBytes(numBytes, _alignSize);
+    if (allocSize > MAX_SLAB_ALLOCATE_SIZE) {
+        return Pool::allocate(numBytes);
+    }
+    void *ptr = allocateFromSlab(allocSize, _alignSize);
+    return ptr ? ptr : Pool::allocate(numBytes);
+}
+
+void *ThreadCachedPool::allocate(size_t numBytes, size_t alignment) {
+    size_t allocSize = alignBytes(numBytes, _alignSize);
+    if (allocSize + alignment > MAX_SLAB_ALLOCATE_SIZE) {
+        return Pool::allocate(numBytes, alignment);
+    }
+    void *ptr = allocateFromSlab(allocSize, alignment);
+    return ptr ? ptr : Pool::allocate(numBytes, alignment);
+}
+
+void ThreadCachedPool::release() {
+    ScopedSpinLock lock(_mutex);
+    releaseSlabCaches();
+    _allocPolicy->release();
+    _allocSize = 0;
+    _memChunk = &(Pool::DUMMY_CHUNK);
+}
+
+size_t ThreadCachedPool::reset() {
+    ScopedSpinLock lock(_mutex);
+    releaseSlabCaches();
+    return resetUnsafe();
+}
+
+ThreadCachedPool::SlabCache *ThreadCachedPool::getSlabCache() {
+    static thread_local uint64_t threadToken = globalThreadToken.fetch_add(1, std::memory_order_relaxed) + 1;
+    // probe from the thread's home cache, usually the first one checked is ours or free
+    for (size_t i = 0; i < SLAB_CACHE_COUNT; ++i) {
+        SlabCache &cache = _slabCaches[(threadToken + i) % SLAB_CACHE_COUNT];
+        uint64_t owner = cache.owner.load(std::memory_order_acquire);
+        if (owner == threadToken) {
+            return &cache;
+        }
+        if (owner == 0 && cache.owner.compare_exchange_strong(owner, threadToken, std::memory_order_acq_rel)) {
+            cache.cur = cache.end = nullptr;
+            return &cache;
+        }
+    }
+    return nullptr;
+}
+
+void ThreadCachedPool::releaseSlabCaches() {
+    // reset/release must not run concurrently with allocations, as for Pool
+    for (auto &cache : _slabCaches) {
+        cache.cur = cache.end = nullptr;
+        cache.owner.store(0, std::memory_order_release);
+    }
+}
+
+void *ThreadCachedPool::allocateFromSlab(size_t allocSize, size_t alignment) {
+    SlabCache *cachePtr = getSlabCache();
+    if (!cachePtr) {
+        return NULL;
+    }
+    SlabCache &cache = *cachePtr;
+    char *ptr = (char *)alignBytes((size_t)cache.cur, alignment);
+    if (cache.cur == nullptr || ptr + allocSize > cache.end) {
+        if (!refillSlab(cache, allocSize + alignment)) {
+            return NULL;
+        }
+        ptr = (char *)alignBytes((size_t)cache.cur, alignment);
+    }
+    cache.cur = ptr + allocSize;
+    SanitizerUtil::UnpoisonMemoryRegion(ptr, allocSize);
+    return ptr;
+}
+
+bool ThreadCachedPool::refillSlab(SlabCache &cache, size_t minSize) {
+    size_t slabSize = std::max(SLAB_SIZE, minSize);
+    ScopedSpinLock lock(_mutex);
+    char *slab = (char *)allocateUnsafe(slabSize);
+    if (!slab) {
+        return false;
+    }
+    SanitizerUtil::PoisonMemoryRegion(slab, slabSize);
+    cache.cur = slab;
+    cache.end = slab + slabSize;
+    return true;
+}
+
+} // namespace mem_pool
+} // namespace autil
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+
+#include "autil/Log.h"
+#include "autil/mem_pool/Pool.h"
+
+namespace autil {
+namespace mem_pool {
+
+/**
+ * Pool shared by many threads: on first allocation a thread claims one of
+ * SLAB_CACHE_COUNT slab caches of this pool and then bump-allocates from it
+ * without any lock, the pool lock is only taken to carve a new slab. threads
+ * finding every cache claimed by others fall back to the locked Pool path.
+ * reset/release free all caches and keep Pool semantics, used bytes include
+ * the unused tail of cache slabs (at most SLAB_SIZE per cache).
+ */
+class ThreadCachedPool : public Pool {
+public:
+    static const size_t SLAB_SIZE = 16 * 1024;
+    // larger allocations bypass thread slabs
+    static const size_t MAX_SLAB_ALLOCATE_SIZE = SLAB_SIZE / 4;
+
+public:
+    ThreadCachedPool(AllocatePolicy *allocatePolicy, size_t alignSize = DEFAULT_ALIGN_SIZE);
+    ThreadCachedPool(ChunkAllocatorBase *allocator, size_t chunkSize, size_t alignSize = DEFAULT_ALIGN_SIZE);
+    ThreadCachedPool(size_t chunkSize = DEFAULT_CHUNK_SIZE, size_t alignSize = DEFAULT_ALIGN_SIZE);
+    ~ThreadCachedPool();
+
+private:
+    ThreadCachedPool(const ThreadCachedPool &);
+    void operator=(const ThreadCachedPool &);
+
+public:
+    void *allocate(size_t numBytes) override;
+    void *allocate(size_t numBytes, size_t alignment) override;
+    void release() override;
+    size_t reset() override;
+
+private:
+    struct alignas(64) SlabCache {
+        // token of the thread using this cache, 0 if free
+        std::atomic<uint64_t> owner{0};
+        char *cur = nullptr;
+        char *end = nullptr;
+    };
+    static const size_t SLAB_CACHE_COUNT = 32;
+
+    SlabCache *getSlabCache();
+    void releaseSlabCaches();
+    void *allocateFromSlab(size_t allocSize, size_t alignment);
+    bool refillSlab(SlabCache &cache, size_t minSize);
+
+private:
+    SlabCache _slabCaches[SLAB_CACHE_COUNT];
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+} // namespace mem_pool
+} // namespace autil
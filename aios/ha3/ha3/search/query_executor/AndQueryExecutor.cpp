@@ -21,7 +21,9 @@
 #include <limits>
 
 #include "autil/CommonMacros.h"
+#include "autil/EnvUtil.h"
 #include "autil/Log.h"
+#include "autil/StringUtil.h"
 #include "ha3/isearch.h"
 #include "ha3/search/ExecutorVisitor.h"
 #include "ha3/search/MultiQueryExecutor.h"
@@ -32,8 +34,18 @@ namespace isearch {
 namespace search {
 AUTIL_LOG_SETUP(ha3, AndQueryExecutor);
 
+bool AndQueryExecutor::isAdaptiveReorderEnabled() {
+    static const bool disableAndQueryReorder
+        = autil::EnvUtil::getEnv("disableAndQueryReorder", false);
+    return !disableAndQueryReorder;
+}
+
 AndQueryExecutor::AndQueryExecutor()
-    : _testDocCount(0) {
+    : _testDocCount(0)
+    , _adaptiveReorder(isAdaptiveReorderEnabled())
+    , _probeCount(0)
+    , _reorderCount(0)
+    , _postFilterCount(0) {
     _firstExecutor = NULL;
 }
 
@@ -59,7 +71,15 @@ void AndQueryExecutor::addQueryExecutors(const vector<QueryExecutor *> &queryExe
     _queryExecutors = queryExecutors;
     //_sortedQueryExecutors = queryExecutors;
     QueryExecutorVector tmpQueryExecutors = queryExecutors;
+    // the sparsest child generates the candidates, the others only test them, so they are
+    // ordered by how much a test costs weighted by how likely it passes
     sort(tmpQueryExecutors.begin(), tmpQueryExecutors.end(), DFCompare());
+    stable_sort(tmpQueryExecutors.begin() + 1,
+                tmpQueryExecutors.end(),
+                [](QueryExecutor *lft, QueryExecutor *rht) {
+                    return lft->getCurrentDF() * getSeekCostFactor(lft)
+                           < rht->getCurrentDF() * getSeekCostFactor(rht);
+                });
     _sortedQueryExecutors.push_back(tmpQueryExecutors[0]);
     for (size_t i = 1; i < tmpQueryExecutors.size(); i++) {
         auto filter = tmpQueryExecutors[i]->stealFilter();
@@ -70,17 +90,52 @@ void AndQueryExecutor::addQueryExecutors(const vector<QueryExecutor *> &queryExe
         }
     }
     _firstExecutor = &_sortedQueryExecutors[0];
+    _feedbacks.assign(_sortedQueryExecutors.size(), ChildFeedback());
+}
+
+double AndQueryExecutor::getSeekCostFactor(const QueryExecutor *executor) {
+    const string name = executor->getName();
+    if (name == "RangeQueryExecutor") {
+        // docid range check, nothing to decode
+        return 0.25;
+    } else if (name == "BitmapTermQueryExecutor" || name == "DocIdsQueryExecutor") {
+        return 0.5;
+    } else if (name == "NumberQueryExecutor" || name == "RangeTermQueryExecutor"
+               || name == "SpatialTermQueryExecutor") {
+        // merges the postings of many terms
+        return 2.0;
+    }
+    auto multiExecutor = dynamic_cast<const MultiQueryExecutor *>(executor);
+    if (multiExecutor) {
+        return max((size_t)1, multiExecutor->getQueryExecutors().size());
+    }
+    return 1.0;
 }
 
 indexlib::index::ErrorCode AndQueryExecutor::doSeek(docid_t id, docid_t &result) {
+    if (unlikely(_probeCount >= ADJUST_PROBE_INTERVAL)) {
+        adjustExecutorOrder();
+    }
     QueryExecutor **firstExecutor = _firstExecutor;
     QueryExecutor **currentExecutor = firstExecutor;
     QueryExecutor **endExecutor = firstExecutor + _sortedQueryExecutors.size();
+    ChildFeedback *feedbacks = _feedbacks.data();
     docid_t current = id;
+    // id and id + 1 after a failed filter test are not candidates of any child, seeking them
+    // says nothing about how selective the child is
+    bool isCandidate = false;
     do {
         docid_t tmpid = INVALID_DOCID;
         auto ec = (*currentExecutor)->seek(current, tmpid);
         IE_RETURN_CODE_IF_ERROR(ec);
+        if (isCandidate) {
+            ChildFeedback &feedback = feedbacks[currentExecutor - firstExecutor];
+            ++feedback.probeCount;
+            feedback.rejectCount += tmpid != current;
+            ++_probeCount;
+        }
+        // without runtime reorder nothing is counted and the order is never adjusted
+        isCandidate = _adaptiveReorder;
         if (tmpid == END_DOCID) {
             current = tmpid;
             break;
@@ -96,6 +151,7 @@ indexlib::index::ErrorCode AndQueryExecutor::doSeek(docid_t id, docid_t &result)
                 } else {
                     current++;
                     currentExecutor = firstExecutor;
+                    isCandidate = false;
                 }
             }
         }
@@ -107,6 +163,95 @@ indexlib::index::ErrorCode AndQueryExecutor::doSeek(docid_t id, docid_t &result)
     return indexlib::index::ErrorCode::OK;
 }
 
+void AndQueryExecutor::adjustExecutorOrder() {
+    _probeCount = 0;
+    size_t count = _sortedQueryExecutors.size();
+    if (count < 2) {
+        return;
+    }
+    // a child is worth testing early when it is cheap and rejects often, children without
+    // enough probes keep their place behind the measured ones, dense children only confirm
+    // what the others found and are tested last as post filters
+    vector<double> ranks(count, numeric_limits<double>::max());
+    vector<bool> denses(count, false);
+    size_t denseCount = 0;
+    for (size_t i = 0; i < count; ++i) {
+        ChildFeedback &feedback = _feedbacks[i];
+        uint32_t seekDocCount = _sortedQueryExecutors[i]->getSeekDocCount();
+        if (feedback.probeCount >= MIN_CHILD_PROBE_COUNT) {
+            double cost
+                = max(0.01, (seekDocCount - feedback.seekDocCount) / (double)feedback.probeCount);
+            double rejectRatio = feedback.rejectCount / (double)feedback.probeCount;
+            ranks[i] = cost / max(0.01, rejectRatio);
+            if (1.0 - rejectRatio >= DENSE_PASS_RATIO) {
+                denses[i] = true;
+                ++denseCount;
+            }
+        }
+        // halve the history so that the order follows the docid region being scanned
+        feedback.probeCount /= 2;
+        feedback.rejectCount /= 2;
+        feedback.seekDocCount = seekDocCount;
+    }
+    if (denseCount == count) {
+        // someone has to generate candidates
+        denses.assign(count, false);
+        denseCount = 0;
+    }
+    vector<size_t> order(count);
+    for (size_t i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    stable_sort(order.begin(), order.end(), [&](size_t lft, size_t rht) {
+        if (denses[lft] != denses[rht]) {
+            return denses[rht];
+        }
+        return ranks[lft] < ranks[rht];
+    });
+    bool changed = denseCount != _postFilterCount;
+    for (size_t i = 0; i < count; ++i) {
+        changed = changed || order[i] != i;
+    }
+    if (!changed) {
+        return;
+    }
+    QueryExecutorVector sortedQueryExecutors(count);
+    vector<ChildFeedback> feedbacks(count);
+    for (size_t i = 0; i < count; ++i) {
+        sortedQueryExecutors[i] = _sortedQueryExecutors[order[i]];
+        feedbacks[i] = _feedbacks[order[i]];
+    }
+    // same size, _firstExecutor stays valid
+    copy(sortedQueryExecutors.begin(), sortedQueryExecutors.end(), _sortedQueryExecutors.begin());
+    _feedbacks.swap(feedbacks);
+    _postFilterCount = denseCount;
+    ++_reorderCount;
+    if (_reorderTraces.size() < MAX_REORDER_TRACE_COUNT) {
+        string trace = "reorder at docid[" + autil::StringUtil::toString(getDocId()) + "]:";
+        for (size_t i = 0; i < count; ++i) {
+            size_t idx = order[i];
+            trace += " " + _sortedQueryExecutors[i]->toString();
+            if (denses[idx]) {
+                trace += "(post filter)";
+            } else if (ranks[idx] != numeric_limits<double>::max()) {
+                trace += "(rank " + autil::StringUtil::toString(ranks[idx]) + ")";
+            }
+        }
+        _reorderTraces.push_back(trace);
+    }
+}
+
+void AndQueryExecutor::collectReorderTraces(vector<string> &traces) const {
+    for (const auto &trace : _reorderTraces) {
+        traces.push_back(getName() + " " + trace);
+    }
+    if (_reorderCount > _reorderTraces.size()) {
+        traces.push_back(getName() + " reorder count["
+                         + autil::StringUtil::toString(_reorderCount) + "]");
+    }
+    MultiQueryExecutor::collectReorderTraces(traces);
+}
+
 indexlib::index::ErrorCode AndQueryExecutor::seekSubDoc(
     docid_t docId, docid_t subDocId, docid_t subDocEnd, bool needSubMatchdata, docid_t &result) {
     if (!_hasSubDocExecutor) {
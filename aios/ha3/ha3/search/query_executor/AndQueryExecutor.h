@@ -54,9 +54,37 @@ public:
     uint32_t getSeekDocCount() override {
         return MultiQueryExecutor::getSeekDocCount() + _testDocCount;
     }
+    void collectReorderTraces(std::vector<std::string> &traces) const override;
+
+public:
+    // seek cost of executor relative to a plain posting list seek, orders the children before
+    // any runtime feedback is available
+    static double getSeekCostFactor(const QueryExecutor *executor);
+    // runtime reorder by seek feedback, on unless env disableAndQueryReorder is set
+    static bool isAdaptiveReorderEnabled();
+    void setAdaptiveReorder(bool adaptiveReorder) {
+        _adaptiveReorder = adaptiveReorder;
+    }
+    uint32_t getReorderCount() const {
+        return _reorderCount;
+    }
+    size_t getPostFilterCount() const {
+        return _postFilterCount;
+    }
+    const QueryExecutorVector &getSortedQueryExecutors() const {
+        return _sortedQueryExecutors;
+    }
+
+private:
+    struct ChildFeedback {
+        uint32_t probeCount = 0;   // seeks that tested a candidate found by another child
+        uint32_t rejectCount = 0;  // probes that moved past the candidate
+        uint32_t seekDocCount = 0; // child seek doc count at the last adjustment
+    };
 
 private:
     bool testCurrentDoc(docid_t docid);
+    void adjustExecutorOrder();
 
 protected:
     QueryExecutorVector _sortedQueryExecutors;
@@ -64,6 +92,21 @@ protected:
     QueryExecutor **_firstExecutor;
     int64_t _testDocCount;
 
+private:
+    // parallel to _sortedQueryExecutors
+    std::vector<ChildFeedback> _feedbacks;
+    bool _adaptiveReorder;
+    uint32_t _probeCount;
+    uint32_t _reorderCount;
+    size_t _postFilterCount;
+    std::vector<std::string> _reorderTraces;
+
+private:
+    static constexpr uint32_t ADJUST_PROBE_INTERVAL = 4096;
+    static constexpr uint32_t MIN_CHILD_PROBE_COUNT = 64;
+    static constexpr double DENSE_PASS_RATIO = 0.95;
+    static constexpr size_t MAX_REORDER_TRACE_COUNT = 16;
+
 private:
     AUTIL_LOG_DECLARE();
 };
@@ -462,6 +462,21 @@ bool IndexPartitionReaderWrapper::getSortedDocIdRanges(
     return false;
 }
 
+bool IndexPartitionReaderWrapper::getZoneMapDocIdRanges(
+    const std::vector<std::shared_ptr<indexlib::table::DimensionDescription>> &dimensions,
+    const indexlib::DocIdRange &rangeLimits,
+    indexlib::DocIdRangeVector &resultRanges) const {
+    if (_tabletReader) {
+        auto normalTabletReader
+            = std::dynamic_pointer_cast<indexlibv2::table::NormalTabletSessionReader>(
+                _tabletReader);
+        if (normalTabletReader) {
+            return normalTabletReader->GetZoneMapDocIdRanges(dimensions, rangeLimits, resultRanges);
+        }
+    }
+    return false;
+}
+
 bool IndexPartitionReaderWrapper::getIndexReader(const string &indexName,
                                                  std::shared_ptr<InvertedIndexReader> &indexReader,
                                                  bool &isSubIndex) {
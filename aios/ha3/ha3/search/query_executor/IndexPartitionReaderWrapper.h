@@ -182,6 +182,11 @@ public:
         const std::vector<std::shared_ptr<indexlib::table::DimensionDescription>> &dimensions,
         const indexlib::DocIdRange &rangeLimits,
         indexlib::DocIdRangeVector &resultRanges) const;
+    // attribute zone maps only exist in tablet segments
+    virtual bool getZoneMapDocIdRanges(
+        const std::vector<std::shared_ptr<indexlib::table::DimensionDescription>> &dimensions,
+        const indexlib::DocIdRange &rangeLimits,
+        indexlib::DocIdRangeVector &resultRanges) const;
 
 public:
     void setTopK(uint32_t topK) {
@@ -82,6 +82,12 @@ uint32_t MultiQueryExecutor::getSeekDocCount() {
     return ret;
 }
 
+void MultiQueryExecutor::collectReorderTraces(std::vector<std::string> &traces) const {
+    for (auto it = _queryExecutors.begin(); it != _queryExecutors.end(); it++) {
+        (*it)->collectReorderTraces(traces);
+    }
+}
+
 void MultiQueryExecutor::reset() {
     QueryExecutor::reset();
     for (QueryExecutorVector::const_iterator it = _queryExecutors.begin();
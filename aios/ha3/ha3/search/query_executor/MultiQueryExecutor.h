@@ -43,6 +43,7 @@ public:
     void setEmpty() override;
     void setCurrSub(docid_t docid) override;
     uint32_t getSeekDocCount() override;
+    void collectReorderTraces(std::vector<std::string> &traces) const override;
     virtual void addQueryExecutors(const std::vector<QueryExecutor *> &queryExecutors) = 0;
 
     inline QueryExecutor *getQueryExecutor(int idx) {
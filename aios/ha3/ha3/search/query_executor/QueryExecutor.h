@@ -143,6 +143,8 @@ public:
     virtual uint32_t getSeekDocCount() {
         return _seekDocCount;
     }
+    // appends the child reorder decisions made while seeking, for the search trace
+    virtual void collectReorderTraces(std::vector<std::string> &traces) const {}
 
 public:
     // only for test
@@ -29,6 +29,20 @@ void MinMaxCalculator::Add(double value) {
     count_++;
 }
 
+void MinMaxCalculator::Merge(double min, double max, double sum, int count) {
+    if (count <= 0) {
+        return;
+    }
+    if (max > max_) {
+        max_ = max;
+    }
+    if (min < min_) {
+        min_ = min;
+    }
+    sum_ += sum;
+    count_ += count;
+}
+
 void MinMaxCalculator::Reset() {
     max_ = std::numeric_limits<double>::lowest();
     min_ = std::numeric_limits<double>::max();
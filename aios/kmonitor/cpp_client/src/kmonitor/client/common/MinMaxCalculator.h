@@ -21,6 +21,7 @@ public:
 
 public:
     void Add(double value);
+    void Merge(double min, double max, double sum, int count);
     void Reset();
     std::string ToString() const;
 
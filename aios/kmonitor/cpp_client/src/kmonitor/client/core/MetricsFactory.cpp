@@ -7,13 +7,16 @@
 
 #include "kmonitor/client/core/MetricsFactory.h"
 
+#include <atomic>
 #include <string>
 
+#include "autil/EnvUtil.h"
 #include "kmonitor/client/metric/CounterMetric.h"
 #include "kmonitor/client/metric/GaugeMetric.h"
 #include "kmonitor/client/metric/Metric.h"
 #include "kmonitor/client/metric/QpsMetric.h"
 #include "kmonitor/client/metric/RawMetric.h"
+#include "kmonitor/client/metric/ShardedMetric.h"
 #include "kmonitor/client/metric/StatusMetric.h"
 #include "kmonitor/client/metric/SummaryMetric.h"
 
@@ -21,7 +24,27 @@ BEGIN_KMONITOR_NAMESPACE(kmonitor);
 
 using std::string;
 
+static std::atomic<bool> shardedRecord(autil::EnvUtil::getEnv<bool>("KMONITOR_SHARDED_METRIC_RECORD", false));
+
+void MetricsFactory::SetShardedRecord(bool enable) { shardedRecord = enable; }
+
+bool MetricsFactory::IsShardedRecord() { return shardedRecord; }
+
 Metric *MetricsFactory::CreateMetric(const string &name, MetricType metric_type) {
+    if (IsShardedRecord()) {
+        switch (metric_type) {
+        case GAUGE:
+            return new ShardedGaugeMetric(name);
+        case SUMMARY:
+            return new ShardedSummaryMetric(name);
+        case QPS:
+            return new ShardedQpsMetric(name);
+        case COUNTER:
+            return new ShardedCounterMetric(name);
+        default:
+            break;
+        }
+    }
     Metric *metric;
     switch (metric_type) {
     case GAUGE:
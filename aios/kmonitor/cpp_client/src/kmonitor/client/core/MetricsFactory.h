@@ -20,6 +20,10 @@ class Metric;
 class MetricsFactory {
 public:
     static Metric *CreateMetric(const std::string &name, MetricType metric_type);
+    // sharded record: counter/qps/gauge/summary metrics are updated without metric lock,
+    // default from env KMONITOR_SHARDED_METRIC_RECORD, only affects metrics created later
+    static void SetShardedRecord(bool enable);
+    static bool IsShardedRecord();
 
 private:
     MetricsFactory(const MetricsFactory &);
@@ -50,6 +50,13 @@ void DDSketch::Flush() {
     indexCountMap_.clear();
 }
 
+void DDSketch::Merge(DDSketch &other) {
+    Flush();
+    other.Flush();
+    zeroCount_ += other.zeroCount_;
+    store_.merge(other.store_);
+}
+
 // use autil::legacy::ToJsonString(DDSketch, true) to get
 void DDSketch::Jsonize(autil::legacy::Jsonizable::JsonWrapper &json) {
     json.Jsonize("minIndexedValue", minIndexedValue_, minIndexedValue_);
@@ -24,6 +24,8 @@ public:
     ~DDSketch() {}
     void accept(double value);
     void Flush();
+    // other must use the same relative accuracy
+    void Merge(DDSketch &other);
     void Jsonize(autil::legacy::Jsonizable::JsonWrapper &json) override;
 
 private:
@@ -90,6 +90,12 @@ void DenseStore::centerCounts(int32_t newMinIndex, int32_t newMaxIndex) {
     maxIndex_ = newMaxIndex;
 }
 
+void DenseStore::merge(const DenseStore &other) {
+    for (int32_t index = other.minIndex_; index <= other.maxIndex_; index++) {
+        add(index, other.counts_[index - other.offset_]);
+    }
+}
+
 void DenseStore::getCounts(std::vector<int64_t> &vec) { vec.assign(counts_, counts_ + countsLength_); }
 
 void DenseStore::shiftCounts(int32_t shift) {
@@ -33,6 +33,7 @@ public:
     void shiftCounts(int32_t shift);
     void getCounts(std::vector<int64_t> &vec);
     void adjust(int newMinIndex, int newMaxIndex);
+    void merge(const DenseStore &other);
 
     int32_t getMinIndex() {
         if (isEmpty()) {
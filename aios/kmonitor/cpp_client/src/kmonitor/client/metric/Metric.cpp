@@ -15,7 +15,10 @@ const std::string Metric::HEADER_IP("ip");
 const std::string Metric::HEADER_TENANT("tenant");
 const std::string Metric::HEADER_FORMAT("format");
 
-Metric::Metric(const std::string &name) : untouch_num_(-1), ref_cnt_(0) {
+Metric::Metric(const std::string &name) : Metric(name, false) {}
+
+Metric::Metric(const std::string &name, bool lockFreeUpdate)
+    : untouch_num_(-1), ref_cnt_(0), lock_free_update_(lockFreeUpdate) {
     info_ = MetricsInfoPtr(new MetricsInfo(name, name));
 }
 
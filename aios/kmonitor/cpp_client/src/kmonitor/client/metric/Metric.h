@@ -8,6 +8,8 @@
 #ifndef KMONITOR_CLIENT_METRIC_METRIC_H_
 #define KMONITOR_CLIENT_METRIC_METRIC_H_
 
+#include <atomic>
+
 #include "autil/Lock.h"
 #include "kmonitor/client/MetricLevel.h"
 #include "kmonitor/client/common/Common.h"
@@ -28,11 +30,19 @@ public:
     Metric(const Metric &) = delete;
 
 protected:
+    // lockFreeUpdate: doUpdate is thread safe by itself, Update skips metric_mutex_
+    Metric(const std::string &name, bool lockFreeUpdate);
+
     virtual void doUpdate(double value) = 0;
     virtual void doSnapshot(MetricsRecord *record, int64_t period /*ms*/) = 0;
 
 public:
     void Update(double value) {
+        if (lock_free_update_) {
+            doUpdate(value);
+            Touch();
+            return;
+        }
         autil::ScopedLock lock(metric_mutex_);
         doUpdate(value);
         Touch();
@@ -71,16 +81,21 @@ public:
     }
 
 public:
-    void Touch() { untouch_num_ = 0; }
+    void Touch() {
+        if (untouch_num_.load(std::memory_order_relaxed) != 0) {
+            untouch_num_.store(0, std::memory_order_relaxed);
+        }
+    }
 
-    void Untouch() { ++untouch_num_; }
+    void Untouch() { untouch_num_.fetch_add(1, std::memory_order_relaxed); }
 
 private:
     Metric &operator=(const Metric &);
 
 private:
-    int8_t untouch_num_;
+    std::atomic<int8_t> untouch_num_;
     int32_t ref_cnt_;
+    const bool lock_free_update_;
     autil::ThreadMutex metric_mutex_;
 
 protected:
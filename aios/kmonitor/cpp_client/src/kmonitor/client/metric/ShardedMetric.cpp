@@ -0,0 +1,152 @@
+/*
+ * Copyright 2014-2020 Alibaba Inc. All rights reserved.
+ * */
+
+#include "kmonitor/client/metric/ShardedMetric.h"
+
+#include <math.h>
+#include <string>
+
+#include "kmonitor/client/core/MetricsInfo.h"
+
+BEGIN_KMONITOR_NAMESPACE(kmonitor);
+
+using namespace std;
+
+namespace {
+
+void atomicAdd(std::atomic<double> &target, double value) {
+    double current = target.load(std::memory_order_relaxed);
+    while (!target.compare_exchange_weak(current, current + value, std::memory_order_relaxed)) {
+    }
+}
+
+void atomicMin(std::atomic<double> &target, double value) {
+    double current = target.load(std::memory_order_relaxed);
+    while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+void atomicMax(std::atomic<double> &target, double value) {
+    double current = target.load(std::memory_order_relaxed);
+    while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+size_t MetricShards::CurrentShard() {
+    static std::atomic<size_t> nextShard(0);
+    static thread_local size_t shard = nextShard.fetch_add(1, std::memory_order_relaxed) % SHARD_COUNT;
+    return shard;
+}
+
+void SumShard::Add(double value) { atomicAdd(sum, value); }
+
+void MinMaxShard::Add(double value) {
+    atomicAdd(sum, value);
+    atomicMin(min, value);
+    atomicMax(max, value);
+    count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MinMaxShard::TakeTo(MinMaxCalculator &calculator) {
+    int32_t takenCount = count.exchange(0, std::memory_order_relaxed);
+    if (takenCount == 0) {
+        return;
+    }
+    double takenSum = sum.exchange(0, std::memory_order_relaxed);
+    double takenMin = min.exchange(std::numeric_limits<double>::max(), std::memory_order_relaxed);
+    double takenMax = max.exchange(std::numeric_limits<double>::lowest(), std::memory_order_relaxed);
+    calculator.Merge(takenMin, takenMax, takenSum, takenCount);
+}
+
+ShardedCounterMetric::ShardedCounterMetric(const string &name) : Metric(name, true), value_(0) {}
+
+ShardedCounterMetric::~ShardedCounterMetric() {}
+
+void ShardedCounterMetric::doUpdate(double value) { shards_[MetricShards::CurrentShard()].Add(value); }
+
+void ShardedCounterMetric::doSnapshot(MetricsRecord *record, int64_t period) {
+    for (auto &shard : shards_) {
+        value_ += shard.Take();
+    }
+    record->AddValue(info_, value_);
+}
+
+ShardedQpsMetric::ShardedQpsMetric(const string &name) : Metric(name, true) {}
+
+ShardedQpsMetric::~ShardedQpsMetric() {}
+
+void ShardedQpsMetric::doUpdate(double value) { shards_[MetricShards::CurrentShard()].Add(value); }
+
+void ShardedQpsMetric::doSnapshot(MetricsRecord *record, int64_t period) {
+    double value = 0;
+    for (auto &shard : shards_) {
+        value += shard.Take();
+    }
+    if (period > 0) {
+        record->AddValue(info_, value * 1000 / period);
+    }
+}
+
+ShardedGaugeMetric::ShardedGaugeMetric(const string &name) : Metric(name, true) {}
+
+ShardedGaugeMetric::~ShardedGaugeMetric() {}
+
+void ShardedGaugeMetric::doUpdate(double value) { shards_[MetricShards::CurrentShard()].Add(value); }
+
+void ShardedGaugeMetric::doSnapshot(MetricsRecord *record, int64_t period) {
+    for (auto &shard : shards_) {
+        shard.TakeTo(calculator_);
+    }
+    if (calculator_.Count() == 0) {
+        return;
+    }
+    record->AddValue(info_, calculator_.ToString());
+    calculator_.Reset();
+}
+
+const double ShardedSummaryMetric::RELATIVE_ACCURACY = 0.01;
+
+ShardedSummaryMetric::ShardedSummaryMetric(const string &name) : Metric(name, true) {
+    const string fullMetric = name + ".summary";
+    summary_info_ = MetricsInfoPtr(new MetricsInfo(fullMetric, fullMetric, {{Metric::HEADER_FORMAT, "ddsketch"}}));
+}
+
+ShardedSummaryMetric::~ShardedSummaryMetric() { summary_info_.reset(); }
+
+void ShardedSummaryMetric::doUpdate(double value) {
+    if (::isnan(value)) {
+        return;
+    }
+    auto &shard = shards_[MetricShards::CurrentShard()];
+    autil::ScopedSpinLock lock(shard.lock);
+    shard.calculator.Add(value);
+    if (!shard.ddsketch) {
+        shard.ddsketch.reset(new DDSketch(RELATIVE_ACCURACY));
+    }
+    shard.ddsketch->accept(value);
+}
+
+void ShardedSummaryMetric::doSnapshot(MetricsRecord *record, int64_t period) {
+    MinMaxCalculator calculator;
+    DDSketch ddsketch(RELATIVE_ACCURACY);
+    for (auto &shard : shards_) {
+        std::unique_ptr<DDSketch> shardSketch;
+        {
+            autil::ScopedSpinLock lock(shard.lock);
+            calculator.Merge(shard.calculator.Min(), shard.calculator.Max(), shard.calculator.Sum(),
+                             shard.calculator.Count());
+            shard.calculator.Reset();
+            shardSketch.swap(shard.ddsketch);
+        }
+        if (shardSketch) {
+            ddsketch.Merge(*shardSketch);
+        }
+    }
+    record->AddValue(info_, calculator.ToString());
+    record->AddValue(summary_info_, autil::legacy::FastToJsonString(&ddsketch, false));
+}
+
+END_KMONITOR_NAMESPACE(kmonitor);
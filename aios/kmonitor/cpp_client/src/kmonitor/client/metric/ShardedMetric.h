@@ -0,0 +1,107 @@
+/*
+ * Copyright 2014-2020 Alibaba Inc. All rights reserved.
+ * */
+
+#ifndef KMONITOR_CLIENT_METRIC_SHARDEDMETRIC_H_
+#define KMONITOR_CLIENT_METRIC_SHARDEDMETRIC_H_
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "autil/Lock.h"
+#include "kmonitor/client/common/Common.h"
+#include "kmonitor/client/common/MinMaxCalculator.h"
+#include "kmonitor/client/metric/DDSketch.h"
+#include "kmonitor/client/metric/Metric.h"
+
+BEGIN_KMONITOR_NAMESPACE(kmonitor);
+
+// Sharded metrics record into per-thread shards without taking the metric lock,
+// shards are merged (and reset) in doSnapshot, output records are the same as
+// the non-sharded metric of the same type.
+class MetricShards {
+public:
+    static const size_t SHARD_COUNT = 32;
+    // threads are assigned to shards round robin on first use
+    static size_t CurrentShard();
+};
+
+struct alignas(64) SumShard {
+    std::atomic<double> sum{0};
+
+    void Add(double value);
+    double Take() { return sum.exchange(0, std::memory_order_relaxed); }
+};
+
+struct alignas(64) MinMaxShard {
+    std::atomic<double> sum{0};
+    std::atomic<double> min{std::numeric_limits<double>::max()};
+    std::atomic<double> max{std::numeric_limits<double>::lowest()};
+    std::atomic<int32_t> count{0};
+
+    void Add(double value);
+    void TakeTo(MinMaxCalculator &calculator);
+};
+
+class ShardedCounterMetric : public Metric {
+public:
+    explicit ShardedCounterMetric(const std::string &name);
+    ~ShardedCounterMetric();
+    void doUpdate(double value) override;
+    void doSnapshot(MetricsRecord *record, int64_t period) override;
+
+private:
+    SumShard shards_[MetricShards::SHARD_COUNT];
+    double value_;
+};
+
+class ShardedQpsMetric : public Metric {
+public:
+    explicit ShardedQpsMetric(const std::string &name);
+    ~ShardedQpsMetric();
+    void doUpdate(double value) override;
+    void doSnapshot(MetricsRecord *record, int64_t period) override;
+
+private:
+    SumShard shards_[MetricShards::SHARD_COUNT];
+};
+
+class ShardedGaugeMetric : public Metric {
+public:
+    explicit ShardedGaugeMetric(const std::string &name);
+    ~ShardedGaugeMetric();
+    void doUpdate(double value) override;
+    void doSnapshot(MetricsRecord *record, int64_t period) override;
+
+private:
+    MinMaxShard shards_[MetricShards::SHARD_COUNT];
+    MinMaxCalculator calculator_;
+};
+
+class ShardedSummaryMetric : public Metric {
+public:
+    explicit ShardedSummaryMetric(const std::string &name);
+    ~ShardedSummaryMetric();
+    void doUpdate(double value) override;
+    void doSnapshot(MetricsRecord *record, int64_t period) override;
+
+private:
+    // a DDSketch can not be updated with atomics, each shard owns one guarded by a
+    // spin lock which is only contended when threads share a shard or on snapshot
+    struct alignas(64) SketchShard {
+        autil::SpinLock lock;
+        MinMaxCalculator calculator;
+        std::unique_ptr<DDSketch> ddsketch;
+    };
+
+private:
+    MetricsInfoPtr summary_info_;
+    SketchShard shards_[MetricShards::SHARD_COUNT];
+    static const double RELATIVE_ACCURACY;
+};
+
+END_KMONITOR_NAMESPACE(kmonitor);
+
+#endif // KMONITOR_CLIENT_METRIC_SHARDEDMETRIC_H_
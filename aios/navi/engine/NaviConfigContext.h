@@ -43,6 +43,9 @@ public:
     void Jsonize(const std::string &key, T &value, const T &defaultValue);
     void Jsonize(const std::string &key, std::string &value, const char *defaultValue);
     std::map<std::string, std::string> getBinaryAttrs() const;
+    autil::legacy::RapidValue *getJsonAttrs() const {
+        return _jsonAttrs;
+    }
     NaviConfigContext enter(const std::string &key);
     const std::string &getConfigPath() const;
     bool isArray() const;
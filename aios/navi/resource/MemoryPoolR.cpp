@@ -16,6 +16,9 @@
 #include "navi/resource/MemoryPoolR.h"
 
 #include "autil/EnvUtil.h"
+#include "autil/mem_pool/ChunkRecycler.h"
+#include "autil/mem_pool/SimpleAllocatePolicy.h"
+#include "autil/mem_pool/ThreadCachedPool.h"
 #include "kmonitor/client/MetricMacro.h"
 #include "kmonitor/client/MetricsReporter.h"
 #include "lockless_allocator/LocklessApi.h"
@@ -27,12 +30,16 @@ using namespace std;
 namespace navi {
 
 static const std::string POOL_MODE_ASAN = "naviPoolModeAsan";
+static const std::string POOL_MODE_THREAD_CACHED = "naviPoolModeThreadCached";
 static const std::string POOL_CACHE_AUTOSCALE_KEEP_COUNT = "naviPoolAutoScaleKeepCount";
 static const std::string POOL_TRUNK_SIZE = "naviPoolTrunkSize";
 static const std::string POOL_RECYCLE_SIZE_LIMIT = "naviPoolRecycleSizeLimit";
 static const std::string POOL_RELEASE_RATE = "naviPoolReleaseRate";
+static const std::string POOL_CHUNK_RECYCLE_SIZE = "naviPoolChunkRecycleSize";
 static const std::string POOL_CACHE_SIZE_METRIC = "poolCacheSize";
 static const std::string POOL_CACHE_SIZE_LIMIT_METRIC = "poolCacheSizeLimit";
+static const std::string CHUNK_RECYCLE_HIT_RATIO_METRIC = "chunkRecycleHitRatio";
+static const std::string CHUNK_RECYCLE_RETAINED_BYTES_METRIC = "chunkRecycleRetainedBytes";
 static constexpr size_t POOL_AUTO_SCALE_SECONDS = 180;
 
 class GetPoolOpMetrics : public MetricsGroup
@@ -70,12 +77,15 @@ const std::string MemoryPoolR::RESOURCE_ID = "navi.buildin.resource.mem_pool";
 
 MemoryPoolR::MemoryPoolR()
     : _useAsanPool(autil::EnvUtil::getEnv(POOL_MODE_ASAN, myHasInterceptorMalloc()))
+    , _useThreadCachedPool(autil::EnvUtil::getEnv(POOL_MODE_THREAD_CACHED, false))
     , _poolChunkSize(autil::EnvUtil::getEnv(POOL_TRUNK_SIZE, DEFAULT_POOL_CHUNK_SIZE) * 1024 * 1024)
     , _poolReleaseThreshold(autil::EnvUtil::getEnv(POOL_RECYCLE_SIZE_LIMIT, DEFAULT_POOL_RELEASE_THRESHOLD) * 1024 *
                             1024)
     , _poolCacheAutoScaleKeepCount(
           autil::EnvUtil::getEnv(POOL_CACHE_AUTOSCALE_KEEP_COUNT, DEFAULT_POOL_CACHE_AUTOSCALE_KEEP_COUNT))
     , _poolAutoScaleReleaseRate(autil::EnvUtil::getEnv(POOL_RELEASE_RATE, DEFAULT_POOL_RELEASE_RATE))
+    , _poolChunkRecycleSize(autil::EnvUtil::getEnv(POOL_CHUNK_RECYCLE_SIZE, DEFAULT_POOL_CHUNK_RECYCLE_SIZE) * 1024 *
+                            1024)
     , _poolCacheSizeLB(std::numeric_limits<size_t>::max())
     , _poolCacheSizeUB(std::numeric_limits<size_t>::min())
     , _poolCacheSizeLimit(0ul) {}
@@ -113,13 +123,19 @@ void MemoryPoolR::initConfigParams() {
     NAVI_KERNEL_LOG(INFO,
                     "memory pool resource config finished: "
                     "poolChunkSize[%lu] "
-                    "poolReleaseThreshold[%lu] poolAutoScaleReleaseRate[%lu] keepCount[%lu] useAsanPool[%d]",
+                    "poolReleaseThreshold[%lu] poolAutoScaleReleaseRate[%lu] keepCount[%lu] useAsanPool[%d] "
+                    "useThreadCachedPool[%d] poolChunkRecycleSize[%lu]",
                     _poolChunkSize,
                     _poolReleaseThreshold,
                     _poolAutoScaleReleaseRate,
                     _poolCacheAutoScaleKeepCount,
-                    _useAsanPool);
+                    _useAsanPool,
+                    _useThreadCachedPool,
+                    _poolChunkRecycleSize);
     _poolCacheSizeLimit = 0ul;
+    if (_poolChunkRecycleSize > 0) {
+        autil::mem_pool::ChunkRecycler::getInstance()->setMaxIdleBytes(_poolChunkRecycleSize);
+    }
 }
 
 bool MemoryPoolR::init(kmonitor::MetricsReporterPtr metricsReporter) {
@@ -171,8 +187,10 @@ autil::mem_pool::Pool *MemoryPoolR::getPool() {
 
         if (_useAsanPool) {
             pool = new autil::mem_pool::PoolAsan();
+        } else if (_useThreadCachedPool) {
+            pool = new autil::mem_pool::ThreadCachedPool(createAllocatePolicy());
         } else {
-            pool = new autil::mem_pool::Pool(_poolChunkSize);
+            pool = new autil::mem_pool::Pool(createAllocatePolicy());
         }
         if (_getPoolOpByNewReporter) {
             _getPoolOpByNewReporter->report<GetPoolOpMetrics>(nullptr, pool);
@@ -241,10 +259,38 @@ void MemoryPoolR::poolCacheSizeAutoScale() {
 
     REPORT_USER_MUTABLE_STATUS(_commonReporter,
                                POOL_CACHE_SIZE_LIMIT_METRIC, poolCacheSizeLimit);
+    if (_poolChunkRecycleSize > 0) {
+        trimChunkRecycler();
+    }
     NAVI_LOG(DEBUG, "pool cache size limit updated, lb [%lu] ub [%lu] limit [%lu]",
              poolCacheSizeLB, poolCacheSizeUB, poolCacheSizeLimit);
 }
 
+autil::mem_pool::AllocatePolicy *MemoryPoolR::createAllocatePolicy() const {
+    if (_poolChunkRecycleSize > 0) {
+        return new autil::mem_pool::SimpleAllocatePolicy(
+                new autil::mem_pool::RecycleChunkAllocator(), _poolChunkSize, true);
+    }
+    return new autil::mem_pool::SimpleAllocatePolicy(_poolChunkSize);
+}
+
+void MemoryPoolR::trimChunkRecycler() {
+    auto recycler = autil::mem_pool::ChunkRecycler::getInstance();
+    size_t trimmedBytes = recycler->trim();
+    uint64_t hitCount = recycler->getHitCount();
+    uint64_t missCount = recycler->getMissCount();
+    uint64_t hitDelta = hitCount - _lastChunkRecycleHitCount;
+    uint64_t totalDelta = hitDelta + (missCount - _lastChunkRecycleMissCount);
+    _lastChunkRecycleHitCount = hitCount;
+    _lastChunkRecycleMissCount = missCount;
+    if (totalDelta > 0) {
+        REPORT_USER_MUTABLE_STATUS(_commonReporter, CHUNK_RECYCLE_HIT_RATIO_METRIC, (double)hitDelta / totalDelta);
+    }
+    REPORT_USER_MUTABLE_STATUS(_commonReporter, CHUNK_RECYCLE_RETAINED_BYTES_METRIC, recycler->getRetainedBytes());
+    NAVI_LOG(DEBUG, "chunk recycler trimmed [%lu] bytes, hit [%lu] total [%lu] in last period",
+             trimmedBytes, hitDelta, totalDelta);
+}
+
 bool MemoryPoolR::myHasInterceptorMalloc() {
     return hasInterceptorMalloc();
 }
@@ -23,6 +23,10 @@ namespace kmonitor {
 class MetricsReporter;
 } // namespace kmonitor
 
+namespace autil::mem_pool {
+class AllocatePolicy;
+} // namespace autil::mem_pool
+
 namespace navi {
 
 class MemoryPoolR : public MemoryPoolRBase {
@@ -56,6 +60,8 @@ private:
     void initMetricsReporter(kmonitor::MetricsReporter &baseReporter);
     bool reachPoolCacheSizeLimit();
     void poolCacheSizeAutoScale();
+    autil::mem_pool::AllocatePolicy *createAllocatePolicy() const;
+    void trimChunkRecycler();
     bool myHasInterceptorMalloc();
 
 private:
@@ -63,14 +69,19 @@ private:
     static constexpr size_t DEFAULT_POOL_RELEASE_THRESHOLD = 16; // 16MB
     static constexpr size_t DEFAULT_POOL_RELEASE_RATE = 3ul;                   // rate = 3 / 13
     static constexpr size_t DEFAULT_POOL_CACHE_AUTOSCALE_KEEP_COUNT = 500ul;
+    static constexpr size_t DEFAULT_POOL_CHUNK_RECYCLE_SIZE = 0;  // MB
 
 private:
     DECLARE_LOGGER();
     bool _useAsanPool;
+    // pools are shared by kernels on different threads, avoid the pool lock on allocate
+    bool _useThreadCachedPool;
     size_t _poolChunkSize;
     size_t _poolReleaseThreshold;
     size_t _poolCacheAutoScaleKeepCount;
     size_t _poolAutoScaleReleaseRate; // range [0..10]
+    // idle chunk budget of the process-wide chunk recycler, 0 disables recycling
+    size_t _poolChunkRecycleSize;
 private:
     std::shared_ptr<kmonitor::MetricsReporter> _commonReporter;
     std::shared_ptr<kmonitor::MetricsReporter> _graphMemoryPoolReporter;
@@ -85,6 +96,8 @@ private:
     std::atomic<size_t> _poolCacheSizeUB;
     std::atomic<size_t> _poolCacheSizeLimit;
     autil::LoopThreadPtr _poolCacheSizeAutoScaleThread;
+    uint64_t _lastChunkRecycleHitCount = 0;
+    uint64_t _lastChunkRecycleMissCount = 0;
 };
 
 NAVI_TYPEDEF_PTR(MemoryPoolR);
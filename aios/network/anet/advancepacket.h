@@ -230,6 +230,10 @@ public:
     virtual bool encode(DataBuffer *output);
     virtual bool decode(DataBuffer *input, PacketHeader *header);
 
+    /* Advance header and checksum are encoded together with the body, so
+     * the body can not be sent separately. */
+    virtual bool getZeroCopyBody(const char *&data, size_t &len) { return false; }
+
     /* Get channel id by combing the chid field in Packet and chidHigh field
      * in AdvancePacket. */
     virtual uint64_t getChannelId(void) {
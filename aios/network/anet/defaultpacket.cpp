@@ -122,6 +122,15 @@ bool DefaultPacket::encode(DataBuffer *output) {
     return true;
 }
 
+bool DefaultPacket::getZeroCopyBody(const char *&data, size_t &len) {
+    if (_bodyLength == 0) {
+        return false;
+    }
+    data = _body;
+    len = _bodyLength;
+    return true;
+}
+
 bool DefaultPacket::decode(DataBuffer *input, PacketHeader *header) {
     assert(input->getDataLen() >= header->_dataLen);
     bool rc = setBody(input->getData(), header->_dataLen);
@@ -47,6 +47,7 @@ public:
 
     bool encode(DataBuffer *output);
     bool decode(DataBuffer *input, PacketHeader *header);
+    bool getZeroCopyBody(const char *&data, size_t &len);
 
     int64_t getSpaceUsed();
     size_t getBodyLen() const;
@@ -126,6 +126,21 @@ bool DefaultPacketStreamer::encode(Packet *packet, DataBuffer *output) {
     return true;
 }
 
+bool DefaultPacketStreamer::encodeHeader(Packet *packet, DataBuffer *output, size_t bodyLen) {
+    if (bodyLen > (size_t)max_package_size) {
+        return false;
+    }
+    PacketHeader *header = packet->getPacketHeader();
+    header->_dataLen = (int32_t)bodyLen;
+    if (_existPacketHeader) {
+        output->writeInt32(ANET_PACKET_FLAG);
+        output->writeInt32(header->_chid);
+        output->writeInt32(header->_pcode);
+        output->writeInt32(header->_dataLen);
+    }
+    return true;
+}
+
 bool DefaultPacketStreamer::processData(DataBuffer *dataBuffer, StreamingContext *context) {
     Packet *packet = context->getPacket();
     if (NULL == packet) {
@@ -55,6 +55,17 @@ public:
      */
     bool encode(Packet *packet, DataBuffer *output);
 
+    /**
+     * encode the packet header only, body with bodyLen bytes will be
+     * written after it by the connection
+     *
+     * @param packet packet to be encoded
+     * @param output output data buffer
+     * @param bodyLen body length
+     * @return return true if header encoded
+     */
+    bool encodeHeader(Packet *packet, DataBuffer *output, size_t bodyLen);
+
     bool processData(DataBuffer *dataBuffer, StreamingContext *context);
 };
 } // namespace anet
@@ -96,6 +96,8 @@ public:
     bool encodeStartLine(DataBuffer *output);
     bool encodeHeaders(DataBuffer *output);
     bool encodeBody(DataBuffer *output);
+    /* start line and headers are encoded before body */
+    bool getZeroCopyBody(const char *&data, size_t &len) { return false; }
 
     bool decode(DataBuffer *input, PacketHeader *header) { return false; }
     int64_t getSpaceUsed();
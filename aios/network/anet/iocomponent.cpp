@@ -54,6 +54,7 @@ IOComponent::IOComponent(Transport *owner, Socket *socket) {
     _isSocketInEpoll = false;
     _type = IOC_BASE;
     _belongedWorker = NULL;
+    _belongedWorkerIndex = -1;
 }
 
 /*
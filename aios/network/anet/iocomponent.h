@@ -260,6 +260,13 @@ public:
 
     IocType getType() const { return _type; }
 
+    /*
+     * pin this component to the index-th io worker of its transport,
+     * -1 means distributing by socket fd
+     */
+    void setBelongedWorkerIndex(int index) { _belongedWorkerIndex = index; }
+    int getBelongedWorkerIndex() const { return _belongedWorkerIndex; }
+
 protected:
     /**
      * Transport distribute ioworker based on socket fd
@@ -287,6 +294,7 @@ protected:
     ThreadMutex _socketMutex;
     IocType _type;
     IoWorker *_belongedWorker;
+    int _belongedWorkerIndex;
 
 private:
     IOComponent *_prev; // 用于链表
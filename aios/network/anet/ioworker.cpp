@@ -18,6 +18,7 @@
 #include <assert.h>
 #include <cstddef>
 #include <iosfwd>
+#include <pthread.h>
 #include <sched.h>
 #include <signal.h>
 #include <stdint.h>
@@ -83,6 +84,7 @@ void IoWorker::run(Thread *thread, void *arg) {
         thread->setPriority(1, SCHED_RR);
     }
     setPriorityByEnv();
+    bindCpu();
     eventLoop();
 }
 
@@ -98,6 +100,21 @@ void IoWorker::setPriorityByEnv() {
     }
 }
 
+void IoWorker::bindCpu() {
+    if (_cpu < 0) {
+        return;
+    }
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(_cpu, &cpuSet);
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+    if (ret != 0) {
+        ANET_LOG(ERROR, "bind anet io worker %d to cpu %d failed, error %d.", _index, _cpu, ret);
+    } else {
+        ANET_LOG(INFO, "bind anet io worker %d to cpu %d success.", _index, _cpu);
+    }
+}
+
 void IoWorker::eventLoop() {
     while (!_stop) {
         int64_t now = TimeUtil::getTime();
@@ -110,6 +127,10 @@ void IoWorker::step(int64_t timeStamp) {
     IOEvent events[MAX_SOCKET_EVENTS];
     int cnt = _socketEvent.getEvents(_epollWaitTimeoutMs, events, MAX_SOCKET_EVENTS);
     _loopTime = TimeUtil::getTime();
+    _stat.loopCount++;
+    if (cnt > 0) {
+        _stat.eventCount += cnt;
+    }
     for (int k = 0; k < cnt; ++k) {
         IOComponent *ioc = events[k]._ioc;
         assert(ioc);
@@ -186,6 +207,7 @@ void IoWorker::addComponent(IOComponent *ioc) {
         _iocListTail->_next = ioc;
     }
     _iocListTail = ioc;
+    _stat.componentCount++;
     ioc->addRef();
     ioc->referencedByReadWriteThread(true);
 }
@@ -207,6 +229,7 @@ void IoWorker::removeComponent(IOComponent *ioc) {
         ioc->_prev->_next = ioc->_next;
     if (ioc->_next != NULL)
         ioc->_next->_prev = ioc->_prev;
+    _stat.componentCount--;
     ioc->referencedByReadWriteThread(false);
     ioc->subRef();
 }
@@ -222,6 +245,7 @@ void IoWorker::closeComponents() {
         ioc->subRef();
     }
     _iocListHead = _iocListTail = NULL;
+    _stat.componentCount = 0;
 
     for (std::vector<Transport::TransportCommand>::iterator it = _commands.begin(); it != _commands.end(); ++it) {
         ANET_LOG(DEBUG, "IOC(%p)->subRef(), [%d]", it->ioc, it->ioc->getRef());
@@ -264,6 +288,13 @@ void IoWorker::getTcpConnStats(vector<ConnStat> &connStats) {
     }
 }
 
+IoWorkerStat IoWorker::getStat() {
+    IoWorkerStat stat = _stat;
+    stat.index = _index;
+    stat.cpu = _cpu;
+    return stat;
+}
+
 SocketEvent *IoWorker::getSocketEvent() { return &_socketEvent; }
 
 void IoWorker::setName(const char *name) { _ioThread.setName(name); }
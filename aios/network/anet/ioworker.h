@@ -30,6 +30,15 @@
 
 namespace anet {
 
+struct IoWorkerStat {
+    int index{-1};
+    int cpu{-1};               // pinned cpu, -1 if not pinned
+    int64_t loopCount{0};      // epoll wait rounds
+    int64_t eventCount{0};     // io events handled
+    int64_t acceptCount{0};    // connections accepted by this worker
+    int64_t componentCount{0}; // io components owned by this worker
+};
+
 /**
  * Class IoWorker is response for watch on a set of file descriptor and
  * dispatch the events on them.
@@ -106,6 +115,18 @@ public:
 
     void setName(const char *name);
 
+    void setIndex(int index) { _index = index; }
+    int getIndex() const { return _index; }
+
+    /**
+     * bind io thread to cpu, should be called before start()
+     * @param cpu: cpu id, -1 means no binding
+     */
+    void setCpuAffinity(int cpu) { _cpu = cpu; }
+
+    void addAcceptCount(int64_t cnt) { _stat.acceptCount += cnt; }
+    IoWorkerStat getStat();
+
 private:
     /**
      * process Command in queue _commands;
@@ -114,6 +135,7 @@ private:
     void addComponent(IOComponent *ioc);
     void removeComponent(IOComponent *ioc);
     void setPriorityByEnv();
+    void bindCpu();
 
 private:
     // mutex for _iocList and _commands
@@ -127,6 +149,9 @@ private:
     IOComponent *_iocListHead, *_iocListTail; // IOComponent list
     std::vector<Transport::TransportCommand> _commands;
     int _epollWaitTimeoutMs{100};
+    int _index{-1};
+    int _cpu{-1};
+    IoWorkerStat _stat;
 
 public:
     static __thread int64_t _loopTime;
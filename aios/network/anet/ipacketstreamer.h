@@ -67,6 +67,18 @@ public:
      */
     virtual bool encode(Packet *packet, DataBuffer *output) = 0;
 
+    /*
+     * Encode only the stream header of a packet whose body is sent
+     * separately, see Packet::getZeroCopyBody().
+     *
+     * @param packet 数据包
+     * @param output 组装后的数据流
+     * @param bodyLen length of the body following the header
+     * @return false if header and body can not be separated, the packet
+     * will then be encoded with encode().
+     */
+    virtual bool encodeHeader(Packet *packet, DataBuffer *output, size_t bodyLen) { return false; }
+
     /*
      * 是否有数据包头
      */
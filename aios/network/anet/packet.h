@@ -15,6 +15,7 @@
  */
 #ifndef ANET_PACKET_H_
 #define ANET_PACKET_H_
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -99,6 +100,19 @@ public:
      */
     virtual bool decode(DataBuffer *input, PacketHeader *header) = 0;
 
+    /**
+     * Expose the packet body for zero copy writing. A packet whose
+     * encode() writes nothing but a contiguous body may return it here,
+     * TCPConnection then sends the body straight from this buffer with
+     * writev() instead of copying it into the output DataBuffer. The
+     * buffer must stay valid until packet->free() is called.
+     *
+     * @param data body address
+     * @param len body length
+     * @return Return true if the body can be sent without copy.
+     */
+    virtual bool getZeroCopyBody(const char *&data, size_t &len) { return false; }
+
     virtual int64_t getSpaceUsed() { return 0; }
 
     virtual uint8_t getPacketVersion() { return 0; }
@@ -26,6 +26,7 @@
 #include "aios/network/anet/connectionpriority.h"
 
 struct sockaddr_in;
+struct iovec;
 
 namespace anet {
 const int LISTEN_BACKLOG = 256;
@@ -70,6 +71,7 @@ public:
     void setIOComponent(IOComponent *ioc);
 
     virtual int write(const void *data, int len);
+    virtual int writev(const struct iovec *iov, int iovcnt);
     virtual int read(void *data, int len);
 
     bool setKeepAlive(bool on) { return setIntOption(SO_KEEPALIVE, on ? 1 : 0); }
@@ -78,6 +80,8 @@ public:
 
     bool setReuseAddress(bool on) { return setIntOption(SO_REUSEADDR, on ? 1 : 0); }
 
+    bool setReusePort(bool on) { return setIntOption(SO_REUSEPORT, on ? 1 : 0); }
+
     bool setSoLinger(bool doLinger, int seconds);
 
     bool setTcpNoDelay(bool noDelay);
@@ -35,7 +35,8 @@ void StatCounter::log() {
     ANET_LOG(INFO,
              "_packetReadCnt: %lld, _packetWriteCnt: %lld, "
              "_packetTimeoutCnt: %lld, _dataReadCnt: %lld, "
-             "_dataWriteCnt: %lld, _inputBufferSpaceAllocated: %lld, "
+             "_dataWriteCnt: %lld, _dataCopyCnt: %lld, _dataZeroCopyCnt: %lld, "
+             "_inputBufferSpaceAllocated: %lld, "
              "_outputBufferSpaceAllocated: %lld, "
              "_outputBufferSpaceUsed: %lld, _outputQueueSpaceUsed: %lld, _outputQueueSize: %lld",
              atomic_read(&_packetReadCnt),
@@ -43,6 +44,8 @@ void StatCounter::log() {
              atomic_read(&_packetTimeoutCnt),
              atomic_read(&_dataReadCnt),
              atomic_read(&_dataWriteCnt),
+             atomic_read(&_dataCopyCnt),
+             atomic_read(&_dataZeroCopyCnt),
              atomic_read(&_inputBufferSpaceAllocated),
              atomic_read(&_outputBufferSpaceAllocated),
              atomic_read(&_outputBufferSpaceUsed),
@@ -57,7 +60,9 @@ int StatCounter::dump(ostringstream &buf) {
     buf << "\tpacket write count: " << atomic_read(&_packetWriteCnt);
     buf << "\tpacket timeout count: " << atomic_read(&_packetTimeoutCnt) << endl;
     buf << "bytes read : " << atomic_read(&_dataReadCnt);
-    buf << "\tbytes write: " << atomic_read(&_dataWriteCnt) << endl << endl;
+    buf << "\tbytes write: " << atomic_read(&_dataWriteCnt) << endl;
+    buf << "bytes copied to output buffer: " << atomic_read(&_dataCopyCnt);
+    buf << "\tbytes written without copy: " << atomic_read(&_dataZeroCopyCnt) << endl << endl;
 
     buf << "Memory Statistics:\n";
     buf << "total input buffer bytes allocated: " << atomic_read(&_inputBufferSpaceAllocated) << endl;
@@ -73,6 +78,8 @@ void StatCounter::clear() {
     atomic_set(&_packetWriteCnt, 0);
     atomic_set(&_dataReadCnt, 0);
     atomic_set(&_dataWriteCnt, 0);
+    atomic_set(&_dataCopyCnt, 0);
+    atomic_set(&_dataZeroCopyCnt, 0);
     atomic_set(&_packetTimeoutCnt, 0);
     atomic_set(&_inputBufferSpaceAllocated, 0);
     atomic_set(&_outputBufferSpaceAllocated, 0);
@@ -91,6 +98,10 @@ int64_t StatCounter::getDataReadCnt() { return atomic_read(&_dataReadCnt); }
 
 int64_t StatCounter::getDataWriteCnt() { return atomic_read(&_dataWriteCnt); }
 
+int64_t StatCounter::getDataCopyCnt() { return atomic_read(&_dataCopyCnt); }
+
+int64_t StatCounter::getDataZeroCopyCnt() { return atomic_read(&_dataZeroCopyCnt); }
+
 int64_t StatCounter::getInputBufferSpaceAllocated() { return atomic_read(&_inputBufferSpaceAllocated); }
 
 int64_t StatCounter::getOutputBufferSpaceAllocated() { return atomic_read(&_outputBufferSpaceAllocated); }
@@ -34,6 +34,8 @@ public:
     int64_t getPacketTimeoutCnt();
     int64_t getDataReadCnt();
     int64_t getDataWriteCnt();
+    int64_t getDataCopyCnt();
+    int64_t getDataZeroCopyCnt();
     int64_t getInputBufferSpaceAllocated();
     int64_t getOutputBufferSpaceAllocated();
     int64_t getOutputBufferSpaceUsed();
@@ -49,6 +51,8 @@ public:
     atomic64_t _packetTimeoutCnt; // packets timeout
     atomic64_t _dataReadCnt;      // bytes read
     atomic64_t _dataWriteCnt;     // bytes written
+    atomic64_t _dataCopyCnt;      // bytes copied into output buffer
+    atomic64_t _dataZeroCopyCnt;  // bytes written from packet buffer without copy
 
     // SpaceUsed is for true data size, SpaceAllocated means the total buffer size
     atomic64_t _inputBufferSpaceAllocated;
@@ -72,6 +76,10 @@ public:
     { atomic_add((i), &(ANET_GLOBAL_STAT._dataReadCnt)); }
 #define ANET_COUNT_DATA_WRITE(i)                                                                                       \
     { atomic_add((i), &(ANET_GLOBAL_STAT._dataWriteCnt)); }
+#define ANET_COUNT_DATA_COPY(i)                                                                                        \
+    { atomic_add((i), &(ANET_GLOBAL_STAT._dataCopyCnt)); }
+#define ANET_COUNT_DATA_ZERO_COPY(i)                                                                                   \
+    { atomic_add((i), &(ANET_GLOBAL_STAT._dataZeroCopyCnt)); }
 
 #define ANET_ADD_INPUT_BUFFER_SPACE_ALLOCATED(i)                                                                       \
     { atomic_add((i), &(ANET_GLOBAL_STAT._inputBufferSpaceAllocated)); }
@@ -52,6 +52,13 @@ TCPAcceptor::TCPAcceptor(Transport *owner,
     _type = IOC_TCPACCEPTOR;
 }
 
+TCPAcceptor::~TCPAcceptor() {
+    for (TCPAcceptor *shard : _shards) {
+        shard->subRef();
+    }
+    _shards.clear();
+}
+
 bool TCPAcceptor::init(bool isServer) {
     _socket->setSoBlocking(false);
     bool rc = ((Socket *)_socket)->listen(_backlog);
@@ -77,6 +84,8 @@ bool TCPAcceptor::handleReadEvent() {
         ANET_LOG(DEBUG, "New connection coming. fd=%d", socket->getSocketHandle());
         TCPComponent *component = new TCPComponent(_owner, socket);
         assert(component);
+        // connections accepted by a reuse port acceptor stay in its io worker
+        component->setBelongedWorkerIndex(getBelongedWorkerIndex());
         component->setMaxIdleTime(_maxIdleTimeInMillseconds);
         if (!component->init(true)) {
             delete component; /**@TODO: may coredump?*/
@@ -87,6 +96,7 @@ bool TCPAcceptor::handleReadEvent() {
         conn->setQueueTimeout(_timeout);
         _serverAdapter->handlePacket(conn, &ControlPacket::ReceiveNewConnectionPacket);
 
+        _belongedWorker->addAcceptCount(1);
         _lastAcceptedComponent = component;
         _owner->addToCheckingList(component);
 
@@ -111,6 +121,9 @@ void TCPAcceptor::close() {
     }
     _belongedWorker->postCommand(Transport::TC_REMOVE_IOC, this);
     unlock();
+    for (TCPAcceptor *shard : _shards) {
+        shard->close();
+    }
 }
 
 /*
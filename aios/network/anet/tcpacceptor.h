@@ -17,6 +17,7 @@
 #define ANET_TCPACCEPTOR_H_
 #include <ostream>
 #include <stdint.h>
+#include <vector>
 
 #include "aios/network/anet/iocomponent.h"
 
@@ -39,6 +40,8 @@ public:
                 int maxIdleTimeInMillseconds,
                 int backlog);
 
+    ~TCPAcceptor();
+
     bool init(bool isServer = false);
 
     void close();
@@ -58,8 +61,15 @@ public:
         buf << "Max Idle Time: " << _maxIdleTimeInMillseconds << "ms" << std::endl;
         buf << "Queue Timeout: " << _timeout << "ms" << std::endl;
         buf << "Backlog: " << _backlog << std::endl;
+        buf << "Reuse Port Shards: " << _shards.size() << std::endl;
     }
 
+    /**
+     * add an acceptor listening on the same SO_REUSEPORT address,
+     * it is closed together with this acceptor
+     */
+    void addShard(TCPAcceptor *shard) { _shards.push_back(shard); }
+
     /* for UT purpose */
     IOComponent *getLastAcceptedComponent() { return _lastAcceptedComponent; }
 
@@ -69,6 +79,7 @@ private:
     int _timeout;
     int _maxIdleTimeInMillseconds;
     int _backlog;
+    std::vector<TCPAcceptor *> _shards;
 
     /* for testing purpose */
     IOComponent *_lastAcceptedComponent;
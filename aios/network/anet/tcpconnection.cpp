@@ -15,9 +15,11 @@
  */
 #include "aios/network/anet/tcpconnection.h"
 
+#include <algorithm>
 #include <errno.h>
 #include <stdint.h>
 #include <string.h>
+#include <sys/uio.h>
 
 #include "aios/network/anet/channel.h"
 #include "aios/network/anet/channelpool.h"
@@ -34,6 +36,7 @@
 #include "aios/network/anet/streamingcontext.h"
 #include "aios/network/anet/threadcond.h"
 #include "aios/network/anet/timeutil.h"
+#include "autil/EnvUtil.h"
 
 namespace anet {
 class IServerAdapter;
@@ -48,24 +51,101 @@ TCPConnection::TCPConnection(Socket *socket, IPacketStreamer *streamer, IServerA
     _outputBufferSpaceAllocated = 0;
     _maxRecvPacketSize = 0;
     _maxSendPacketSize = 0;
+    _zeroCopyPendingLen = 0;
+    _zeroCopyThreshold = autil::EnvUtil::getEnv("ANET_ZERO_COPY_THRESHOLD", (int64_t)ZERO_COPY_THRESHOLD);
 }
 
 TCPConnection::~TCPConnection() {
+    clearZeroCopyBody();
     addInputBufferSpaceAllocated(0 - _input.getSpaceUsed());
     addOutputBufferSpaceAllocated(0 - _output.getSpaceUsed());
     ANET_ADD_OUTPUT_BUFFER_SPACE_USED(0 - _output.getDataLen());
 }
 
 void TCPConnection::clearOutputBuffer() {
+    clearZeroCopyBody();
     ANET_ADD_OUTPUT_BUFFER_SPACE_USED(0 - _output.getDataLen());
     _output.clear();
 }
 
+void TCPConnection::clearZeroCopyBody() {
+    while (!_zeroCopyBodies.empty()) {
+        Packet *packet = _zeroCopyBodies.front().packet;
+        _zeroCopyBodies.pop_front();
+        packet->invokeDequeueCB();
+        packet->free();
+    }
+    _zeroCopyPendingLen = 0;
+}
+
+int64_t TCPConnection::getPendingWriteLen() { return _output.getDataLen() + _zeroCopyPendingLen; }
+
+int TCPConnection::writeZeroCopyData() {
+    struct iovec iov[ZERO_COPY_MAX_IOV];
+    int iovcnt = 0;
+    int64_t outputPos = 0;
+    size_t bodyCnt = 0;
+    for (const ZeroCopyBody &body : _zeroCopyBodies) {
+        if (iovcnt + 2 > ZERO_COPY_MAX_IOV) {
+            break;
+        }
+        bodyCnt++;
+        if (body.outputOffset > outputPos) {
+            iov[iovcnt].iov_base = _output.getData() + outputPos;
+            iov[iovcnt].iov_len = body.outputOffset - outputPos;
+            iovcnt++;
+            outputPos = body.outputOffset;
+        }
+        iov[iovcnt].iov_base = const_cast<char *>(body.data);
+        iov[iovcnt].iov_len = body.len;
+        iovcnt++;
+    }
+    if (bodyCnt == _zeroCopyBodies.size() && iovcnt < ZERO_COPY_MAX_IOV && _output.getDataLen() > outputPos) {
+        iov[iovcnt].iov_base = _output.getData() + outputPos;
+        iov[iovcnt].iov_len = _output.getDataLen() - outputPos;
+        iovcnt++;
+    }
+    return _socket->writev(iov, iovcnt);
+}
+
+void TCPConnection::drainWrittenData(int64_t len) {
+    while (len > 0) {
+        if (_zeroCopyBodies.empty()) {
+            _output.drainData(len);
+            ANET_ADD_OUTPUT_BUFFER_SPACE_USED(0 - len);
+            return;
+        }
+        ZeroCopyBody &body = _zeroCopyBodies.front();
+        if (body.outputOffset > 0) {
+            int64_t drainLen = std::min(len, body.outputOffset);
+            _output.drainData(drainLen);
+            ANET_ADD_OUTPUT_BUFFER_SPACE_USED(0 - drainLen);
+            for (ZeroCopyBody &pending : _zeroCopyBodies) {
+                pending.outputOffset -= drainLen;
+            }
+            len -= drainLen;
+            continue;
+        }
+        int64_t sentLen = std::min(len, body.len);
+        body.data += sentLen;
+        body.len -= sentLen;
+        _zeroCopyPendingLen -= sentLen;
+        ANET_COUNT_DATA_ZERO_COPY(sentLen);
+        len -= sentLen;
+        if (body.len == 0) {
+            Packet *packet = body.packet;
+            _zeroCopyBodies.pop_front();
+            packet->invokeDequeueCB();
+            packet->free();
+        }
+    }
+}
+
 bool TCPConnection::writeData() {
     // to reduce the odds of blocking postPacket()
     _outputCond.lock();
     _outputQueue.moveTo(&_myQueue);
-    if (_myQueue.size() == 0 && _output.getDataLen() == 0) {
+    if (_myQueue.size() == 0 && getPendingWriteLen() == 0) {
         ANET_LOG(DEBUG, "IOC(%p)->enableWrite(false)", _iocomponent);
         _iocomponent->enableWrite(false);
         _outputCond.unlock();
@@ -82,8 +162,8 @@ bool TCPConnection::writeData() {
 
     _lasttime = TimeUtil::getTime();
     do {
-        while (_output.getDataLen() < _readWriteBufSize) {
-            if (myQueueSize == 0) {
+        while (getPendingWriteLen() < _readWriteBufSize) {
+            if (myQueueSize == 0 || _zeroCopyBodies.size() >= (ZERO_COPY_MAX_IOV - 1) / 2) {
                 break;
             }
 
@@ -91,15 +171,24 @@ bool TCPConnection::writeData() {
             myQueueSize--;
             int64_t oldDataLen = _output.getDataLen();
             int64_t oldSpaceAllocated = _output.getSpaceUsed();
-            _streamer->encode(packet, &_output);
+            const char *body = NULL;
+            size_t bodyLen = 0;
+            bool zeroCopy = _zeroCopyThreshold > 0 && packet->getZeroCopyBody(body, bodyLen) &&
+                            (int64_t)bodyLen >= _zeroCopyThreshold &&
+                            _streamer->encodeHeader(packet, &_output, bodyLen);
+            if (!zeroCopy) {
+                _streamer->encode(packet, &_output);
+                bodyLen = 0;
+            }
             int64_t newDataLen = _output.getDataLen();
             int64_t newSpaceAllocated = _output.getSpaceUsed();
             int64_t packetSizeInBuffer = newDataLen - oldDataLen;
-            if (packetSizeInBuffer > _maxSendPacketSize) {
-                _maxSendPacketSize = packetSizeInBuffer;
+            if (packetSizeInBuffer + (int64_t)bodyLen > _maxSendPacketSize) {
+                _maxSendPacketSize = packetSizeInBuffer + bodyLen;
             }
             addOutputBufferSpaceAllocated(newSpaceAllocated - oldSpaceAllocated);
             ANET_ADD_OUTPUT_BUFFER_SPACE_USED(packetSizeInBuffer);
+            ANET_COUNT_DATA_COPY(packetSizeInBuffer);
             Channel *channel = packet->getChannel();
             if (channel) {
                 if (_defaultPacketHandler == NULL && channel->getHandler() == NULL) {
@@ -113,29 +202,38 @@ bool TCPConnection::writeData() {
                 }
             }
             updateQueueStatus(packet, false);
-            packet->invokeDequeueCB();
-            packet->free();
+            if (zeroCopy) {
+                // packet is freed after its body is written
+                _zeroCopyBodies.push_back({packet, body, (int64_t)bodyLen, newDataLen});
+                _zeroCopyPendingLen += bodyLen;
+            } else {
+                packet->invokeDequeueCB();
+                packet->free();
+            }
 
             ANET_COUNT_PACKET_WRITE(1);
         }
 
-        if (_output.getDataLen() == 0) {
+        if (getPendingWriteLen() == 0) {
             break;
         }
 
         // write data
-        ret = _socket->write(_output.getData(), _output.getDataLen());
+        if (_zeroCopyBodies.empty()) {
+            ret = _socket->write(_output.getData(), _output.getDataLen());
+        } else {
+            ret = writeZeroCopyData();
+        }
         if (ret > 0) {
-            _output.drainData(ret);
+            drainWrittenData(ret);
             _stats.totalTxBytes += ret;
-            ANET_ADD_OUTPUT_BUFFER_SPACE_USED(0 - ret);
         } else {
             error = _socket->getSoError();
         }
 
         writeCnt++;
     } while (ret > 0 &&
-             _output.getDataLen() == 0
+             getPendingWriteLen() == 0
              /**@todo remove magic number 10*/
              && myQueueSize > 0 && writeCnt < 10);
     _stats.callWriteCount += writeCnt;
@@ -150,7 +248,7 @@ bool TCPConnection::writeData() {
         clearOutputBuffer();
         return false;
     }
-    int queueSize = _outputQueue.size() + (_output.getDataLen() > 0 ? 1 : 0);
+    int queueSize = _outputQueue.size() + (getPendingWriteLen() > 0 ? 1 : 0);
     if (queueSize > 0) {
         // when using level triggered mode, do NOT need to call enableWrite() any more.
         //         ANET_LOG(DEBUG,"IOC(%p)->enableWrite(true)", _iocomponent);
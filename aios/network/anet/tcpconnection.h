@@ -15,6 +15,7 @@
  */
 #ifndef ANET_TCPCONNECTION_H_
 #define ANET_TCPCONNECTION_H_
+#include <deque>
 #include <stdint.h>
 
 #include "aios/network/anet/connection.h"
@@ -32,6 +33,10 @@ class Socket;
 class IPacketStreamer;
 class IServerAdapter;
 
+/* packets whose body is larger than this are written with writev() */
+#define ZERO_COPY_THRESHOLD 65536
+#define ZERO_COPY_MAX_IOV 64
+
 class TCPConnection : public Connection {
     friend class TCPConnectionTest_testWriteData_Test;
 
@@ -117,6 +122,23 @@ public:
         return ret;
     }
 
+protected:
+    /*
+     * body of a packet written directly from packet memory, it is sent
+     * after the first outputOffset bytes of _output.
+     */
+    struct ZeroCopyBody {
+        Packet *packet;
+        const char *data;
+        int64_t len;
+        int64_t outputOffset;
+    };
+
+    int64_t getPendingWriteLen();
+    int writeZeroCopyData();
+    void drainWrittenData(int64_t len);
+    void clearZeroCopyBody();
+
 protected:
     DataBuffer _output;         // 输出的buffer
     DataBuffer _input;          // 读入的buffer
@@ -133,6 +155,10 @@ protected:
      */
     int64_t _maxRecvPacketSize;
     int64_t _maxSendPacketSize;
+
+    std::deque<ZeroCopyBody> _zeroCopyBodies; // bodies waiting to be written
+    int64_t _zeroCopyPendingLen;
+    int64_t _zeroCopyThreshold; // <= 0 means zero copy write disabled
 };
 
 } // namespace anet
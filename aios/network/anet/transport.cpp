@@ -18,6 +18,7 @@
 #include <assert.h>
 #include <list>
 #include <ostream>
+#include <sched.h>
 #include <signal.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -40,6 +41,7 @@
 #include "aios/network/anet/threadmutex.h"
 #include "aios/network/anet/timeutil.h"
 #include "aios/network/anet/transportlist.h"
+#include "autil/EnvUtil.h"
 
 namespace anet {
 class Connection;
@@ -88,9 +90,13 @@ Transport::Transport(int ioThreadNum, ListenFdThreadModeEnum mode) : _listenFdTh
 
 void Transport::initialize() {
     _ioWorkers = new IoWorker[_ioThreadNum + _listenThreadNum];
+    for (int k = 0; k < _ioThreadNum + _listenThreadNum; ++k) {
+        _ioWorkers[k].setIndex(k);
+    }
     _stop = false;
     _started = false;
     _promotePriority = false;
+    _bindCpu = autil::EnvUtil::getEnv("ANET_IO_WORKER_BIND_CPU", false);
     _nextCheckTime = 0;
     _timeoutLoopInterval = 100000; // default 100ms
     /* Register the object into the global list. */
@@ -116,6 +122,9 @@ bool Transport::start(bool promotePriority) {
     _started = true;
     _promotePriority = promotePriority;
     signal(SIGPIPE, SIG_IGN);
+    if (_bindCpu) {
+        bindIoWorkerCpu();
+    }
     for (int k = 0; k < _ioThreadNum + _listenThreadNum; ++k) {
         _ioWorkers[k].start(_promotePriority);
     }
@@ -123,6 +132,27 @@ bool Transport::start(bool promotePriority) {
     return true;
 }
 
+void Transport::bindIoWorkerCpu() {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if (sched_getaffinity(0, sizeof(cpuSet), &cpuSet) != 0) {
+        ANET_LOG(WARN, "get cpu affinity failed, io workers not bound");
+        return;
+    }
+    vector<int> cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &cpuSet)) {
+            cpus.push_back(cpu);
+        }
+    }
+    if (cpus.empty()) {
+        return;
+    }
+    for (int k = 0; k < _ioThreadNum + _listenThreadNum; ++k) {
+        _ioWorkers[k].setCpuAffinity(cpus[k % cpus.size()]);
+    }
+}
+
 /**
  * set stop flag for read/write thread and timeout checking thread.
  *
@@ -261,6 +291,10 @@ IOComponent *Transport::listen(const char *spec,
         return NULL;
     }
 
+    if (_listenFdThreadMode == REUSEPORT_LISTEN_THREAD) {
+        return listenReusePort(spec, streamer, serverAdapter, postPacketTimeout, maxIdleTime, backlog);
+    }
+
     // Server Socket
     Socket *socket = new Socket();
     DBGASSERT(socket);
@@ -283,6 +317,68 @@ IOComponent *Transport::listen(const char *spec,
     return NULL;
 }
 
+IOComponent *Transport::listenReusePort(const char *spec,
+                                        IPacketStreamer *streamer,
+                                        IServerAdapter *serverAdapter,
+                                        int postPacketTimeout,
+                                        int maxIdleTime,
+                                        int backlog) {
+    TCPAcceptor *acceptor =
+        createReusePortAcceptor(spec, 0, streamer, serverAdapter, postPacketTimeout, maxIdleTime, backlog);
+    if (NULL == acceptor) {
+        return NULL;
+    }
+    // other acceptors must bind the real port in case of listening on port 0
+    string shardSpec(spec);
+    size_t sep = shardSpec.rfind(':');
+    int port = acceptor->getSocket()->getPort(true);
+    if (sep == string::npos || port <= 0) {
+        ANET_LOG(WARN, "can not get listen port of [%s], only one acceptor created", spec);
+        return acceptor;
+    }
+    shardSpec = shardSpec.substr(0, sep + 1) + std::to_string(port);
+    for (int k = 1; k < _ioThreadNum; ++k) {
+        TCPAcceptor *shard = createReusePortAcceptor(
+            shardSpec.c_str(), k, streamer, serverAdapter, postPacketTimeout, maxIdleTime, backlog);
+        if (NULL == shard) {
+            ANET_LOG(WARN, "create acceptor %d for [%s] failed", k, shardSpec.c_str());
+            break;
+        }
+        acceptor->addShard(shard);
+    }
+    return acceptor;
+}
+
+TCPAcceptor *Transport::createReusePortAcceptor(const char *spec,
+                                                int workerIndex,
+                                                IPacketStreamer *streamer,
+                                                IServerAdapter *serverAdapter,
+                                                int postPacketTimeout,
+                                                int maxIdleTime,
+                                                int backlog) {
+    Socket *socket = new Socket();
+    DBGASSERT(socket);
+    if (!socket->setAddrSpec(spec) || socket->getProtocolType() != (int)SOCK_STREAM) {
+        ANET_LOG(WARN, "invalid tcp spec %s", spec);
+        delete socket;
+        return NULL;
+    }
+    if (socket->getProtocolFamily() != AF_UNIX && !socket->setReusePort(true)) {
+        ANET_LOG(WARN, "set reuse port failed, spec %s", spec);
+        delete socket;
+        return NULL;
+    }
+    TCPAcceptor *acceptor =
+        new TCPAcceptor(this, socket, streamer, serverAdapter, postPacketTimeout, maxIdleTime, backlog);
+    DBGASSERT(acceptor);
+    acceptor->setBelongedWorkerIndex(workerIndex);
+    if (!acceptor->init()) {
+        delete acceptor;
+        return NULL;
+    }
+    return acceptor;
+}
+
 Connection *Transport::connect(const char *spec, IPacketStreamer *streamer, bool autoReconn, CONNPRIORITY prio) {
     return doConnect(NULL, spec, streamer, autoReconn, prio);
 }
@@ -308,6 +404,11 @@ int Transport::getChunkId(const IOComponent *ioc) const {
         return 0;
     }
 
+    int index = ioc->getBelongedWorkerIndex();
+    if (index >= 0) {
+        return index % (_ioThreadNum + _listenThreadNum);
+    }
+
     if (_listenFdThreadMode == EXCLUSIVE_LISTEN_THREAD) {
         assert(_listenThreadNum > 0);
         IOComponent *pioc = const_cast<IOComponent *>(ioc);
@@ -329,6 +430,14 @@ void Transport::dump(ostringstream &buf) {
     buf << "\tTimeout interval: " << _timeoutLoopInterval << "us\t"
         << "Next check: " << _nextCheckTime << "-" << timestr << endl;
 
+    vector<IoWorkerStat> ioWorkerStats;
+    getIoWorkerStats(ioWorkerStats);
+    for (const auto &stat : ioWorkerStats) {
+        buf << "\tIO worker " << stat.index << "\tcpu: " << stat.cpu << "\tloops: " << stat.loopCount
+            << "\tevents: " << stat.eventCount << "\taccepted: " << stat.acceptCount
+            << "\tcomponents: " << stat.componentCount << endl;
+    }
+
     for (int k = 0; k < _ioThreadNum + _listenThreadNum; ++k) {
         totalIOC += _ioWorkers[k].dump(buf);
     }
@@ -420,6 +529,12 @@ void Transport::getTcpConnStats(vector<ConnStat> &connStats) {
     }
 }
 
+void Transport::getIoWorkerStats(vector<IoWorkerStat> &ioWorkerStats) {
+    for (int k = 0; k < _ioThreadNum + _listenThreadNum; ++k) {
+        ioWorkerStats.push_back(_ioWorkers[k].getStat());
+    }
+}
+
 bool Transport::bindLocalAddress(Socket *socket, const char *localAddr) {
     char ipStr[512];
     ipStr[0] = '\0';
@@ -39,6 +39,8 @@
 namespace anet {
 
 class IoWorker;
+class TCPAcceptor;
+struct IoWorkerStat;
 
 /**
  * This class controls behavior of ANET. There are two work modes:
@@ -53,6 +55,9 @@ class IoWorker;
 enum ListenFdThreadModeEnum {
     SHARE_THREAD, // default: share thread with normal fd
     EXCLUSIVE_LISTEN_THREAD,
+    // every io thread listens on its own SO_REUSEPORT socket and
+    // handles all connections accepted by it
+    REUSEPORT_LISTEN_THREAD,
 };
 
 class Transport : public Runnable, public ITransport {
@@ -240,6 +245,14 @@ public:
      */
     IoWorker *getBelongedWorker(const IOComponent *ioc);
     virtual void getTcpConnStats(std::vector<ConnStat> &connStats);
+    void getIoWorkerStats(std::vector<IoWorkerStat> &ioWorkerStats);
+
+    /**
+     * bind io threads to cpus allowed for this process one by one,
+     * should be called before start(). Also enabled by env
+     * ANET_IO_WORKER_BIND_CPU=true
+     */
+    void setBindCpu(bool bindCpu) { _bindCpu = bindCpu; }
 
     void setName(const std::string &name);
     const std::string &getName() const { return _name; }
@@ -266,6 +279,25 @@ protected:
 
 private:
     void initialize();
+    void bindIoWorkerCpu();
+
+    /**
+     * listen on spec with one SO_REUSEPORT acceptor per io thread, acceptors
+     * except the first one are owned by the first one.
+     */
+    IOComponent *listenReusePort(const char *spec,
+                                 IPacketStreamer *streamer,
+                                 IServerAdapter *serverAdapter,
+                                 int postPacketTimeout,
+                                 int maxIdleTime,
+                                 int backlog);
+    TCPAcceptor *createReusePortAcceptor(const char *spec,
+                                         int workerIndex,
+                                         IPacketStreamer *streamer,
+                                         IServerAdapter *serverAdapter,
+                                         int postPacketTimeout,
+                                         int maxIdleTime,
+                                         int backlog);
 
     /**
      * getChunkId determines which IoWorker instance is response for handling
@@ -288,6 +320,7 @@ private:
     bool _stop; // stopping flag
     bool _started;
     bool _promotePriority;
+    bool _bindCpu;
     int64_t _nextCheckTime;
     int64_t _timeoutLoopInterval;
 
@@ -86,6 +86,22 @@ constexpr int32_t DEFAULT_HEARTBEAT_UNHEALTH_INTERVAL = 20 * 1000; // 20s
 constexpr int32_t DEFAULT_RETRY_LIMIT_PER_SECOND = -1; // no limit
 constexpr int32_t DEFAULT_LATENCY_TIME_WINDOW_SIZE = 0;
 
+constexpr float DEFAULT_HEDGE_BUDGET_PERCENT = 0.05f;
+constexpr int64_t HEDGE_BUDGET_CAPACITY = 100;          // max hedge tokens saved per biz
+constexpr int64_t HEDGE_LATENCY_SAMPLE_COUNT = 256;     // latency samples kept per biz
+constexpr int64_t HEDGE_MIN_LATENCY_SAMPLE_COUNT = 32;  // samples needed before hedging
+
+// adaptive concurrency limit of provider
+constexpr float CONCURRENCY_LIMIT_INITIAL = 20.0f;
+constexpr float CONCURRENCY_LIMIT_MIN = 2.0f;
+constexpr float CONCURRENCY_LIMIT_MAX = 1000.0f;
+constexpr float CONCURRENCY_LIMIT_SMOOTHING = 0.2f;
+constexpr float CONCURRENCY_LIMIT_BACKOFF_RATIO = 0.9f;
+constexpr float CONCURRENCY_RTT_TOLERANCE = 2.0f;
+constexpr float CONCURRENCY_RTT_SMOOTHING = 0.1f;
+constexpr float CONCURRENCY_MIN_RTT_DRIFT = 0.001f;
+constexpr float CONCURRENCY_MIN_GRADIENT = 0.5f;
+
 struct ControllerParam {
 public:
     static void logParam();
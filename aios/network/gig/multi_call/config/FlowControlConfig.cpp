@@ -28,6 +28,8 @@ void FlowControlConfig::validate() {
     etTriggerPercent = getValidPercent(etTriggerPercent, "et percent");
     retryTriggerPercent = getValidPercent(retryTriggerPercent, "retry percent");
     latencyTimeWindowSize = getValidInteger(latencyTimeWindowSize, "window_size");
+    hedgeLatencyPercentile = getValidPercent(hedgeLatencyPercentile, "hedge latency percentile");
+    hedgeBudgetPercent = getValidPercent(hedgeBudgetPercent, "hedge budget percent");
     if (beginServerDegradeLatency > beginDegradeLatency) {
         AUTIL_LOG(ERROR,
                   "beginServerDegradeLatency [%u] is great than "
@@ -71,6 +73,10 @@ bool FlowControlConfig::operator==(const FlowControlConfig &rhs) const {
            etTriggerPercent == rhs.etTriggerPercent && etWaitTimeFactor == rhs.etWaitTimeFactor &&
            etMinWaitTime == rhs.etMinWaitTime && retryTriggerPercent == rhs.retryTriggerPercent &&
            retryWaitTimeFactor == rhs.retryWaitTimeFactor &&
+           hedgeLatencyPercentile == rhs.hedgeLatencyPercentile &&
+           hedgeMinWaitTime == rhs.hedgeMinWaitTime &&
+           hedgeBudgetPercent == rhs.hedgeBudgetPercent &&
+           concurrencyLimitEnabled == rhs.concurrencyLimitEnabled &&
            beginServerDegradeErrorRatio == rhs.beginServerDegradeErrorRatio &&
            beginDegradeErrorRatio == rhs.beginDegradeErrorRatio &&
            fullDegradeErrorRatio == rhs.fullDegradeErrorRatio;
@@ -42,6 +42,10 @@ public:
         , retryMinProviderWeight(0)
         , retryLimitPerSecond(DEFAULT_RETRY_LIMIT_PER_SECOND)
         , latencyTimeWindowSize(DEFAULT_LATENCY_TIME_WINDOW_SIZE)
+        , hedgeLatencyPercentile(MAX_PERCENT)
+        , hedgeMinWaitTime(0)
+        , hedgeBudgetPercent(DEFAULT_HEDGE_BUDGET_PERCENT)
+        , concurrencyLimitEnabled(false)
         , beginServerDegradeErrorRatio(MAX_PERCENT)
         , beginDegradeErrorRatio(MAX_PERCENT)
         , fullDegradeErrorRatio(MAX_PERCENT)
@@ -72,6 +76,12 @@ public:
         json.Jsonize("retry_limit_per_second", retryLimitPerSecond, retryLimitPerSecond);
         json.Jsonize("latency_time_window_size", latencyTimeWindowSize, latencyTimeWindowSize);
 
+        json.Jsonize("hedge_latency_percentile", hedgeLatencyPercentile, hedgeLatencyPercentile);
+        json.Jsonize("hedge_min_wait_time", hedgeMinWaitTime, hedgeMinWaitTime);
+        json.Jsonize("hedge_budget_percent", hedgeBudgetPercent, hedgeBudgetPercent);
+        json.Jsonize("concurrency_limit_enabled", concurrencyLimitEnabled,
+                     concurrencyLimitEnabled);
+
         json.Jsonize("full_degrade_error_ratio", fullDegradeErrorRatio, fullDegradeErrorRatio);
         json.Jsonize("begin_degrade_error_ratio", beginDegradeErrorRatio, fullDegradeErrorRatio);
         json.Jsonize("begin_server_degrade_error_ratio", beginServerDegradeErrorRatio,
@@ -98,6 +108,9 @@ public:
     bool singleRetryEnabled() const {
         return latencyTimeWindowSize > DEFAULT_LATENCY_TIME_WINDOW_SIZE;
     }
+    bool hedgeEnabled() const {
+        return MAX_PERCENT != hedgeLatencyPercentile;
+    }
     FlowControlConfig *clone();
     void validate();
     bool operator==(const FlowControlConfig &rhs) const;
@@ -122,6 +135,15 @@ public:
     int32_t retryLimitPerSecond;
     int32_t latencyTimeWindowSize;
 
+    // send a backup request to another replica once the primary has been
+    // outstanding longer than this percentile of the biz's recent latency
+    float hedgeLatencyPercentile;
+    uint32_t hedgeMinWaitTime; // ms
+    // extra requests allowed by hedging, as a fraction of normal requests
+    float hedgeBudgetPercent;
+    // skip providers whose in-flight requests reach their adaptive limit
+    bool concurrencyLimitEnabled;
+
     float beginServerDegradeErrorRatio;
     float beginDegradeErrorRatio;
     float fullDegradeErrorRatio;
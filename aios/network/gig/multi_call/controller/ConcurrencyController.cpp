@@ -0,0 +1,74 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "aios/network/gig/multi_call/controller/ConcurrencyController.h"
+
+#include <math.h>
+
+using namespace std;
+
+namespace multi_call {
+AUTIL_LOG_SETUP(multi_call, ConcurrencyController);
+
+ConcurrencyController::ConcurrencyController()
+    : _inflight(0)
+    , _limit(CONCURRENCY_LIMIT_INITIAL)
+    , _minRtt(INVALID_FILTER_VALUE)
+    , _rtt(INVALID_FILTER_VALUE) {
+}
+
+void ConcurrencyController::update(ControllerFeedBack &feedBack) {
+    auto inflight = _inflight.fetch_sub(1, std::memory_order_relaxed);
+    if (!feedBack.concurrencyLimitEnabled) {
+        // only track inflight, the limit is not read
+        return;
+    }
+    const auto &stat = feedBack.stat;
+    autil::ScopedSpinLock scopeLock(_lock);
+    float limit = _limit;
+    if (stat.isFailed()) {
+        if (MULTI_CALL_REPLY_ERROR_TIMEOUT == stat.ec) {
+            limit *= CONCURRENCY_LIMIT_BACKOFF_RATIO;
+            _limit = max(limit, CONCURRENCY_LIMIT_MIN);
+        }
+        return;
+    }
+    float rtt = stat.getRpcLatency();
+    if (INVALID_FILTER_VALUE == _rtt) {
+        _rtt = rtt;
+    } else {
+        _rtt += (rtt - _rtt) * CONCURRENCY_RTT_SMOOTHING;
+    }
+    if (rtt < _minRtt) {
+        _minRtt = rtt;
+    } else {
+        // let min rtt follow a permanent latency shift slowly
+        _minRtt += (_rtt - _minRtt) * CONCURRENCY_MIN_RTT_DRIFT;
+    }
+    if (_rtt <= 0.0f) {
+        return;
+    }
+    auto gradient = CONCURRENCY_RTT_TOLERANCE * _minRtt / _rtt;
+    gradient = max(CONCURRENCY_MIN_GRADIENT, min(1.0f, gradient));
+    auto newLimit = limit * gradient + sqrtf(limit);
+    if (newLimit > limit && inflight < limit / 2) {
+        // app limited, do not grow limit without load
+        return;
+    }
+    limit += (newLimit - limit) * CONCURRENCY_LIMIT_SMOOTHING;
+    _limit = max(CONCURRENCY_LIMIT_MIN, min(CONCURRENCY_LIMIT_MAX, limit));
+}
+
+} // namespace multi_call
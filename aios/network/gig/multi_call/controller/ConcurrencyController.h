@@ -0,0 +1,83 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ISEARCH_MULTI_CALL_CONCURRENCYCONTROLLER_H
+#define ISEARCH_MULTI_CALL_CONCURRENCYCONTROLLER_H
+
+#include <atomic>
+
+#include "aios/network/gig/multi_call/controller/ControllerFeedBack.h"
+#include "autil/Lock.h"
+
+namespace multi_call {
+
+// adaptive in-flight request limit of one provider, the limit follows
+// the gradient between min rtt and current rtt:
+//   limit = limit * clamp(tolerance * minRtt / rtt) + sqrt(limit)
+// and backs off multiplicatively on timeout
+class ConcurrencyController
+{
+public:
+    ConcurrencyController();
+    ~ConcurrencyController() {
+    }
+
+private:
+    ConcurrencyController(const ConcurrencyController &);
+    ConcurrencyController &operator=(const ConcurrencyController &);
+
+public:
+    void onRequest() {
+        _inflight.fetch_add(1, std::memory_order_relaxed);
+    }
+    void update(ControllerFeedBack &feedBack);
+    bool isSaturated() const {
+        return _inflight.load(std::memory_order_relaxed) >= (int64_t)_limit;
+    }
+    int64_t inflight() const {
+        return _inflight.load(std::memory_order_relaxed);
+    }
+    float limit() const {
+        return _limit;
+    }
+    float minRtt() const {
+        return _minRtt;
+    }
+    float rtt() const {
+        return _rtt;
+    }
+
+private:
+    // for ut
+    void setLimit(float limit) {
+        _limit = limit;
+    }
+
+private:
+    std::atomic<int64_t> _inflight;
+    volatile float _limit;
+    float _minRtt; // us
+    float _rtt;    // us
+    autil::SpinLock _lock;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+MULTI_CALL_TYPEDEF_PTR(ConcurrencyController);
+
+} // namespace multi_call
+
+#endif // ISEARCH_MULTI_CALL_CONCURRENCYCONTROLLER_H
@@ -91,6 +91,10 @@ void ControllerChain::toString(std::string &ret) const {
     ret += StringUtil::toString(errorRatioController.count());
     ret += ", hasServer: ";
     ret += StringUtil::toString(latencyController.hasServerAgent());
+    ret += ", inflight: ";
+    ret += StringUtil::toString(concurrencyController.inflight());
+    ret += "/";
+    ret += StringUtil::fToString(concurrencyController.limit());
 }
 
 float ControllerChain::trimSmall(float value) {
@@ -16,6 +16,7 @@
 #ifndef ISEARCH_MULTI_CALL_CONTROLLERCHAIN_H
 #define ISEARCH_MULTI_CALL_CONTROLLERCHAIN_H
 
+#include "aios/network/gig/multi_call/controller/ConcurrencyController.h"
 #include "aios/network/gig/multi_call/controller/DegradeRatioController.h"
 #include "aios/network/gig/multi_call/controller/ErrorController.h"
 #include "aios/network/gig/multi_call/controller/ErrorRatioController.h"
@@ -38,6 +39,7 @@ public:
     ErrorRatioController errorRatioController;
     ErrorController errorController;
     WarmUpController warmUpController;
+    ConcurrencyController concurrencyController;
     volatile WeightTy targetWeight;
 };
 
@@ -55,7 +55,8 @@ struct ControllerFeedBack {
         , maxWeight(MAX_WEIGHT_FLOAT)
         , minWeight(MIN_WEIGHT_FLOAT)
         , bestLoadBalanceLatency(INVALID_FILTER_VALUE)
-        , bestLoadBalanceDegradeRatio(INVALID_FILTER_VALUE) {
+        , bestLoadBalanceDegradeRatio(INVALID_FILTER_VALUE)
+        , concurrencyLimitEnabled(false) {
     }
     ControllerFeedBack &operator=(const ControllerFeedBack &) = delete;
 
@@ -66,7 +67,8 @@ private:
                bestChain == rhs.bestChain && metricLimits == rhs.metricLimits &&
                maxWeight == rhs.maxWeight && minWeight == rhs.minWeight &&
                bestLoadBalanceLatency == rhs.bestLoadBalanceLatency &&
-               bestLoadBalanceDegradeRatio == rhs.bestLoadBalanceDegradeRatio;
+               bestLoadBalanceDegradeRatio == rhs.bestLoadBalanceDegradeRatio &&
+               concurrencyLimitEnabled == rhs.concurrencyLimitEnabled;
     }
 
 public:
@@ -78,6 +80,7 @@ public:
     float minWeight;
     float bestLoadBalanceLatency;
     float bestLoadBalanceDegradeRatio;
+    bool concurrencyLimitEnabled;
 };
 
 } // namespace multi_call
@@ -110,6 +110,14 @@ void BizMapMetricReporter::reportReplyInfo(const ReplyInfoCollector &replyInfo)
             bizReporter->reportRetryQueryQps(1.0);
             bizReporter->reportRetryQueryTriggerLatency(retryInfo.latency / FACTOR_US_TO_MS);
         }
+        if (retryInfo.isHedge) {
+            bizReporter->reportHedgeQueryQps(1.0);
+            if (retryInfo.hedgeWinNum != 0) {
+                bizReporter->reportHedgeWinQps(1.0);
+                bizReporter->reportHedgeSavedLatency(retryInfo.hedgeSavedLatency /
+                                                     FACTOR_US_TO_MS);
+            }
+        }
         if (replyBizInfo.probeCallNum != 0) {
             bizReporter->reportProbeCallQps(replyBizInfo.probeCallNum);
         }
@@ -63,6 +63,9 @@ private:
     DECLARE_METRIC(EarlyTerminatorTriggerLatency);
     DECLARE_METRIC(RetryQueryQps);
     DECLARE_METRIC(RetryQueryTriggerLatency);
+    DECLARE_METRIC(HedgeQueryQps);
+    DECLARE_METRIC(HedgeWinQps);
+    DECLARE_METRIC(HedgeSavedLatency);
 
     DECLARE_METRIC(ProbeCallQps);
     DECLARE_METRIC(CopyCallQps);
@@ -116,6 +116,19 @@ void ReplyInfoCollector::addRetrySuccessNum(const string &bizName) {
     }
 }
 
+void ReplyInfoCollector::addHedgeWin(const string &bizName, int64_t savedLatency) {
+    ReplyBizInfoMap::iterator iter = _replyBizInfoMap.find(bizName);
+    if (iter != _replyBizInfoMap.end()) {
+        auto &retryInfo = iter->second.retryInfo;
+        retryInfo.hedgeWinNum++;
+        if (retryInfo.hedgeSavedLatency < savedLatency) {
+            retryInfo.hedgeSavedLatency = savedLatency;
+        }
+    } else {
+        AUTIL_LOG(WARN, "unknown biz name [%s]", bizName.c_str());
+    }
+}
+
 void ReplyInfoCollector::setBizLatency(const string &bizName, int64_t latency, int64_t rpcLatency,
                                        float netLatency) {
     ReplyBizInfoMap::iterator iter = _replyBizInfoMap.find(bizName);
@@ -31,12 +31,22 @@ struct EtInfo {
 };
 
 struct RetryInfo {
-    RetryInfo() : isRetry(false), latency(0), retryCallNum(0), retrySuccNum(0) {
+    RetryInfo()
+        : isRetry(false)
+        , isHedge(false)
+        , latency(0)
+        , retryCallNum(0)
+        , retrySuccNum(0)
+        , hedgeWinNum(0)
+        , hedgeSavedLatency(0) {
     }
     bool isRetry;
+    bool isHedge;
     double latency;
     uint32_t retryCallNum;
     uint32_t retrySuccNum;
+    uint32_t hedgeWinNum;
+    int64_t hedgeSavedLatency; // max saved latency of won hedge requests
 };
 
 struct BizSizeInfo {
@@ -97,6 +107,7 @@ public:
     void addCopyCallNum(const std::string &bizName, uint32_t count);
     void addRetryCallNum(const std::string &bizName);
     void addRetrySuccessNum(const std::string &bizName);
+    void addHedgeWin(const std::string &bizName, int64_t savedLatency);
     void setBizLatency(const std::string &bizName, int64_t latency, int64_t rpcLatency,
                        float netLatency);
     void addFailRequestCount(const std::string &bizName, uint32_t errorCount,
@@ -55,6 +55,7 @@ void CallDelegationStatistic::collectStatistic(const string &bizName, size_t pro
     bool etEnabled = flowControlConfig->etEnabled();
     bizStatistic.needRetry = !disableRetry && flowControlConfig->retryEnabled();
     bizStatistic.needSingleRetry = !disableRetry && flowControlConfig->singleRetryEnabled();
+    bizStatistic.needHedge = !disableRetry && flowControlConfig->hedgeEnabled();
     uint32_t etThreshold = bizStatistic.expectNum;
     uint32_t retryThreshold = bizStatistic.expectNum;
 
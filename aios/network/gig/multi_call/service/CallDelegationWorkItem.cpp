@@ -43,7 +43,8 @@ bool CallDelegationWorkItem::process(int64_t currentTime,
         return true;
     }
     const auto &reply = _caller->getReply();
-    if (!reply->needDetection(currentTime) && !reply->singleRetryEnabled()) {
+    if (!reply->needDetection(currentTime) && !reply->singleRetryEnabled() &&
+        !reply->hedgeEnabled()) {
         return false;
     }
     if (reply->needDetection(currentTime) && reply->shouldEt(currentTime)) {
@@ -66,6 +67,7 @@ bool CallDelegationWorkItem::process(int64_t currentTime,
             retryInfo.latency = latency;
             AUTIL_INTERVAL_LOG(50, INFO, "query is retried, retry latency is %f us", latency);
             for (const auto &info : retryBizInfos) {
+                retryInfo.isHedge = reply->isHedged(info.first);
                 reply->getReplyInfoCollector()->setRetryInfo(info.first, retryInfo);
             }
         }
@@ -42,6 +42,7 @@ ChildNodeCaller::ChildNodeCaller(const SearchServiceSnapshotPtr &snapshot,
     , _earlyTerminationEnabled(false)
     , _retryEnabled(false)
     , _singleRetryEnable(false)
+    , _hedgeEnable(false)
     , _canRetry(false) {
     _callBeginTime = autil::TimeUtility::currentTime();
 }
@@ -125,8 +126,9 @@ void ChildNodeCaller::initCaller() {
     _reply.reset(new ChildNodeReply(_flowConfigSnapshot, _replyInfoCollector, _retryLimitChecker,
                                     _latencyTimeSnapshot));
     _flowConfigSnapshot->getFlowControlSwitch(flowControlStrategyVec, _earlyTerminationEnabled,
-                                              _retryEnabled, _singleRetryEnable);
+                                              _retryEnabled, _singleRetryEnable, _hedgeEnable);
     _reply->setSingleRetryEnabled(_singleRetryEnable);
+    _reply->setHedgeEnabled(_hedgeEnable);
     if (isDetectionOn()) {
         _reply->prepareCallDelegationStatistic(bizNameVec, flowControlStrategyVec);
     }
@@ -164,7 +166,7 @@ bool ChildNodeCaller::isDetectionOn() const {
 }
 
 bool ChildNodeCaller::isRetryOn() const {
-    return _canRetry && (_retryEnabled || _singleRetryEnable);
+    return _canRetry && (_retryEnabled || _singleRetryEnable || _hedgeEnable);
 }
 
 const CallerPtr &ChildNodeCaller::getCaller() const {
@@ -37,7 +37,8 @@ ChildNodeReply::ChildNodeReply(const FlowConfigSnapshotPtr &flowConfigSnapshot,
     , _callDelegationStatPrepared(false)
     , _etTime(numeric_limits<int64_t>::max())
     , _startDetectionTime(numeric_limits<int64_t>::max())
-    , _singleRetryEnabled(false) {
+    , _singleRetryEnabled(false)
+    , _hedgeEnabled(false) {
     assert(_replyInfoCollector);
     _startTime = TimeUtility::currentTime();
 }
@@ -54,19 +55,21 @@ void ChildNodeReply::endStreamQuery() {
     for (const auto &searchResourcePtr : _searchResourceVec) {
         assert(searchResourcePtr->isNormalRequest());
         bool singleRetryEnabled = searchResourcePtr->singleRetryEnabled();
+        bool hedgeEnabled = searchResourcePtr->hedgeEnabled();
         const string &bizName = searchResourcePtr->getBizName();
         auto request = searchResourcePtr->getRequest();
         if (request) {
             _replyInfoCollector->addRequestSize(bizName, request->size());
         }
+        collectHedgeInfo(searchResourcePtr);
         auto response = searchResourcePtr->getReturnedResponse();
         if (response) {
             _replyInfoCollector->setBizLatency(bizName, response->callUsedTime(),
                                                response->rpcUsedTime(), response->netLatency());
             _replyInfoCollector->addResponseSize(bizName, response->size());
 
-            if (singleRetryEnabled && !response->isFailed()) {
-                _latencyTimeSnapshot->pushLatency(bizName, response->rpcUsedTime());
+            if ((singleRetryEnabled || hedgeEnabled) && !response->isFailed()) {
+                _latencyTimeSnapshot->pushLatency(bizName, response->rpcUsedTime(), hedgeEnabled);
             }
 
             // statistic error or timeout request
@@ -89,12 +92,14 @@ size_t ChildNodeReply::fillResponses(std::vector<ResponsePtr> &responseVec,
     for (const auto &searchResourcePtr : _searchResourceVec) {
         assert(searchResourcePtr->isNormalRequest());
         bool singleRetryEnabled = searchResourcePtr->singleRetryEnabled();
+        bool hedgeEnabled = searchResourcePtr->hedgeEnabled();
         const string &bizName = searchResourcePtr->getBizName();
         auto request = searchResourcePtr->getRequest();
         if (request) {
             _replyInfoCollector->addRequestSize(bizName, request->size());
         }
         searchResourcePtr->freeRequest();
+        collectHedgeInfo(searchResourcePtr);
         auto response = searchResourcePtr->stealReturnedResponse();
         if (response) {
             responseVec.push_back(response);
@@ -102,8 +107,8 @@ size_t ChildNodeReply::fillResponses(std::vector<ResponsePtr> &responseVec,
                                                response->rpcUsedTime(), response->netLatency());
             _replyInfoCollector->addResponseSize(bizName, response->size());
 
-            if (singleRetryEnabled && !response->isFailed()) {
-                _latencyTimeSnapshot->pushLatency(bizName, response->callUsedTime());
+            if ((singleRetryEnabled || hedgeEnabled) && !response->isFailed()) {
+                _latencyTimeSnapshot->pushLatency(bizName, response->callUsedTime(), hedgeEnabled);
             }
 
             // statistic error or timeout request
@@ -243,6 +248,10 @@ bool ChildNodeReply::collectStatistic(const string &bizName, size_t providerCoun
     }
     _callDelegationStatistic.collectStatistic(bizName, providerCount, flowControlConfig,
                                               disableRetry);
+    if (!disableRetry && flowControlConfig->hedgeEnabled()) {
+        _retryLimitChecker->depositHedgeBudget(bizName, providerCount,
+                                               flowControlConfig->hedgeBudgetPercent);
+    }
     return true;
 }
 
@@ -271,6 +280,14 @@ void ChildNodeReply::getRetryBizs(int64_t currentTime, map<string, int32_t> &ret
         if (0 == stat.expectNum) {
             continue;
         }
+        if (!clusterRsp.hedged && _callDelegationStatistic.isHedgeNeeded(stat) &&
+            needHedge(currentTime, bizName, clusterRsp)) {
+            auto configPtr = _flowConfigSnapshot->getFlowControlConfig(
+                clusterRsp.flowControlStrategy);
+            retryBizInfos[bizName] = configPtr->retryMinProviderWeight;
+            clusterRsp.hedged = true;
+            continue;
+        }
         int64_t latency = numeric_limits<int64_t>::max();
         if (1 == stat.expectNum) {
             if (_callDelegationStatistic.IsSingleResultNeedRetry(stat)) {
@@ -317,6 +334,92 @@ void ChildNodeReply::getRetryBizs(int64_t currentTime, map<string, int32_t> &ret
     }
 }
 
+/* hedged request: once the primary request of a biz has been outstanding for
+ * longer than the configured percentile of recent latencies, send a backup
+ * request to another replica, the first returned one wins and the other one
+ * is dropped when it arrives. extra load is bounded by a per biz token budget
+ * deposited as a percent of normal requests.
+ */
+bool ChildNodeReply::needHedge(int64_t currentTime, const string &bizName,
+                               ClusterResponse &clusterRsp) {
+    const auto &strategy = clusterRsp.flowControlStrategy;
+    auto configPtr = _flowConfigSnapshot->getFlowControlConfig(strategy);
+    if (!configPtr || !configPtr->hedgeEnabled()) {
+        return false;
+    }
+    if (clusterRsp.startHedgeTime < 0) {
+        int64_t latency =
+            _latencyTimeSnapshot->getPercentileLatency(bizName, configPtr->hedgeLatencyPercentile);
+        if (latency <= 0) {
+            // not enough latency samples
+            clusterRsp.startHedgeTime = numeric_limits<int64_t>::max();
+        } else {
+            clusterRsp.hedgeLatency = latency;
+            clusterRsp.startHedgeTime =
+                _startTime + max(latency, (int64_t)configPtr->hedgeMinWaitTime * 1000);
+        }
+    }
+    if (clusterRsp.startHedgeTime > currentTime) {
+        return false;
+    }
+    int64_t timeout = min(_etTime, _startTime + _rpcTimeout);
+    if (currentTime + clusterRsp.hedgeLatency > timeout) {
+        // backup request can not return in time
+        clusterRsp.startHedgeTime = numeric_limits<int64_t>::max();
+        return false;
+    }
+    size_t hedgeCount = getUnReturnedCount(bizName);
+    if (0 == hedgeCount) {
+        return false;
+    }
+    if (!_retryLimitChecker->canRetry(strategy, currentTime / FACTOR_S_TO_US,
+                                      configPtr->retryLimitPerSecond)) {
+        return false;
+    }
+    if (!_retryLimitChecker->acquireHedgeBudget(bizName, hedgeCount)) {
+        AUTIL_INTERVAL_LOG(200, INFO, "hedge budget exhausted for biz [%s], hedge count [%lu]",
+                           bizName.c_str(), hedgeCount);
+        clusterRsp.startHedgeTime = numeric_limits<int64_t>::max();
+        return false;
+    }
+    return true;
+}
+
+size_t ChildNodeReply::getUnReturnedCount(const string &bizName) const {
+    size_t count = 0;
+    for (const auto &resource : _searchResourceVec) {
+        if (resource->getBizName() != bizName || resource->hasRetried()) {
+            continue;
+        }
+        if (!resource->getResponse(false)->isReturned()) {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool ChildNodeReply::isHedged(const string &bizName) const {
+    auto it = _clusterResponseMap.find(bizName);
+    return _clusterResponseMap.end() != it && it->second.hedged && it->second.retried;
+}
+
+void ChildNodeReply::collectHedgeInfo(const SearchServiceResourcePtr &searchResourcePtr) {
+    const auto &bizName = searchResourcePtr->getBizName();
+    if (!searchResourcePtr->hasRetried() || !isHedged(bizName)) {
+        return;
+    }
+    auto primary = searchResourcePtr->getResponse(false);
+    auto backup = searchResourcePtr->getResponse(true);
+    if (!backup->isReturned() || searchResourcePtr->getReturnedResponse() != backup) {
+        return;
+    }
+    int64_t primaryLatency = primary->isReturned()
+                                 ? primary->callUsedTime()
+                                 : TimeUtility::currentTime() - searchResourcePtr->getCallBegTime();
+    _replyInfoCollector->addHedgeWin(bizName,
+                                     max(primaryLatency - backup->callUsedTime(), (int64_t)0));
+}
+
 void ChildNodeReply::updateRetryBizs(const map<string, int32_t> &retryBizInfos) {
     for (const auto &info : retryBizInfos) {
         auto it = _clusterResponseMap.find(info.first);
@@ -46,12 +46,18 @@ public:
         ClusterResponse()
             : fastestResponseTime(std::numeric_limits<int64_t>::max())
             , startRetryTime(std::numeric_limits<int64_t>::max())
-            , retried(false) {
+            , startHedgeTime(-1)
+            , hedgeLatency(0)
+            , retried(false)
+            , hedged(false) {
         }
         std::string flowControlStrategy;
         int64_t fastestResponseTime;
         int64_t startRetryTime;
+        int64_t startHedgeTime; // -1 means not computed yet
+        int64_t hedgeLatency;
         bool retried;
+        bool hedged;
     };
     typedef std::map<std::string, ClusterResponse> ClusterResponseMap;
 
@@ -74,6 +80,7 @@ public:
     bool shouldEt(int64_t currentTime);
     void setEtInfo(const EtInfo &etInfo);
     SearchServiceResourceVector getUnReturnedResourceVec();
+    bool isHedged(const std::string &bizName) const;
     void reportMetrics();
 
 public:
@@ -100,6 +107,9 @@ public:
 private:
     void doUpdateDetectInfo(int64_t currentTime, const std::string &bizName,
                             bool retryQueryEnabled);
+    bool needHedge(int64_t currentTime, const std::string &bizName, ClusterResponse &clusterRsp);
+    size_t getUnReturnedCount(const std::string &bizName) const;
+    void collectHedgeInfo(const SearchServiceResourcePtr &searchResourcePtr);
     MetaEnv getMetaEnv(const SearchServiceResourcePtr &searchResourcePtr,
                        const ResponsePtr &responsePtr);
     void reportLinkMetric(const SearchServiceResourcePtr &searchResourcePtr,
@@ -145,6 +155,12 @@ public:
     bool singleRetryEnabled() const {
         return _singleRetryEnabled;
     }
+    void setHedgeEnabled(bool hedgeEnabled) {
+        _hedgeEnabled = hedgeEnabled;
+    }
+    bool hedgeEnabled() const {
+        return _hedgeEnabled;
+    }
 
 private:
     int64_t _rpcTimeout; // us
@@ -163,6 +179,7 @@ private:
     int64_t _startDetectionTime;
     int64_t _startTime;
     bool _singleRetryEnabled;
+    bool _hedgeEnabled;
 
 private:
     AUTIL_LOG_DECLARE();
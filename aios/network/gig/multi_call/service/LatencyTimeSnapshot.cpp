@@ -60,8 +60,26 @@ int64_t LatencyTimeSnapshot::getAvgLatency(const std::string &bizName) {
     }
 }
 
-int64_t LatencyTimeSnapshot::pushLatency(const std::string &bizName, int64_t latency) {
+int64_t LatencyTimeSnapshot::getPercentileLatency(const std::string &bizName, float percentile) {
     auto latencyTimeWindow = getLatencyTimeWindow(bizName);
+    if (latencyTimeWindow) {
+        return latencyTimeWindow->getPercentileLatency(percentile);
+    } else {
+        return 0;
+    }
+}
+
+int64_t LatencyTimeSnapshot::pushLatency(const std::string &bizName, int64_t latency,
+                                         bool createWindow) {
+    auto latencyTimeWindow = getLatencyTimeWindow(bizName);
+    if (!latencyTimeWindow && createWindow) {
+        ScopedReadWriteLock lock(_mapLock, 'w');
+        auto &window = (*_latencyMap)[bizName];
+        if (!window) {
+            window.reset(new LatencyTimeWindow());
+        }
+        latencyTimeWindow = window;
+    }
     if (latencyTimeWindow) {
         return latencyTimeWindow->push(latency);
     } else {
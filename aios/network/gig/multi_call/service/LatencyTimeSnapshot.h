@@ -28,7 +28,8 @@ public:
     void updateLatencyTimeWindow(const std::string &bizName, int64_t windowSize);
     LatencyTimeWindowPtr getLatencyTimeWindow(const std::string &bizName);
     int64_t getAvgLatency(const std::string &bizName);
-    int64_t pushLatency(const std::string &bizName, int64_t latency);
+    int64_t pushLatency(const std::string &bizName, int64_t latency, bool createWindow = false);
+    int64_t getPercentileLatency(const std::string &bizName, float percentile);
 
 private:
     autil::ReadWriteLock _mapLock;
@@ -7,9 +7,17 @@
 
 #include "aios/network/gig/multi_call/service/LatencyTimeWindow.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace multi_call {
 
-LatencyTimeWindow::LatencyTimeWindow(int64_t windowSize) : _windowSize(windowSize) {
+LatencyTimeWindow::LatencyTimeWindow(int64_t windowSize)
+    : _windowSize(windowSize)
+    , _sampleCursor(0) {
+    for (auto &sample : _samples) {
+        sample.store(0, std::memory_order_relaxed);
+    }
 }
 
 LatencyTimeWindow::~LatencyTimeWindow() {
@@ -26,7 +34,24 @@ int64_t LatencyTimeWindow::push(int64_t latency) {
     int64_t value = (latency << 10) + (avg * (_windowSize - 1));
     value /= _windowSize;
     _currentAvg.setValue(value);
+    int64_t pos = _sampleCursor.fetch_add(1, std::memory_order_relaxed);
+    _samples[pos % HEDGE_LATENCY_SAMPLE_COUNT].store(latency, std::memory_order_relaxed);
     return value >> 10;
 }
 
+int64_t LatencyTimeWindow::getPercentileLatency(float percentile) const {
+    int64_t count = std::min(_sampleCursor.load(std::memory_order_relaxed),
+                             HEDGE_LATENCY_SAMPLE_COUNT);
+    if (count < HEDGE_MIN_LATENCY_SAMPLE_COUNT) {
+        return 0;
+    }
+    std::vector<int64_t> samples(count);
+    for (int64_t i = 0; i < count; i++) {
+        samples[i] = _samples[i].load(std::memory_order_relaxed);
+    }
+    int64_t nth = std::min(int64_t(count * percentile), count - 1);
+    std::nth_element(samples.begin(), samples.begin() + nth, samples.end());
+    return samples[nth];
+}
+
 } // namespace multi_call
@@ -8,6 +8,9 @@
 #ifndef ISEARCH_MULTI_CALL_LATENCYTIMEWINDOW_H_
 #define ISEARCH_MULTI_CALL_LATENCYTIMEWINDOW_H_
 
+#include <atomic>
+
+#include "aios/network/gig/multi_call/common/ControllerParam.h"
 #include "aios/network/gig/multi_call/common/common.h"
 #include "autil/AtomicCounter.h"
 
@@ -33,10 +36,15 @@ public:
             return;
         _windowSize = windowSize;
     }
+    // percentile of the recent HEDGE_LATENCY_SAMPLE_COUNT latencies,
+    // 0 if not enough samples collected yet
+    int64_t getPercentileLatency(float percentile) const;
 
 private:
     int64_t _windowSize;
     autil::AtomicCounter _currentAvg;
+    std::atomic<int64_t> _sampleCursor;
+    std::atomic<int64_t> _samples[HEDGE_LATENCY_SAMPLE_COUNT];
 };
 
 MULTI_CALL_TYPEDEF_PTR(LatencyTimeWindow);
@@ -15,6 +15,9 @@
  */
 #include "aios/network/gig/multi_call/service/RetryLimitChecker.h"
 
+#include <algorithm>
+
+#include "aios/network/gig/multi_call/common/ControllerParam.h"
 #include "autil/TimeUtility.h"
 
 using namespace std;
@@ -89,4 +92,55 @@ bool RetryLimitChecker::canRetry(const string &strategy, int64_t currentTimeInSe
     }
 }
 
+void HedgeBudgetItem::deposit(int64_t count, int64_t capacity) {
+    int64_t current = milliTokens.load(std::memory_order_relaxed);
+    int64_t next = 0;
+    do {
+        next = std::min(current + count, capacity);
+        if (next <= current) {
+            return;
+        }
+    } while (!milliTokens.compare_exchange_weak(current, next, std::memory_order_relaxed));
+}
+
+bool HedgeBudgetItem::withdraw(int64_t count) {
+    int64_t current = milliTokens.load(std::memory_order_relaxed);
+    do {
+        if (current < count) {
+            return false;
+        }
+    } while (
+        !milliTokens.compare_exchange_weak(current, current - count, std::memory_order_relaxed));
+    return true;
+}
+
+HedgeBudgetItem *RetryLimitChecker::getHedgeBudgetItem(const string &bizName) {
+    {
+        ScopedReadLock rlock(_hedgeBudgetLock);
+        auto iter = _bizHedgeBudget.find(bizName);
+        if (_bizHedgeBudget.end() != iter) {
+            return iter->second.get();
+        }
+    }
+    ScopedWriteLock wlock(_hedgeBudgetLock);
+    auto &item = _bizHedgeBudget[bizName];
+    if (!item) {
+        item = make_unique<HedgeBudgetItem>();
+    }
+    return item.get();
+}
+
+void RetryLimitChecker::depositHedgeBudget(const string &bizName, size_t requestCount,
+                                           float budgetPercent) {
+    int64_t count = int64_t(requestCount * budgetPercent * 1000);
+    if (count <= 0) {
+        return;
+    }
+    getHedgeBudgetItem(bizName)->deposit(count, HEDGE_BUDGET_CAPACITY * 1000);
+}
+
+bool RetryLimitChecker::acquireHedgeBudget(const string &bizName, size_t hedgeCount) {
+    return getHedgeBudgetItem(bizName)->withdraw(hedgeCount * 1000);
+}
+
 } // namespace multi_call
@@ -16,6 +16,7 @@
 #ifndef ISEARCH_MULTI_CALL_RETRYLIMITCHECKER_H
 #define ISEARCH_MULTI_CALL_RETRYLIMITCHECKER_H
 
+#include <atomic>
 #include <unordered_map>
 
 #include "aios/network/gig/multi_call/common/common.h"
@@ -32,6 +33,15 @@ struct RetryCheckerItem {
 private:
     AUTIL_LOG_DECLARE();
 };
+
+// token bucket bounding the extra load of hedged requests, tokens are kept
+// in 1/1000 units so that fractional budget percent can be deposited
+struct HedgeBudgetItem {
+    std::atomic<int64_t> milliTokens{0};
+    void deposit(int64_t count, int64_t capacity);
+    bool withdraw(int64_t count);
+};
+
 class RetryLimitChecker
 {
 public:
@@ -45,10 +55,18 @@ private:
 public:
     bool canRetry(const std::string &strategy, int64_t currentTimeInSeconds,
                   int32_t retryCountLimit);
+    void depositHedgeBudget(const std::string &bizName, size_t requestCount,
+                            float budgetPercent);
+    bool acquireHedgeBudget(const std::string &bizName, size_t hedgeCount);
+
+private:
+    HedgeBudgetItem *getHedgeBudgetItem(const std::string &bizName);
 
 private:
     std::unordered_map<std::string, std::unique_ptr<RetryCheckerItem>> _StrategyRetryChecker;
     autil::ReadWriteLock _checkerLock;
+    std::unordered_map<std::string, std::unique_ptr<HedgeBudgetItem>> _bizHedgeBudget;
+    autil::ReadWriteLock _hedgeBudgetLock;
     AUTIL_LOG_DECLARE();
 };
 
@@ -187,6 +187,7 @@ void SearchServiceProvider::setWeight(float weight) {
 }
 
 void SearchServiceProvider::updateWeight(ControllerFeedBack &feedBack) {
+    _controllerChain.concurrencyController.update(feedBack);
     if (unlikely(isCopy())) {
         // copy provider
         return;
@@ -605,6 +606,10 @@ std::string SearchServiceProvider::getTagVersionStr(int64_t version, int64_t cur
 }
 
 bool SearchServiceProvider::post(const RequestPtr &request, const CallBackPtr &callBack) {
+    if (!callBack->isCopyRequest()) {
+        // released in updateWeight when response returned
+        _controllerChain.concurrencyController.onRequest();
+    }
     ConnectionPtr con = getConnection(request->getProtocolType());
     if (con) {
         con->post(request, callBack);
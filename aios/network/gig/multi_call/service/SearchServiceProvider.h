@@ -76,6 +76,9 @@ public:
         return _nodeMeta.attributes;
     }
     bool isHealth() const;
+    bool isSaturated() const {
+        return _controllerChain.concurrencyController.isSaturated();
+    }
     bool isStarted() const;
     void updateTagsFromMap(const TagMap &tags);
     TagInfoMapPtr getTags() const;
@@ -216,9 +216,10 @@ SearchServiceProviderPtr SearchServiceReplica::getProviderFromConsistHash(
     auto index = it->offset;
     assert(index < serviceVector.size());
     const auto &provider = serviceVector[index];
+    bool skipSaturated = concurrencyLimitEnabled(param.flowControlConfig);
     if (provider) {
         auto weight = provider->getWeight();
-        if (weight > MIN_WEIGHT) {
+        if (weight > MIN_WEIGHT && !(skipSaturated && provider->isSaturated())) {
             if (weight >= it->label) {
                 return provider;
             } else if (param.ignoreWeightLabelInConsistentHash) {
@@ -232,7 +233,7 @@ SearchServiceProviderPtr SearchServiceReplica::getProviderFromConsistHash(
             probeProvider = provider;
         }
     }
-    auto nextProvider = findNextProviderInRing(serviceVector, it);
+    auto nextProvider = findNextProviderInRing(serviceVector, it, skipSaturated);
     if (nextProvider) {
         return nextProvider;
     } else if (provider && provider->isStarted() && provider->getWeight() >= MIN_WEIGHT) {
@@ -251,7 +252,17 @@ SearchServiceProviderPtr SearchServiceReplica::getProviderFromRandomHash(
         probeProvider = probeCandidate;
     }
     vector<RandomHashNode> weights;
-    auto sum = getRandomHashWeights(serviceVector, weights);
+    uint32_t sum = 0;
+    if (concurrencyLimitEnabled(param.flowControlConfig)) {
+        sum = getRandomHashWeights(serviceVector, weights, true);
+        if (0 == sum) {
+            // all providers saturated, fall back to weight only
+            weights.clear();
+        }
+    }
+    if (0 == sum) {
+        sum = getRandomHashWeights(serviceVector, weights);
+    }
     if (sum > 0) {
         auto index = RandomHash::get(key, weights);
         return serviceVector[index];
@@ -262,7 +273,8 @@ SearchServiceProviderPtr SearchServiceReplica::getProviderFromRandomHash(
 
 uint32_t
 SearchServiceReplica::getRandomHashWeights(const SearchServiceProviderVector &serviceVector,
-                                           vector<RandomHashNode> &weights) const {
+                                           vector<RandomHashNode> &weights,
+                                           bool skipSaturated) const {
     weights.reserve(serviceVector.size());
     uint32_t sum = 0;
     bool pureWeight = _hashPolicy == HashPolicy::RANDOM_HASH;
@@ -271,6 +283,9 @@ SearchServiceReplica::getRandomHashWeights(const SearchServiceProviderVector &se
         if (!provider || !provider->isStarted()) {
             continue;
         }
+        if (skipSaturated && provider->isSaturated()) {
+            continue;
+        }
         auto weight = pureWeight ? MAX_WEIGHT : provider->getWeight();
         if (weight > MIN_WEIGHT) {
             sum += weight;
@@ -326,7 +341,7 @@ SearchServiceProviderPtr SearchServiceReplica::getCopyProvider(const MatchTagMap
 
 SearchServiceProviderPtr
 SearchServiceReplica::findNextProviderInRing(const SearchServiceProviderVector &serviceVector,
-                                             ConsistentHash::Iterator it) {
+                                             ConsistentHash::Iterator it, bool skipSaturated) {
     auto orgIt = it++;
     uint32_t index = 0;
     set<uint32_t> tries;
@@ -344,7 +359,9 @@ SearchServiceReplica::findNextProviderInRing(const SearchServiceProviderVector &
         const auto &provider = serviceVector[index];
         if (provider) {
             auto weight = provider->getWeight();
-            if (weight > it->label) {
+            if (skipSaturated && provider->isSaturated()) {
+                tries.insert(index);
+            } else if (weight > it->label) {
                 return provider;
             } else if (weight <= MIN_WEIGHT) {
                 tries.insert(index);
@@ -385,9 +402,11 @@ SearchServiceReplica::getBackupProvider(const SearchServiceProviderPtr &selfProv
     }
     auto size = _serviceVector.size();
     auto beginIndex = sourceId;
+    bool skipSaturated = concurrencyLimitEnabled(flowControlConfig);
     for (size_t i = 0; i < size; i++) {
         const auto &provider = _serviceVector[beginIndex % size];
-        if (provider != selfProvider && provider->isHealth()) {
+        if (provider != selfProvider && provider->isHealth() &&
+            !(skipSaturated && provider->isSaturated())) {
             if (TML_NOT_MATCH != provider->matchTags(matchTagMap)) {
                 return provider;
             }
@@ -92,7 +92,7 @@ public:
 private:
     SearchServiceProviderPtr
     findNextProviderInRing(const SearchServiceProviderVector &serviceVector,
-                           ConsistentHash::Iterator it);
+                           ConsistentHash::Iterator it, bool skipSaturated = false);
     bool needDegrade(uint64_t key, const FlowControlParam &param,
                      SearchServiceProviderPtr &probeProvider, RequestType &type);
     bool needDegrade(uint64_t key, const FlowControlParam &param, float percent);
@@ -107,7 +107,11 @@ private:
                               const FlowControlParam &param,
                               SearchServiceProviderPtr &probeProvider, RequestType &type);
     uint32_t getRandomHashWeights(const SearchServiceProviderVector &serviceVector,
-                                  std::vector<RandomHashNode> &weights) const;
+                                  std::vector<RandomHashNode> &weights,
+                                  bool skipSaturated = false) const;
+    static bool concurrencyLimitEnabled(const FlowControlConfigPtr &flowControlConfig) {
+        return flowControlConfig && flowControlConfig->concurrencyLimitEnabled;
+    }
     bool getDegradeCoverPercent(const FlowControlConfigPtr &flowControlConfig,
                                 float &baseAvgLatency, float &baseErrorRatio, float &percent);
     bool getLatencyCoverPercent(const FlowControlConfigPtr &flowControlConfig,
@@ -73,6 +73,7 @@ void SearchServiceResource::initFeedBack(const FlowControlConfig &config,
                                          const SearchServiceReplicaPtr &replica,
                                          ControllerFeedBack &feedBack) {
     feedBack.minWeight = config.minWeight;
+    feedBack.concurrencyLimitEnabled = config.concurrencyLimitEnabled;
     auto &metricLimits = feedBack.metricLimits;
     metricLimits.errorRatioLimit = config.errorRatioLimit;
     metricLimits.latencyUpperLimitMs = config.latencyUpperLimitMs;
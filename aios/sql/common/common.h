@@ -225,7 +225,10 @@ extern const std::string ESCAPED_BACKTICK_LITERAL;
 // table
 constexpr uint32_t DEFAULT_BATCH_COUNT = 8 * 1024;
 constexpr uint32_t DEFAULT_BATCH_SIZE = 4 * 1024 * 1024;  // 4MB
+constexpr uint32_t DEFAULT_INIT_BATCH_COUNT = 256;
+constexpr uint32_t MIN_ADAPTIVE_BATCH_COUNT = 64;
 constexpr size_t NEED_COMPACT_MEM_SIZE = 4 * 1024 * 1024; // 4MB
+constexpr uint32_t DEFAULT_ATTR_BATCH_SEEK_THRESHOLD = 64;
 
 // pool size
 constexpr size_t MAX_SQL_POOL_SIZE = 512 * 1024 * 1024; // 512MB
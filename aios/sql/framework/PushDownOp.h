@@ -37,6 +37,10 @@ public:
     virtual std::string getName() const = 0;
     virtual void setReuseTable(bool reuse) = 0;
     virtual bool isReuseTable() const = 0;
+    // output only depends on the input table, valid after compute
+    virtual bool isDeterministic() const {
+        return false;
+    }
 };
 
 typedef std::shared_ptr<PushDownOp> PushDownOpPtr;
@@ -0,0 +1,609 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sql/ops/calc/CalcProgram.h"
+
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+
+#include "sql/common/Log.h"
+#include "sql/common/common.h"
+#include "sql/ops/condition/ExprVisitor.h"
+#include "sql/ops/condition/SqlJsonUtil.h"
+#include "table/Column.h"
+#include "table/ColumnSchema.h"
+#include "table/ValueTypeSwitch.h"
+
+using namespace std;
+using namespace autil;
+
+namespace sql {
+AUTIL_LOG_SETUP(sql, CalcProgram);
+
+namespace {
+
+typedef CalcProgram::Instruction Instruction;
+typedef CalcProgram::Frame Frame;
+
+template <typename T, typename R>
+void loadKernel(const Instruction &ins, Frame &frame, size_t begin, size_t count) {
+    auto columnData = static_cast<const table::ColumnData<T> *>(frame.columns[ins.column]);
+    R *out = frame.slot<R>(ins.output);
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = static_cast<R>(columnData->get(begin + i));
+    }
+}
+
+template <typename R>
+void fillKernel(const Instruction &ins, Frame &frame, size_t begin, size_t count) {
+    R *out = frame.slot<R>(ins.output);
+    std::fill(out, out + count, ins.left.constValue<R>());
+}
+
+template <typename T, typename R>
+void castKernel(const Instruction &ins, Frame &frame, size_t begin, size_t count) {
+    const T *in = frame.slot<T>(ins.left.slot);
+    R *out = frame.slot<R>(ins.output);
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = static_cast<R>(in[i]);
+    }
+}
+
+void notKernel(const Instruction &ins, Frame &frame, size_t begin, size_t count) {
+    const bool *in = frame.slot<bool>(ins.left.slot);
+    bool *out = frame.slot<bool>(ins.output);
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = !in[i];
+    }
+}
+
+template <typename Op, typename T, bool LeftConst, bool RightConst>
+void binaryKernel(const Instruction &ins, Frame &frame, size_t begin, size_t count) {
+    typedef decltype(Op()(T(), T())) R;
+    const T *left = LeftConst ? nullptr : frame.slot<T>(ins.left.slot);
+    const T *right = RightConst ? nullptr : frame.slot<T>(ins.right.slot);
+    const T leftValue = ins.left.constValue<T>();
+    const T rightValue = ins.right.constValue<T>();
+    R *out = frame.slot<R>(ins.output);
+    Op op;
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = op(LeftConst ? leftValue : left[i], RightConst ? rightValue : right[i]);
+    }
+}
+
+template <typename T>
+bool literalFits(int64_t v) {
+    return v >= (int64_t)std::numeric_limits<T>::min()
+           && v <= (int64_t)std::numeric_limits<T>::max();
+}
+
+} // namespace
+
+class CalcProgramCompiler : public ExprVisitor {
+private:
+    struct Value {
+        CalcProgram::Operand operand;
+        CalcProgram::ValueClass vc = CalcProgram::VC_BOOL;
+        // type the interpreter evaluates this value in, unknown for literals
+        matchdoc::BuiltinType bt = matchdoc::bt_unknown;
+    };
+
+public:
+    CalcProgramCompiler(const table::Table &table, CalcProgram &program)
+        : _table(table)
+        , _program(program) {}
+
+public:
+    bool compile(const autil::SimpleValue &expr);
+
+protected:
+    void visitOtherOp(const autil::SimpleValue &value) override;
+    void visitInt64(const autil::SimpleValue &value) override;
+    void visitDouble(const autil::SimpleValue &value) override;
+    void visitBool(const autil::SimpleValue &value) override;
+    void visitColumn(const autil::SimpleValue &value) override;
+
+private:
+    bool visitParam(const autil::SimpleValue &param, Value &value);
+    void visitLogicalOp(const std::string &op, const autil::SimpleValue &params);
+    void visitNotOp(const autil::SimpleValue &params);
+    void visitCompareOp(const std::string &op, const autil::SimpleValue &params);
+    void visitArithmeticOp(const std::string &op, const autil::SimpleValue &params);
+    template <typename T>
+    void emitCompare(const std::string &op, const Value &left, const Value &right);
+    template <typename T>
+    void emitArithmetic(const std::string &op, const Value &left, const Value &right);
+    template <typename Op, typename T>
+    void emitBinary(const Value &left, const Value &right, CalcProgram::ValueClass resultClass);
+    template <typename T, typename R>
+    void emitCast(Value &value, CalcProgram::ValueClass vc);
+    void promote(Value &value, CalcProgram::ValueClass vc);
+    void roundToFloat(Value &value);
+    bool resolveType(const std::string &op,
+                     const Value &left,
+                     const Value &right,
+                     matchdoc::BuiltinType &bt);
+    int32_t emit(CalcProgram::Instruction &ins);
+    template <typename T>
+    static Value makeConst(T v, CalcProgram::ValueClass vc);
+
+private:
+    const table::Table &_table;
+    CalcProgram &_program;
+    std::unordered_map<std::string, Value> _columnValues;
+    Value _value;
+};
+
+bool CalcProgramCompiler::compile(const autil::SimpleValue &expr) {
+    Value value;
+    if (!visitParam(expr, value)) {
+        return false;
+    }
+    if (_value.operand.isConst()) {
+        CalcProgram::Instruction ins;
+        ins.left = _value.operand;
+        switch (_value.vc) {
+        case CalcProgram::VC_BOOL:
+            ins.kernel = &fillKernel<bool>;
+            break;
+        case CalcProgram::VC_INT64:
+            ins.kernel = &fillKernel<int64_t>;
+            break;
+        case CalcProgram::VC_DOUBLE:
+            ins.kernel = &fillKernel<double>;
+            break;
+        }
+        _value.operand.slot = emit(ins);
+    }
+    _program._resultSlot = _value.operand.slot;
+    _program._resultClass = _value.vc;
+    return true;
+}
+
+void CalcProgramCompiler::visitOtherOp(const autil::SimpleValue &value) {
+    string op(value[SQL_CONDITION_OPERATOR].GetString());
+    const SimpleValue &params = value[SQL_CONDITION_PARAMETER];
+    if (op == SQL_AND_OP || op == SQL_OR_OP) {
+        visitLogicalOp(op, params);
+    } else if (op == SQL_NOT_OP) {
+        visitNotOp(params);
+    } else if (op == SQL_EQUAL_OP || op == SQL_NOT_EQUAL_OP || op == SQL_GT_OP || op == SQL_GE_OP
+               || op == SQL_LT_OP || op == SQL_LE_OP) {
+        visitCompareOp(op, params);
+    } else if (op == "+" || op == "-" || op == "*") {
+        visitArithmeticOp(op, params);
+    } else {
+        setErrorInfo("op [%s] is not supported", op.c_str());
+    }
+}
+
+void CalcProgramCompiler::visitInt64(const autil::SimpleValue &value) {
+    _value = makeConst<int64_t>(value.GetInt64(), CalcProgram::VC_INT64);
+}
+
+void CalcProgramCompiler::visitDouble(const autil::SimpleValue &value) {
+    // keep the precision the interpreter sees, it renders double literals through float
+    string literal = to_string((float)value.GetDouble());
+    _value = makeConst<double>(strtod(literal.c_str(), nullptr), CalcProgram::VC_DOUBLE);
+}
+
+void CalcProgramCompiler::visitBool(const autil::SimpleValue &value) {
+    _value = makeConst<bool>(value.GetBool(), CalcProgram::VC_BOOL);
+}
+
+void CalcProgramCompiler::visitColumn(const autil::SimpleValue &value) {
+    string name = SqlJsonUtil::getColumnName(value);
+    auto iter = _columnValues.find(name);
+    if (iter != _columnValues.end()) {
+        _value = iter->second;
+        return;
+    }
+    table::Column *column = _table.getColumn(name);
+    if (column == nullptr) {
+        setErrorInfo("column [%s] not found", name.c_str());
+        return;
+    }
+    auto vt = column->getColumnSchema()->getType();
+    if (vt.isMultiValue()) {
+        setErrorInfo("multi value column [%s] is not supported", name.c_str());
+        return;
+    }
+    CalcProgram::Instruction ins;
+    Value result;
+    switch (vt.getBuiltinType()) {
+#define LOAD_CASE(bt, T, R, VC)                                                                    \
+    case matchdoc::bt:                                                                             \
+        ins.kernel = &loadKernel<T, R>;                                                            \
+        result.vc = CalcProgram::VC;                                                               \
+        result.bt = matchdoc::bt;                                                                  \
+        break
+        LOAD_CASE(bt_int8, int8_t, int64_t, VC_INT64);
+        LOAD_CASE(bt_int16, int16_t, int64_t, VC_INT64);
+        LOAD_CASE(bt_int32, int32_t, int64_t, VC_INT64);
+        LOAD_CASE(bt_int64, int64_t, int64_t, VC_INT64);
+        LOAD_CASE(bt_uint8, uint8_t, int64_t, VC_INT64);
+        LOAD_CASE(bt_uint16, uint16_t, int64_t, VC_INT64);
+        LOAD_CASE(bt_uint32, uint32_t, int64_t, VC_INT64);
+        LOAD_CASE(bt_float, float, double, VC_DOUBLE);
+        LOAD_CASE(bt_double, double, double, VC_DOUBLE);
+        LOAD_CASE(bt_bool, bool, bool, VC_BOOL);
+#undef LOAD_CASE
+    default:
+        setErrorInfo("column [%s] type [%d] is not supported", name.c_str(), vt.getBuiltinType());
+        return;
+    }
+    ins.column = _program._columns.size();
+    _program._columns.emplace_back(name, vt.getBuiltinType());
+    result.operand.slot = emit(ins);
+    _columnValues[name] = result;
+    _value = result;
+}
+
+bool CalcProgramCompiler::visitParam(const autil::SimpleValue &param, Value &value) {
+    if (param.IsNull()) {
+        setErrorInfo("null param is not supported");
+        return false;
+    }
+    visit(param);
+    if (isError()) {
+        return false;
+    }
+    value = _value;
+    return true;
+}
+
+void CalcProgramCompiler::visitLogicalOp(const std::string &op, const autil::SimpleValue &params) {
+    if (params.Size() < 2) {
+        setErrorInfo("logical op [%s] needs at least 2 params", op.c_str());
+        return;
+    }
+    Value result;
+    for (size_t i = 0; i < params.Size(); ++i) {
+        Value value;
+        if (!visitParam(params[i], value)) {
+            return;
+        }
+        if (value.vc != CalcProgram::VC_BOOL) {
+            setErrorInfo("logical op [%s] on non bool param", op.c_str());
+            return;
+        }
+        if (i == 0) {
+            result = value;
+            continue;
+        }
+        if (op == SQL_AND_OP) {
+            emitBinary<std::logical_and<bool>, bool>(result, value, CalcProgram::VC_BOOL);
+        } else {
+            emitBinary<std::logical_or<bool>, bool>(result, value, CalcProgram::VC_BOOL);
+        }
+        result = _value;
+    }
+    _value = result;
+}
+
+void CalcProgramCompiler::visitNotOp(const autil::SimpleValue &params) {
+    Value value;
+    if (params.Size() != 1 || !visitParam(params[0], value)) {
+        if (!isError()) {
+            setErrorInfo("not op needs 1 param");
+        }
+        return;
+    }
+    if (value.vc != CalcProgram::VC_BOOL) {
+        setErrorInfo("not op on non bool param");
+        return;
+    }
+    if (value.operand.isConst()) {
+        _value = makeConst<bool>(!value.operand.constValue<bool>(), CalcProgram::VC_BOOL);
+        return;
+    }
+    CalcProgram::Instruction ins;
+    ins.kernel = &notKernel;
+    ins.left = value.operand;
+    _value.vc = CalcProgram::VC_BOOL;
+    _value.bt = matchdoc::bt_bool;
+    _value.operand = CalcProgram::Operand();
+    _value.operand.slot = emit(ins);
+}
+
+void CalcProgramCompiler::visitCompareOp(const std::string &op, const autil::SimpleValue &params) {
+    Value left, right;
+    if (params.Size() != 2) {
+        setErrorInfo("compare op [%s] needs 2 params", op.c_str());
+        return;
+    }
+    if (!visitParam(params[0], left) || !visitParam(params[1], right)) {
+        return;
+    }
+    matchdoc::BuiltinType bt = matchdoc::bt_unknown;
+    if (!resolveType(op, left, right, bt)) {
+        return;
+    }
+    auto vc = std::max(left.vc, right.vc);
+    promote(left, vc);
+    promote(right, vc);
+    if (bt == matchdoc::bt_float) {
+        // the interpreter parses the literal as float and compares in float
+        roundToFloat(left);
+        roundToFloat(right);
+    }
+    switch (vc) {
+    case CalcProgram::VC_BOOL:
+        emitCompare<bool>(op, left, right);
+        break;
+    case CalcProgram::VC_INT64:
+        emitCompare<int64_t>(op, left, right);
+        break;
+    case CalcProgram::VC_DOUBLE:
+        emitCompare<double>(op, left, right);
+        break;
+    }
+}
+
+void CalcProgramCompiler::visitArithmeticOp(const std::string &op,
+                                            const autil::SimpleValue &params) {
+    Value left, right;
+    if (params.Size() != 2) {
+        setErrorInfo("arithmetic op [%s] needs 2 params", op.c_str());
+        return;
+    }
+    if (!visitParam(params[0], left) || !visitParam(params[1], right)) {
+        return;
+    }
+    if (left.vc == CalcProgram::VC_BOOL || right.vc == CalcProgram::VC_BOOL) {
+        setErrorInfo("arithmetic op [%s] on bool param", op.c_str());
+        return;
+    }
+    matchdoc::BuiltinType bt = matchdoc::bt_unknown;
+    if (!resolveType(op, left, right, bt)) {
+        return;
+    }
+    // the interpreter wraps and rounds in the column type, only the types
+    // the kernels compute in natively keep its results
+    if (bt != matchdoc::bt_unknown && bt != matchdoc::bt_int64 && bt != matchdoc::bt_double) {
+        setErrorInfo("arithmetic op [%s] on type [%d] is not supported", op.c_str(), bt);
+        return;
+    }
+    auto vc = std::max(left.vc, right.vc);
+    promote(left, vc);
+    promote(right, vc);
+    if (vc == CalcProgram::VC_INT64) {
+        emitArithmetic<int64_t>(op, left, right);
+    } else {
+        emitArithmetic<double>(op, left, right);
+    }
+}
+
+template <typename T>
+void CalcProgramCompiler::emitCompare(const std::string &op, const Value &left, const Value &right) {
+    if (op == SQL_EQUAL_OP) {
+        emitBinary<std::equal_to<T>, T>(left, right, CalcProgram::VC_BOOL);
+    } else if (op == SQL_NOT_EQUAL_OP) {
+        emitBinary<std::not_equal_to<T>, T>(left, right, CalcProgram::VC_BOOL);
+    } else if (op == SQL_GT_OP) {
+        emitBinary<std::greater<T>, T>(left, right, CalcProgram::VC_BOOL);
+    } else if (op == SQL_GE_OP) {
+        emitBinary<std::greater_equal<T>, T>(left, right, CalcProgram::VC_BOOL);
+    } else if (op == SQL_LT_OP) {
+        emitBinary<std::less<T>, T>(left, right, CalcProgram::VC_BOOL);
+    } else {
+        emitBinary<std::less_equal<T>, T>(left, right, CalcProgram::VC_BOOL);
+    }
+}
+
+template <typename T>
+void CalcProgramCompiler::emitArithmetic(const std::string &op,
+                                         const Value &left,
+                                         const Value &right) {
+    auto vc = left.vc;
+    if (op == "+") {
+        emitBinary<std::plus<T>, T>(left, right, vc);
+    } else if (op == "-") {
+        emitBinary<std::minus<T>, T>(left, right, vc);
+    } else {
+        emitBinary<std::multiplies<T>, T>(left, right, vc);
+    }
+}
+
+template <typename Op, typename T>
+void CalcProgramCompiler::emitBinary(const Value &left,
+                                     const Value &right,
+                                     CalcProgram::ValueClass resultClass) {
+    typedef decltype(Op()(T(), T())) R;
+    if (left.operand.isConst() && right.operand.isConst()) {
+        _value = makeConst<R>(
+            Op()(left.operand.constValue<T>(), right.operand.constValue<T>()), resultClass);
+        return;
+    }
+    CalcProgram::Instruction ins;
+    ins.left = left.operand;
+    ins.right = right.operand;
+    if (left.operand.isConst()) {
+        ins.kernel = &binaryKernel<Op, T, true, false>;
+    } else if (right.operand.isConst()) {
+        ins.kernel = &binaryKernel<Op, T, false, true>;
+    } else {
+        ins.kernel = &binaryKernel<Op, T, false, false>;
+    }
+    _value.vc = resultClass;
+    _value.bt = resultClass == CalcProgram::VC_BOOL    ? matchdoc::bt_bool
+                : resultClass == CalcProgram::VC_INT64 ? matchdoc::bt_int64
+                                                       : matchdoc::bt_double;
+    _value.operand = CalcProgram::Operand();
+    _value.operand.slot = emit(ins);
+}
+
+template <typename T, typename R>
+void CalcProgramCompiler::emitCast(Value &value, CalcProgram::ValueClass vc) {
+    if (value.operand.isConst()) {
+        value = makeConst<R>(static_cast<R>(value.operand.constValue<T>()), vc);
+        return;
+    }
+    CalcProgram::Instruction ins;
+    ins.kernel = &castKernel<T, R>;
+    ins.left = value.operand;
+    value.vc = vc;
+    value.operand = CalcProgram::Operand();
+    value.operand.slot = emit(ins);
+}
+
+void CalcProgramCompiler::promote(Value &value, CalcProgram::ValueClass vc) {
+    if (value.vc == vc) {
+        return;
+    }
+    if (value.vc == CalcProgram::VC_BOOL) {
+        if (vc == CalcProgram::VC_INT64) {
+            emitCast<bool, int64_t>(value, vc);
+        } else {
+            emitCast<bool, double>(value, vc);
+        }
+    } else {
+        emitCast<int64_t, double>(value, vc);
+    }
+}
+
+void CalcProgramCompiler::roundToFloat(Value &value) {
+    if (value.operand.isConst()) {
+        value = makeConst<double>((float)value.operand.constValue<double>(), value.vc);
+    }
+}
+
+bool CalcProgramCompiler::resolveType(const std::string &op,
+                                      const Value &left,
+                                      const Value &right,
+                                      matchdoc::BuiltinType &bt) {
+    if (left.bt != matchdoc::bt_unknown && right.bt != matchdoc::bt_unknown
+        && left.bt != right.bt) {
+        setErrorInfo("op [%s] on different types [%d] and [%d]", op.c_str(), left.bt, right.bt);
+        return false;
+    }
+    bt = left.bt != matchdoc::bt_unknown ? left.bt : right.bt;
+    const Value &literal = left.bt != matchdoc::bt_unknown ? right : left;
+    if (bt == matchdoc::bt_unknown || bt == matchdoc::bt_bool || bt == matchdoc::bt_float
+        || bt == matchdoc::bt_double || literal.bt != matchdoc::bt_unknown) {
+        return true;
+    }
+    // the interpreter parses the literal in the column type and fails when it does not fit
+    bool fits = literal.vc == CalcProgram::VC_INT64;
+    int64_t v = literal.operand.intValue;
+    switch (bt) {
+    case matchdoc::bt_int8:
+        fits = fits && literalFits<int8_t>(v);
+        break;
+    case matchdoc::bt_int16:
+        fits = fits && literalFits<int16_t>(v);
+        break;
+    case matchdoc::bt_int32:
+        fits = fits && literalFits<int32_t>(v);
+        break;
+    case matchdoc::bt_uint8:
+        fits = fits && literalFits<uint8_t>(v);
+        break;
+    case matchdoc::bt_uint16:
+        fits = fits && literalFits<uint16_t>(v);
+        break;
+    case matchdoc::bt_uint32:
+        fits = fits && literalFits<uint32_t>(v);
+        break;
+    default:
+        break;
+    }
+    if (!fits) {
+        setErrorInfo("op [%s] literal does not fit type [%d]", op.c_str(), bt);
+    }
+    return fits;
+}
+
+int32_t CalcProgramCompiler::emit(CalcProgram::Instruction &ins) {
+    ins.output = _program._slotCount++;
+    _program._instructions.push_back(ins);
+    return ins.output;
+}
+
+template <typename T>
+CalcProgramCompiler::Value CalcProgramCompiler::makeConst(T v, CalcProgram::ValueClass vc) {
+    Value value;
+    value.vc = vc;
+    if constexpr (std::is_floating_point_v<T>) {
+        value.operand.doubleValue = v;
+        value.operand.intValue = static_cast<int64_t>(v);
+    } else {
+        value.operand.intValue = v;
+        value.operand.doubleValue = static_cast<double>(v);
+    }
+    return value;
+}
+
+CalcProgram::CalcProgram()
+    : _slotCount(0)
+    , _resultSlot(-1)
+    , _resultClass(VC_BOOL) {}
+
+CalcProgram::~CalcProgram() {}
+
+std::shared_ptr<CalcProgram> CalcProgram::compile(const autil::SimpleValue &expr,
+                                                  const table::Table &table) {
+    auto program = std::make_shared<CalcProgram>();
+    CalcProgramCompiler compiler(table, *program);
+    if (!compiler.compile(expr)) {
+        SQL_LOG(TRACE1, "expr can not be compiled, [%s]", compiler.errorInfo().c_str());
+        return nullptr;
+    }
+    return program;
+}
+
+bool CalcProgram::bind(const table::Table &table, Frame &frame) const {
+    frame.columns.clear();
+    for (const auto &[name, bt] : _columns) {
+        table::Column *column = table.getColumn(name);
+        if (column == nullptr) {
+            SQL_LOG(TRACE1, "bind compiled program failed, column [%s] not found", name.c_str());
+            return false;
+        }
+        auto vt = column->getColumnSchema()->getType();
+        if (vt.isMultiValue() || vt.getBuiltinType() != bt) {
+            SQL_LOG(TRACE1, "bind compiled program failed, column [%s] type changed", name.c_str());
+            return false;
+        }
+        table::ColumnDataBase *columnData = nullptr;
+        auto func = [&](auto a) {
+            typedef typename decltype(a)::value_type T;
+            columnData = column->getColumnData<T>();
+            return columnData != nullptr;
+        };
+        if (!table::ValueTypeSwitch::switchType(vt, func, func)) {
+            SQL_LOG(TRACE1, "bind compiled program failed, column [%s] has no data", name.c_str());
+            return false;
+        }
+        frame.columns.push_back(columnData);
+    }
+    frame.slots.resize(_slotCount);
+    for (auto &slot : frame.slots) {
+        if (!slot) {
+            slot.reset(new char[BATCH_SIZE * sizeof(int64_t)]);
+        }
+    }
+    return true;
+}
+
+void CalcProgram::run(Frame &frame, size_t begin, size_t count) const {
+    for (const auto &ins : _instructions) {
+        ins.kernel(ins, frame, begin, count);
+    }
+}
+
+} // namespace sql
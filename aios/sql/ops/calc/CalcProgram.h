@@ -0,0 +1,185 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <assert.h>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "autil/Log.h" // IWYU pragma: keep
+#include "autil/legacy/RapidJsonCommon.h"
+#include "matchdoc/ValueType.h"
+#include "table/ColumnData.h"
+#include "table/Table.h"
+
+namespace sql {
+
+// condition or numeric output expression lowered to a flat list of column kernels. every
+// kernel is a template instance chosen at compile time by op, operand type and operand kind
+// (column slot or constant), so a batch runs as a few tight loops instead of a virtual call
+// per node and row. a program is immutable and shared between queries through
+// CalcProgramCacheR; per evaluation state lives in a Frame. columns widen to int64 or double
+// on load, so expressions the interpreter would evaluate differently in the column's own type
+// (narrow int or float arithmetic, mixed column types) are not compiled and fall back.
+class CalcProgram {
+public:
+    enum ValueClass {
+        VC_BOOL,
+        VC_INT64,
+        VC_DOUBLE,
+    };
+    struct Operand {
+        int32_t slot = -1; // -1 means constant
+        int64_t intValue = 0;
+        double doubleValue = 0;
+
+        bool isConst() const {
+            return slot < 0;
+        }
+        template <typename T>
+        T constValue() const {
+            if constexpr (std::is_floating_point_v<T>) {
+                return doubleValue;
+            } else {
+                return static_cast<T>(intValue);
+            }
+        }
+    };
+    struct Frame;
+    struct Instruction;
+    typedef void (*KernelFunc)(const Instruction &, Frame &, size_t begin, size_t count);
+    struct Instruction {
+        KernelFunc kernel = nullptr;
+        int32_t column = -1;
+        Operand left;
+        Operand right;
+        int32_t output = -1;
+    };
+    struct Frame {
+        std::vector<table::ColumnDataBase *> columns;
+        std::vector<std::unique_ptr<char[]>> slots;
+
+        template <typename T>
+        T *slot(int32_t idx) {
+            return reinterpret_cast<T *>(slots[idx].get());
+        }
+    };
+
+public:
+    CalcProgram();
+    ~CalcProgram();
+    CalcProgram(const CalcProgram &) = delete;
+    CalcProgram &operator=(const CalcProgram &) = delete;
+
+public:
+    // returns nullptr when the expression uses an op, udf or column type the compiler does not
+    // support, callers fall back to the interpreted expression in that case
+    static std::shared_ptr<CalcProgram> compile(const autil::SimpleValue &expr,
+                                                const table::Table &table);
+
+public:
+    // resolves the columns of the program in table, false if any of them is missing or has
+    // another type than the program was compiled for
+    bool bind(const table::Table &table, Frame &frame) const;
+    // evaluates rows [begin, begin + count) of the bound table, count <= BATCH_SIZE
+    template <typename T>
+    const T *evaluate(Frame &frame, size_t begin, size_t count) const;
+    // fills rows [0, rowCount) of output from the bound table
+    template <typename T>
+    bool project(Frame &frame, table::ColumnData<T> *output, size_t rowCount) const;
+    ValueClass getResultClass() const {
+        return _resultClass;
+    }
+    size_t getInstructionCount() const {
+        return _instructions.size();
+    }
+    template <typename T>
+    static bool isCompatible(ValueClass vc) {
+        if constexpr (std::is_same_v<T, bool>) {
+            return vc == VC_BOOL;
+        } else if constexpr (std::is_integral_v<T>) {
+            return vc == VC_INT64;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return vc == VC_DOUBLE;
+        } else {
+            return false;
+        }
+    }
+
+public:
+    static constexpr size_t BATCH_SIZE = 1024;
+
+private:
+    void run(Frame &frame, size_t begin, size_t count) const;
+
+private:
+    std::vector<Instruction> _instructions;
+    std::vector<std::pair<std::string, matchdoc::BuiltinType>> _columns;
+    int32_t _slotCount;
+    int32_t _resultSlot;
+    ValueClass _resultClass;
+
+private:
+    friend class CalcProgramCompiler;
+    AUTIL_LOG_DECLARE();
+};
+
+typedef std::shared_ptr<const CalcProgram> CalcProgramPtr;
+
+template <typename T>
+const T *CalcProgram::evaluate(Frame &frame, size_t begin, size_t count) const {
+    assert(isCompatible<T>(_resultClass) && count <= BATCH_SIZE);
+    run(frame, begin, count);
+    return frame.slot<T>(_resultSlot);
+}
+
+template <typename T>
+bool CalcProgram::project(Frame &frame, table::ColumnData<T> *output, size_t rowCount) const {
+    if (_resultClass == VC_BOOL) {
+        if constexpr (std::is_same_v<T, bool>) {
+            for (size_t begin = 0; begin < rowCount; begin += BATCH_SIZE) {
+                size_t count = std::min(BATCH_SIZE, rowCount - begin);
+                const bool *values = evaluate<bool>(frame, begin, count);
+                for (size_t i = 0; i < count; ++i) {
+                    output->set(begin + i, values[i]);
+                }
+            }
+            return true;
+        }
+    } else if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+        if (!isCompatible<T>(_resultClass)) {
+            return false;
+        }
+        typedef std::conditional_t<std::is_floating_point_v<T>, double, int64_t> R;
+        for (size_t begin = 0; begin < rowCount; begin += BATCH_SIZE) {
+            size_t count = std::min(BATCH_SIZE, rowCount - begin);
+            const R *values = evaluate<R>(frame, begin, count);
+            for (size_t i = 0; i < count; ++i) {
+                output->set(begin + i, static_cast<T>(values[i]));
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+} // namespace sql
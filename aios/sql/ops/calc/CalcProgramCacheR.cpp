@@ -0,0 +1,109 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sql/ops/calc/CalcProgramCacheR.h"
+
+#include "autil/mem_pool/Pool.h"
+#include "navi/builder/ResourceDefBuilder.h"
+#include "navi/engine/Resource.h"
+#include "sql/common/Log.h"
+#include "sql/resource/SqlConfig.h"
+#include "table/ColumnSchema.h"
+
+namespace navi {
+class ResourceInitContext;
+} // namespace navi
+
+using namespace std;
+using namespace autil;
+
+namespace sql {
+AUTIL_LOG_SETUP(sql, CalcProgramCacheR);
+
+const std::string CalcProgramCacheR::RESOURCE_ID = "calc_program_cache_r";
+
+CalcProgramCacheR::CalcProgramCacheR()
+    : _capacity(0) {}
+
+CalcProgramCacheR::~CalcProgramCacheR() {}
+
+void CalcProgramCacheR::def(navi::ResourceDefBuilder &builder) const {
+    builder.name(RESOURCE_ID, navi::RS_BIZ);
+}
+
+bool CalcProgramCacheR::config(navi::ResourceConfigContext &ctx) {
+    return true;
+}
+
+navi::ErrorCode CalcProgramCacheR::init(navi::ResourceInitContext &ctx) {
+    _capacity = _sqlConfigResource->getSqlConfig().calcProgramCacheSize;
+    if (isEnabled()) {
+        SQL_LOG(INFO, "compiled calc enabled, program cache size [%lu]", _capacity);
+    }
+    return navi::EC_NONE;
+}
+
+CalcProgramPtr CalcProgramCacheR::getProgram(const std::string &exprJson,
+                                             const table::Table &table) {
+    string signature = getSignature(exprJson, table);
+    {
+        ScopedLock lock(_mutex);
+        auto iter = _programs.find(signature);
+        if (iter != _programs.end()) {
+            return iter->second;
+        }
+    }
+    auto program = compile(exprJson, table);
+    ScopedLock lock(_mutex);
+    if (_programs.size() >= _capacity) {
+        // signatures come from a bounded set of plans, starting over is enough
+        SQL_LOG(DEBUG, "calc program cache full, clear [%lu] programs", _programs.size());
+        _programs.clear();
+    }
+    _programs.emplace(std::move(signature), program);
+    return program;
+}
+
+size_t CalcProgramCacheR::getProgramCount() const {
+    ScopedLock lock(_mutex);
+    return _programs.size();
+}
+
+std::string CalcProgramCacheR::getSignature(const std::string &exprJson,
+                                            const table::Table &table) {
+    string signature = exprJson;
+    for (size_t i = 0; i < table.getColumnCount(); ++i) {
+        auto vt = table.getColumnType(i);
+        signature += "|" + table.getColumnName(i) + ":" + to_string(vt.getBuiltinType())
+                     + (vt.isMultiValue() ? "m" : "");
+    }
+    return signature;
+}
+
+CalcProgramPtr CalcProgramCacheR::compile(const std::string &exprJson, const table::Table &table) {
+    mem_pool::Pool pool;
+    AutilPoolAllocator allocator(&pool);
+    SimpleDocument simpleDoc(&allocator);
+    simpleDoc.Parse(exprJson.c_str());
+    if (simpleDoc.HasParseError()) {
+        SQL_LOG(TRACE1, "parse expr json [%s] failed", exprJson.c_str());
+        return nullptr;
+    }
+    return CalcProgram::compile(simpleDoc, table);
+}
+
+REGISTER_RESOURCE(CalcProgramCacheR);
+
+} // namespace sql
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <memory>
+#include <stddef.h>
+#include <string>
+#include <unordered_map>
+
+#include "autil/Lock.h"
+#include "autil/Log.h" // IWYU pragma: keep
+#include "navi/common.h"
+#include "navi/engine/Resource.h"
+#include "navi/engine/ResourceConfigContext.h"
+#include "sql/ops/calc/CalcProgram.h"
+#include "sql/resource/SqlConfigResource.h"
+#include "table/Table.h"
+
+namespace navi {
+class ResourceDefBuilder;
+class ResourceInitContext;
+} // namespace navi
+
+namespace sql {
+
+// compiled calc programs shared by the calc ops of a biz, keyed by expression json and the
+// schema of the input table. expressions the compiler rejects are cached too, so they are not
+// lowered again for every table
+class CalcProgramCacheR : public navi::Resource {
+public:
+    CalcProgramCacheR();
+    ~CalcProgramCacheR();
+    CalcProgramCacheR(const CalcProgramCacheR &) = delete;
+    CalcProgramCacheR &operator=(const CalcProgramCacheR &) = delete;
+
+public:
+    void def(navi::ResourceDefBuilder &builder) const override;
+    bool config(navi::ResourceConfigContext &ctx) override;
+    navi::ErrorCode init(navi::ResourceInitContext &ctx) override;
+
+public:
+    bool isEnabled() const {
+        return _capacity > 0;
+    }
+    // nullptr if the expression can not be compiled for this table
+    CalcProgramPtr getProgram(const std::string &exprJson, const table::Table &table);
+    size_t getProgramCount() const;
+
+public:
+    static const std::string RESOURCE_ID;
+
+private:
+    static std::string getSignature(const std::string &exprJson, const table::Table &table);
+    static CalcProgramPtr compile(const std::string &exprJson, const table::Table &table);
+
+private:
+    RESOURCE_DEPEND_DECLARE();
+
+private:
+    RESOURCE_DEPEND_ON(SqlConfigResource, _sqlConfigResource);
+    size_t _capacity;
+    std::unordered_map<std::string, CalcProgramPtr> _programs;
+    mutable autil::ThreadMutex _mutex;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+NAVI_TYPEDEF_PTR(CalcProgramCacheR);
+
+} // namespace sql
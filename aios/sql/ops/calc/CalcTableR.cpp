@@ -23,6 +23,7 @@
 
 #include "autil/CommonMacros.h"
 #include "autil/StringUtil.h"
+#include "autil/legacy/RapidJsonHelper.h"
 #include "kmonitor/client/MetricsReporter.h"
 #include "matchdoc/ValueType.h"
 #include "matchdoc/VectorDocStorage.h"
@@ -36,6 +37,7 @@
 #include "sql/ops/condition/AliasConditionVisitor.h"
 #include "sql/ops/condition/ConditionParser.h"
 #include "sql/ops/condition/ExprUtil.h"
+#include "sql/ops/condition/SqlJsonUtil.h"
 #include "suez/turing/expression/cava/common/CavaPluginManager.h"
 #include "suez/turing/expression/cava/common/SuezCavaAllocator.h"
 #include "suez/turing/expression/common.h"
@@ -115,6 +117,9 @@ navi::ErrorCode CalcTableR::init(navi::ResourceInitContext &ctx) {
         return navi::EC_ABORT;
     }
     SQL_LOG(TRACE1, "expr alias map[%s]", autil::StringUtil::toString(_exprsAliasMap).c_str());
+    if (_calcProgramCacheR && _calcProgramCacheR->isEnabled()) {
+        initOutputExprJsons();
+    }
     ConditionParser parser(_initPool.get());
     if (!parser.parseCondition(_calcInitParamR->conditionJson, _condition)) {
         SQL_LOG(ERROR, "parse condition [%s] failed", _calcInitParamR->conditionJson.c_str());
@@ -190,6 +195,9 @@ bool CalcTableR::filterTable(const table::TablePtr &table,
     if (_condition == nullptr || !_filterFlag) {
         return true;
     }
+    if (compiledFilterTable(table, startIdx, endIdx, lazyDelete)) {
+        return true;
+    }
     AliasConditionVisitor aliasVisitor;
     _condition->accept(&aliasVisitor);
     const auto &aliasMap = aliasVisitor.getAliasMap();
@@ -212,7 +220,43 @@ bool CalcTableR::filterTable(const table::TablePtr &table,
                                            _cavaPluginManagerR->getManager().get(),
                                            &functionProvider,
                                            _suezCavaAllocatorR->getAllocator().get());
-    return doFilterTable(table, startIdx, endIdx, lazyDelete, &exprCreator);
+    bool ret = doFilterTable(table, startIdx, endIdx, lazyDelete, &exprCreator);
+    _isDeterministic = _isDeterministic && exprCreator.isDeterministic();
+    return ret;
+}
+
+bool CalcTableR::compiledFilterTable(const table::TablePtr &table,
+                                     size_t startIdx,
+                                     size_t endIdx,
+                                     bool lazyDelete) {
+    if (!_calcProgramCacheR || !_calcProgramCacheR->isEnabled()) {
+        return false;
+    }
+    auto program = _calcProgramCacheR->getProgram(_calcInitParamR->conditionJson, *table);
+    if (!program || program->getResultClass() != CalcProgram::VC_BOOL) {
+        return false;
+    }
+    CalcProgram::Frame frame;
+    if (!program->bind(*table, frame)) {
+        return false;
+    }
+    SQL_LOG(TRACE2,
+            "filter table with compiled program, [%lu] instructions",
+            program->getInstructionCount());
+    for (size_t batchBegin = startIdx; batchBegin < endIdx;
+         batchBegin += CalcProgram::BATCH_SIZE) {
+        size_t count = std::min(CalcProgram::BATCH_SIZE, endIdx - batchBegin);
+        const bool *passed = program->evaluate<bool>(frame, batchBegin, count);
+        for (size_t i = 0; i < count; i++) {
+            if (!passed[i]) {
+                table->markDeleteRow(batchBegin + i);
+            }
+        }
+    }
+    if (!lazyDelete) {
+        table->deleteRows();
+    }
+    return true;
 }
 
 bool CalcTableR::doFilterTable(const table::TablePtr &table,
@@ -251,10 +295,24 @@ bool CalcTableR::doFilterTable(const table::TablePtr &table,
         SQL_LOG(WARN, "[%s] not bool expr", attriExpr->getOriginalString().c_str());
         return false;
     }
-    for (size_t i = startIdx; i < endIdx; i++) {
-        auto row = table->getRow(i);
-        if (!boolExpr->evaluateAndReturn(row)) {
-            table->markDeleteRow(i);
+    // evaluate the condition column-wise over batches of rows
+    vector<MatchDoc> batchRows;
+    batchRows.reserve(std::min(endIdx - startIdx, FILTER_BATCH_SIZE));
+    unique_ptr<bool[]> passed(new bool[FILTER_BATCH_SIZE]);
+    for (size_t batchBegin = startIdx; batchBegin < endIdx; batchBegin += FILTER_BATCH_SIZE) {
+        size_t batchEnd = std::min(batchBegin + FILTER_BATCH_SIZE, endIdx);
+        batchRows.clear();
+        for (size_t i = batchBegin; i < batchEnd; i++) {
+            batchRows.push_back(table->getRow(i));
+        }
+        if (!boolExpr->evaluateColumn(batchRows.data(), batchRows.size(), passed.get())) {
+            SQL_LOG(WARN, "evaluate filter expr [%s] failed", attriExpr->getOriginalString().c_str());
+            return false;
+        }
+        for (size_t i = 0; i < batchRows.size(); i++) {
+            if (!passed[i]) {
+                table->markDeleteRow(batchBegin + i);
+            }
         }
     }
     if (!lazyDelete) {
@@ -294,6 +352,37 @@ bool CalcTableR::needCopyTable(const table::TablePtr &table) {
     return false;
 }
 
+void CalcTableR::initOutputExprJsons() {
+    if (_calcInitParamR->outputExprsJson.empty()) {
+        return;
+    }
+    autil::AutilPoolAllocator allocator(_initPool.get());
+    autil::SimpleDocument simpleDoc(&allocator);
+    if (!ExprUtil::parseExprsJson(_calcInitParamR->outputExprsJson, simpleDoc)) {
+        return;
+    }
+    for (auto itr = simpleDoc.MemberBegin(); itr != simpleDoc.MemberEnd(); ++itr) {
+        if (ExprUtil::isCaseOp(itr->value)) {
+            continue;
+        }
+        const string &key = SqlJsonUtil::isColumn(itr->name) ? SqlJsonUtil::getColumnName(itr->name)
+                                                             : itr->name.GetString();
+        _outputExprJsons[key] = autil::RapidJsonHelper::SimpleValue2Str(itr->value);
+    }
+}
+
+CalcProgramPtr CalcTableR::getOutputProgram(const std::string &name,
+                                            const table::Table &inputTable) {
+    if (!_calcProgramCacheR || !_calcProgramCacheR->isEnabled()) {
+        return nullptr;
+    }
+    auto iter = _outputExprJsons.find(name);
+    if (iter == _outputExprJsons.end()) {
+        return nullptr;
+    }
+    return _calcProgramCacheR->getProgram(iter->second, inputTable);
+}
+
 bool CalcTableR::doProjectReuseTable(table::TablePtr &table,
                                      suez::turing::MatchDocsExpressionCreator *exprCreator) {
     vector<ExprColumnType> exprVec;
@@ -367,7 +456,9 @@ bool CalcTableR::projectTable(table::TablePtr &table) {
                                            cavaPluginManager,
                                            &functionProvider,
                                            cavaAllocator);
-    return doProjectTable(table, &exprCreator);
+    bool ret = doProjectTable(table, &exprCreator);
+    _isDeterministic = _isDeterministic && exprCreator.isDeterministic();
+    return ret;
 }
 
 bool CalcTableR::declareTable(const table::TablePtr &inputTable,
@@ -384,8 +475,13 @@ bool CalcTableR::declareTable(const table::TablePtr &inputTable,
             if (_calcInitParamR->outputFields.size() == _calcInitParamR->outputFieldsType.size()) {
                 outputType = _calcInitParamR->outputFieldsType[i];
             }
-            if (!declareExprColumn(
-                    newName, outputType, iter->second, outputTable, exprCreator, exprVec)) {
+            if (!declareExprColumn(newName,
+                                   outputType,
+                                   iter->second,
+                                   inputTable,
+                                   outputTable,
+                                   exprCreator,
+                                   exprVec)) {
                 SQL_LOG(WARN,
                         "output expr column[%s] exprStr[%s] exprJson[%s] failed",
                         newName.c_str(),
@@ -481,6 +577,7 @@ CalcTableR::createAttributeExpression(const std::string &outputType,
 bool CalcTableR::declareExprColumn(const std::string &name,
                                    const std::string &outputType,
                                    const ExprEntity &exprEntity,
+                                   const table::TablePtr &inputTable,
                                    table::TablePtr &outputTable,
                                    MatchDocsExpressionCreator *exprCreator,
                                    vector<ExprColumnType> &exprVec) {
@@ -508,6 +605,7 @@ bool CalcTableR::declareExprColumn(const std::string &name,
     }
     auto bt = attriExpr->getType();
     bool isMulti = attriExpr->isMultiValue();
+    CalcProgramPtr program = getOutputProgram(name, *inputTable);
     auto func = [&](auto a) {
         typedef typename decltype(a)::value_type T;
         ColumnDataBase *newColumnData
@@ -516,7 +614,10 @@ bool CalcTableR::declareExprColumn(const std::string &name,
             SQL_LOG(ERROR, "can not declare column [%s]", name.c_str());
             return false;
         }
-        exprVec.emplace_back(std::make_pair(attriExpr, newColumnData));
+        if (program && !CalcProgram::isCompatible<T>(program->getResultClass())) {
+            program.reset();
+        }
+        exprVec.emplace_back(attriExpr, newColumnData, program);
         return true;
     };
     if (!table::ValueTypeSwitch::switchType(bt, isMulti, func, func)) {
@@ -554,6 +655,7 @@ bool CalcTableR::calcTableExpr(const table::TablePtr &inputTable,
 
     AttributeExpression *attriExpr = nullptr;
     table::ColumnDataBase *originColumnDataBase = nullptr;
+    CalcProgramPtr program;
 
     auto func = [&](auto a) {
         typedef typename decltype(a)::value_type T;
@@ -562,6 +664,13 @@ bool CalcTableR::calcTableExpr(const table::TablePtr &inputTable,
         if (attriExprTyped == nullptr || newColumnData == nullptr) {
             return false;
         }
+        if (program) {
+            CalcProgram::Frame frame;
+            if (program->bind(*inputTable, frame)
+                && program->project(frame, newColumnData, outputTable->getRowCount())) {
+                return true;
+            }
+        }
         for (size_t i = 0; i < outputTable->getRowCount(); i++) {
             newColumnData->set(i, attriExprTyped->evaluateAndReturn(inputTable->getRow(i)));
         }
@@ -569,8 +678,7 @@ bool CalcTableR::calcTableExpr(const table::TablePtr &inputTable,
     };
 
     for (size_t i = 0; i < exprVec.size(); ++i) {
-        attriExpr = exprVec[i].first;
-        originColumnDataBase = exprVec[i].second;
+        std::tie(attriExpr, originColumnDataBase, program) = exprVec[i];
         auto bt = attriExpr->getType();
         bool isMulti = attriExpr->isMultiValue();
         if (!table::ValueTypeSwitch::switchType(bt, isMulti, func, func)) {
@@ -34,6 +34,8 @@
 #include "navi/resource/GraphMemoryPoolR.h"
 #include "sql/common/Log.h" // IWYU pragma: keep
 #include "sql/ops/calc/CalcInitParamR.h"
+#include "sql/ops/calc/CalcProgram.h"
+#include "sql/ops/calc/CalcProgramCacheR.h"
 #include "sql/ops/condition/Condition.h"
 #include "sql/ops/condition/ExprUtil.h"
 #include "sql/resource/QueryMetricReporterR.h"
@@ -120,12 +122,16 @@ public:
     bool isReuseTable() const {
         return _reuseTable;
     }
+    bool isDeterministic() const {
+        return _isDeterministic;
+    }
     kmonitor::MetricsReporter *getOpMetricReporter() const {
         return _opMetricReporter;
     }
 
 public:
-    typedef std::pair<suez::turing::AttributeExpression *, table::ColumnDataBase *> ExprColumnType;
+    typedef std::tuple<suez::turing::AttributeExpression *, table::ColumnDataBase *, CalcProgramPtr>
+        ExprColumnType;
     typedef std::tuple<table::ColumnDataBase *, table::ColumnDataBase *, matchdoc::ValueType>
         ColumnDataTuple;
     static void addAliasMap(matchdoc::MatchDocAllocator *allocator,
@@ -134,6 +140,10 @@ public:
 private:
     void prepareWithMatchInfo(suez::turing::FunctionProvider &provider);
     bool filterTable(const table::TablePtr &table);
+    bool compiledFilterTable(const table::TablePtr &table,
+                             size_t startIdx,
+                             size_t endIdx,
+                             bool lazyDelete);
     bool doFilterTable(const table::TablePtr &table,
                        size_t startIdx,
                        size_t endIdx,
@@ -166,10 +176,13 @@ private:
     bool declareExprColumn(const std::string &name,
                            const std::string &outputType,
                            const ExprEntity &exprEntity,
+                           const table::TablePtr &inputTable,
                            table::TablePtr &outputTable,
                            suez::turing::MatchDocsExpressionCreator *exprCreator,
                            std::vector<ExprColumnType> &exprVec);
     bool needCopyTable(const table::TablePtr &table);
+    void initOutputExprJsons();
+    CalcProgramPtr getOutputProgram(const std::string &name, const table::Table &inputTable);
 
 private:
     RESOURCE_DEPEND_DECLARE();
@@ -182,6 +195,7 @@ private:
     RESOURCE_DEPEND_ON(QueryMetricReporterR, _queryMetricReporterR);
     RESOURCE_DEPEND_ON(suez::turing::SuezCavaAllocatorR, _suezCavaAllocatorR);
     RESOURCE_DEPEND_ON(TraceAdapterR, _traceAdapterR);
+    RESOURCE_DEPEND_ON_FALSE(CalcProgramCacheR, _calcProgramCacheR);
     kmonitor::MetricsReporter *_opMetricReporter = nullptr;
     std::string _opName;
     std::shared_ptr<suez::turing::MetaInfo> _metaInfo;
@@ -194,13 +208,17 @@ private:
     AliasConditionVisitor *_aliasConditionVisitor = nullptr;
     std::map<std::string, ExprEntity> _exprsMap;
     std::unordered_map<std::string, std::string> _exprsAliasMap;
+    std::unordered_map<std::string, std::string> _outputExprJsons; // for compiled projection
     ConditionPtr _condition;
     bool _filterFlag;
     bool _needDestructJson;
     bool _reuseTable;
+    // false once a filter or projection evaluated a non deterministic expression
+    bool _isDeterministic = true;
 
 private:
     static const std::string DEFAULT_NULL_NUMBER_VALUE;
+    static constexpr size_t FILTER_BATCH_SIZE = 1024;
 };
 
 template <typename Context>
@@ -68,6 +68,9 @@ public:
     bool compute(table::TablePtr &table, bool &isEof) override;
     void setReuseTable(bool reuse) override;
     bool isReuseTable() const override;
+    bool isDeterministic() const override {
+        return _calcTableR->isDeterministic();
+    }
     std::string getName() const override {
         return "calc";
     }
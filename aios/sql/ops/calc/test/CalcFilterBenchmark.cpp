@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+#include "autil/mem_pool/Pool.h"
+#include "matchdoc/MatchDoc.h"
+#include "matchdoc/MatchDocAllocator.h"
+#include "suez/turing/expression/framework/AttributeExpression.h"
+#include "suez/turing/expression/framework/BinaryAttributeExpression.h"
+#include "suez/turing/expression/framework/ConstAttributeExpression.h"
+#include "table/test/MatchDocUtil.h"
+#include "unittest/unittest.h"
+
+using namespace std;
+using namespace matchdoc;
+using namespace suez::turing;
+
+namespace sql {
+
+// compares row-wise and column-wise evaluation of the filter `a + b > 100 AND c < 0.5`
+class CalcFilterBenchmark : public benchmark::Fixture {
+public:
+    CalcFilterBenchmark()
+        : _poolPtr(new autil::mem_pool::Pool)
+        , _matchDocUtil(_poolPtr) {}
+
+public:
+    void SetUp(const ::benchmark::State &state) {
+        if (_allocator) {
+            return;
+        }
+        _matchDocs = _matchDocUtil.createMatchDocs(_allocator, DOC_COUNT);
+        vector<int64_t> aValues(DOC_COUNT);
+        vector<int64_t> bValues(DOC_COUNT);
+        vector<double> cValues(DOC_COUNT);
+        for (size_t i = 0; i < DOC_COUNT; ++i) {
+            aValues[i] = i % 97;
+            bValues[i] = i % 31;
+            cValues[i] = (i % 10) / 10.0;
+        }
+        ASSERT_NO_FATAL_FAILURE(_matchDocUtil.extendMatchDocAllocator(_allocator, _matchDocs, "a", aValues));
+        ASSERT_NO_FATAL_FAILURE(_matchDocUtil.extendMatchDocAllocator(_allocator, _matchDocs, "b", bValues));
+        ASSERT_NO_FATAL_FAILURE(_matchDocUtil.extendMatchDocAllocator(_allocator, _matchDocs, "c", cValues));
+        createFilter();
+    }
+
+private:
+    template <typename T>
+    AttributeExpression *createColumnExpr(const string &name) {
+        auto expr = new AttributeExpressionTyped<T>();
+        expr->setReference(_allocator->findReference<T>(name));
+        return hold(expr);
+    }
+    AttributeExpression *hold(AttributeExpression *expr) {
+        _exprs.emplace_back(expr);
+        return expr;
+    }
+    void createFilter() {
+        auto sum = hold(new BinaryAttributeExpression<std::plus, int64_t>(createColumnExpr<int64_t>("a"),
+                                                                          createColumnExpr<int64_t>("b")));
+        auto gt = hold(
+            new BinaryAttributeExpression<std::greater, int64_t>(sum, hold(new ConstAttributeExpression<int64_t>(100))));
+        auto lt = hold(new BinaryAttributeExpression<std::less, double>(
+            createColumnExpr<double>("c"), hold(new ConstAttributeExpression<double>(0.5))));
+        _filter = dynamic_cast<AttributeExpressionTyped<bool> *>(
+            hold(new BinaryAttributeExpression<std::logical_and, bool>(gt, lt)));
+    }
+
+protected:
+    static constexpr size_t DOC_COUNT = 1000000;
+    static constexpr size_t BATCH_SIZE = 1024;
+
+    std::shared_ptr<autil::mem_pool::Pool> _poolPtr;
+    table::MatchDocUtil _matchDocUtil;
+    MatchDocAllocatorPtr _allocator;
+    vector<MatchDoc> _matchDocs;
+    vector<unique_ptr<AttributeExpression>> _exprs;
+    AttributeExpressionTyped<bool> *_filter = nullptr;
+};
+
+BENCHMARK_F(CalcFilterBenchmark, testRowEvaluate)(benchmark::State &state) {
+    for (auto _ : state) {
+        size_t passCount = 0;
+        for (auto matchDoc : _matchDocs) {
+            passCount += _filter->evaluateAndReturn(matchDoc);
+        }
+        benchmark::DoNotOptimize(passCount);
+    }
+    state.SetItemsProcessed(state.iterations() * DOC_COUNT);
+}
+
+BENCHMARK_F(CalcFilterBenchmark, testColumnEvaluate)(benchmark::State &state) {
+    unique_ptr<bool[]> passed(new bool[BATCH_SIZE]);
+    for (auto _ : state) {
+        size_t passCount = 0;
+        for (size_t begin = 0; begin < DOC_COUNT; begin += BATCH_SIZE) {
+            uint32_t count = std::min(BATCH_SIZE, DOC_COUNT - begin);
+            ASSERT_TRUE(_filter->evaluateColumn(_matchDocs.data() + begin, count, passed.get()));
+            for (uint32_t i = 0; i < count; ++i) {
+                passCount += passed[i];
+            }
+        }
+        benchmark::DoNotOptimize(passCount);
+    }
+    state.SetItemsProcessed(state.iterations() * DOC_COUNT);
+}
+
+} // namespace sql
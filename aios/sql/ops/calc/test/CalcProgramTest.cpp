@@ -0,0 +1,178 @@
+#include "sql/ops/calc/CalcProgram.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "autil/mem_pool/Pool.h"
+#include "matchdoc/MatchDoc.h"
+#include "matchdoc/MatchDocAllocator.h"
+#include "sql/ops/calc/CalcProgramCacheR.h"
+#include "table/Table.h"
+#include "table/TableUtil.h"
+#include "table/test/MatchDocUtil.h"
+#include "table/test/TableTestUtil.h"
+#include "unittest/unittest.h"
+
+using namespace std;
+using namespace matchdoc;
+using namespace table;
+
+namespace sql {
+
+class CalcProgramTest : public TESTBASE {
+public:
+    CalcProgramTest()
+        : _poolPtr(new autil::mem_pool::Pool())
+        , _matchDocUtil(_poolPtr) {}
+
+public:
+    void setUp() override {
+        _allocator.reset(new MatchDocAllocator(_poolPtr));
+        vector<MatchDoc> docs = _allocator->batchAllocate(4);
+        ASSERT_NO_FATAL_FAILURE(
+            _matchDocUtil.extendMatchDocAllocator<int32_t>(_allocator, docs, "a", {1, 2, 3, 4}));
+        ASSERT_NO_FATAL_FAILURE(_matchDocUtil.extendMatchDocAllocator<double>(
+            _allocator, docs, "b", {0.5, 1.5, 2.5, 3.5}));
+        ASSERT_NO_FATAL_FAILURE(_matchDocUtil.extendMatchDocAllocator<bool>(
+            _allocator, docs, "c", {true, false, true, false}));
+        ASSERT_NO_FATAL_FAILURE(
+            _matchDocUtil.extendMatchDocAllocator(_allocator, docs, "s", {"s1", "s2", "s3", "s4"}));
+        ASSERT_NO_FATAL_FAILURE(
+            _matchDocUtil.extendMatchDocAllocator<int64_t>(_allocator, docs, "d", {1, 2, 3, 4}));
+        ASSERT_NO_FATAL_FAILURE(_matchDocUtil.extendMatchDocAllocator<float>(
+            _allocator, docs, "f", {0.1f, 0.2f, 16777216.0f, -1.0f}));
+        _table.reset(new Table(docs, _allocator));
+    }
+
+private:
+    CalcProgramPtr compile(const string &exprJson) {
+        autil::AutilPoolAllocator allocator(_poolPtr.get());
+        autil::SimpleDocument simpleDoc(&allocator);
+        simpleDoc.Parse(exprJson.c_str());
+        EXPECT_FALSE(simpleDoc.HasParseError());
+        return CalcProgram::compile(simpleDoc, *_table);
+    }
+    vector<bool> filter(const string &exprJson) {
+        auto program = compile(exprJson);
+        EXPECT_TRUE(program);
+        if (!program) {
+            return {};
+        }
+        EXPECT_EQ(CalcProgram::VC_BOOL, program->getResultClass());
+        CalcProgram::Frame frame;
+        EXPECT_TRUE(program->bind(*_table, frame));
+        const bool *passed = program->evaluate<bool>(frame, 0, _table->getRowCount());
+        return vector<bool>(passed, passed + _table->getRowCount());
+    }
+
+private:
+    std::shared_ptr<autil::mem_pool::Pool> _poolPtr;
+    MatchDocUtil _matchDocUtil;
+    MatchDocAllocatorPtr _allocator;
+    TablePtr _table;
+};
+
+TEST_F(CalcProgramTest, testFilter) {
+    ASSERT_EQ(vector<bool>({false, true, true, true}),
+              filter(R"({"op":">", "params":["$a", 1]})"));
+    ASSERT_EQ(vector<bool>({false, false, true, false}),
+              filter(R"({"op":"AND", "params":[{"op":">=", "params":["$a", 2]}, "$c"]})"));
+    ASSERT_EQ(vector<bool>({true, false, false, true}),
+              filter(R"({"op":"OR", "params":[{"op":"<", "params":["$b", 1.0]},
+                          {"op":"=", "params":[{"op":"*", "params":["$d", 2]}, 8]}]})"));
+    ASSERT_EQ(vector<bool>({false, true, false, true}),
+              filter(R"({"op":"NOT", "params":["$c"]})"));
+    // double column against int and double literal
+    ASSERT_EQ(vector<bool>({true, true, true, true}),
+              filter(R"({"op":"<>", "params":[{"op":"+", "params":["$b", 1]}, 0.1]})"));
+    // constant condition is folded and filled
+    auto program = compile(R"({"op":"<", "params":[1, 2]})");
+    ASSERT_TRUE(program);
+    ASSERT_EQ(1, program->getInstructionCount());
+}
+
+TEST_F(CalcProgramTest, testProject) {
+    auto program = compile(R"({"op":"-", "params":[{"op":"*", "params":["$d", 10]}, 1]})");
+    ASSERT_TRUE(program);
+    ASSERT_EQ(CalcProgram::VC_INT64, program->getResultClass());
+    auto columnData = TableUtil::declareAndGetColumnData<int32_t>(_table, "out", false, true);
+    ASSERT_TRUE(columnData);
+    CalcProgram::Frame frame;
+    ASSERT_TRUE(program->bind(*_table, frame));
+    ASSERT_TRUE(program->project(frame, columnData, _table->getRowCount()));
+    ASSERT_NO_FATAL_FAILURE(TableTestUtil::checkOutputColumn<int32_t>(_table, "out", {9, 19, 29, 39}));
+
+    auto doubleData = TableUtil::declareAndGetColumnData<double>(_table, "out2", false, true);
+    ASSERT_FALSE(program->project(frame, doubleData, _table->getRowCount()));
+}
+
+TEST_F(CalcProgramTest, testUnsupported) {
+    ASSERT_FALSE(compile(R"({"op":"=", "params":["$s", "s1"]})"));
+    ASSERT_FALSE(compile(R"({"op":"/", "params":["$a", 2]})"));
+    ASSERT_FALSE(compile(R"({"op":">", "params":["$not_exist", 2]})"));
+    ASSERT_FALSE(compile(R"({"op":"IN", "params":["$a", 1, 2]})"));
+    ASSERT_FALSE(compile(R"({"op":"contain", "params":["$a", "1"], "type":"UDF"})"));
+    ASSERT_FALSE(compile(R"({"op":"AND", "params":["$a", "$c"]})"));
+    ASSERT_FALSE(compile(R"({"op":"=", "params":["$a", null]})"));
+}
+
+TEST_F(CalcProgramTest, testInterpreterTypes) {
+    // the interpreter computes in the column type, which widened kernels can not reproduce
+    ASSERT_FALSE(compile(R"({"op":"*", "params":["$a", 2]})"));
+    ASSERT_FALSE(compile(R"({"op":"+", "params":["$f", 1]})"));
+    ASSERT_FALSE(compile(R"({"op":"+", "params":["$a", "$b"]})"));
+    ASSERT_FALSE(compile(R"({"op":">", "params":["$a", "$d"]})"));
+    // literals the interpreter can not parse in the column type
+    ASSERT_FALSE(compile(R"({"op":">", "params":["$a", 3000000000]})"));
+    ASSERT_FALSE(compile(R"({"op":">", "params":["$a", 1.5]})"));
+    ASSERT_FALSE(compile(R"({"op":">", "params":["$d", 1.5]})"));
+    // comparisons widen exactly and stay compiled
+    ASSERT_EQ(vector<bool>({true, true, true, true}),
+              filter(R"({"op":">=", "params":["$a", -2147483648]})"));
+    ASSERT_EQ(vector<bool>({false, false, true, false}),
+              filter(R"({"op":"=", "params":[{"op":"+", "params":["$d", "$d"]}, 6]})"));
+    // float literals round to float like the interpreter parses them
+    ASSERT_EQ(vector<bool>({true, false, false, false}),
+              filter(R"({"op":"=", "params":["$f", 0.1]})"));
+    ASSERT_EQ(vector<bool>({false, true, true, false}),
+              filter(R"({"op":">", "params":["$f", 0.1]})"));
+    ASSERT_EQ(vector<bool>({false, false, true, false}),
+              filter(R"({"op":"=", "params":["$f", 16777217]})"));
+}
+
+TEST_F(CalcProgramTest, testBindFailed) {
+    auto program = compile(R"({"op":">", "params":["$a", 1]})");
+    ASSERT_TRUE(program);
+    auto allocator = std::make_shared<MatchDocAllocator>(_poolPtr);
+    vector<MatchDoc> docs = allocator->batchAllocate(2);
+    ASSERT_NO_FATAL_FAILURE(
+        _matchDocUtil.extendMatchDocAllocator<int64_t>(allocator, docs, "a", {1, 2}));
+    Table other(docs, allocator);
+    CalcProgram::Frame frame;
+    ASSERT_FALSE(program->bind(other, frame));
+}
+
+TEST_F(CalcProgramTest, testCache) {
+    CalcProgramCacheR cache;
+    cache._capacity = 2;
+    string condition = R"({"op":">", "params":["$a", 1]})";
+    auto program = cache.getProgram(condition, *_table);
+    ASSERT_TRUE(program);
+    ASSERT_EQ(program, cache.getProgram(condition, *_table));
+    ASSERT_FALSE(cache.getProgram(R"({"op":"/", "params":["$a", 2]})", *_table));
+    ASSERT_EQ(2, cache.getProgramCount());
+
+    // another schema gets another program
+    auto allocator = std::make_shared<MatchDocAllocator>(_poolPtr);
+    vector<MatchDoc> docs = allocator->batchAllocate(2);
+    ASSERT_NO_FATAL_FAILURE(
+        _matchDocUtil.extendMatchDocAllocator<int64_t>(allocator, docs, "a", {1, 2}));
+    Table other(docs, allocator);
+    auto otherProgram = cache.getProgram(condition, other);
+    ASSERT_TRUE(otherProgram);
+    ASSERT_NE(program, otherProgram);
+    ASSERT_EQ(1, cache.getProgramCount());
+}
+
+} // namespace sql
@@ -22,6 +22,7 @@
 #include "navi/tester/NaviResourceHelper.h"
 #include "navi/util/NaviTestPool.h"
 #include "sql/ops/calc/CalcInitParamR.h"
+#include "sql/ops/calc/CalcProgramCacheR.h"
 #include "sql/ops/condition/ConditionParser.h"
 #include "sql/ops/condition/ExprUtil.h"
 #include "suez/turing/expression/common.h"
@@ -186,6 +187,85 @@ TEST_F(CalcTableRTest, testFilterTableWith$) {
     ASSERT_NO_FATAL_FAILURE(TableTestUtil::checkOutputColumn<uint32_t>(_table, "$f1", {2, 3, 4}));
 }
 
+TEST_F(CalcTableRTest, testCompiledFilterTable) {
+    ASSERT_NO_FATAL_FAILURE(prepareTable());
+    string conditionStr = R"json({"op":">", "params":["$a", 6]})json";
+    ASSERT_NO_FATAL_FAILURE(prepareCalcTable({}, {}, conditionStr));
+    ConditionParser parser(_poolPtr.get());
+    ASSERT_TRUE(parser.parseCondition(conditionStr, _calcTable->_condition));
+    CalcProgramCacheR cache;
+    cache._capacity = 16;
+    _calcTable->_calcProgramCacheR = &cache;
+    ASSERT_TRUE(_calcTable->filterTable(_table));
+    ASSERT_EQ(1, cache.getProgramCount());
+    ASSERT_NO_FATAL_FAILURE(TableTestUtil::checkOutputColumn<int64_t>(_table, "a", {7, 8}));
+    ASSERT_NO_FATAL_FAILURE(TableTestUtil::checkOutputColumn<uint32_t>(_table, "id", {3, 4}));
+}
+
+TEST_F(CalcTableRTest, testCompiledFilterTableFallback) {
+    ASSERT_NO_FATAL_FAILURE(prepareTable());
+    string conditionStr = R"json({"op":"=", "params":["$b", "b2"]})json";
+    ASSERT_NO_FATAL_FAILURE(prepareCalcTable({}, {}, conditionStr));
+    ConditionParser parser(_poolPtr.get());
+    ASSERT_TRUE(parser.parseCondition(conditionStr, _calcTable->_condition));
+    CalcProgramCacheR cache;
+    cache._capacity = 16;
+    _calcTable->_calcProgramCacheR = &cache;
+    ASSERT_TRUE(_calcTable->filterTable(_table));
+    ASSERT_EQ(1, cache.getProgramCount());
+    ASSERT_NO_FATAL_FAILURE(TableTestUtil::checkOutputColumn<uint32_t>(_table, "id", {2}));
+}
+
+TEST_F(CalcTableRTest, testCompiledFilterMatchInterpreter) {
+    auto filterIds = [&](const string &conditionStr, CalcProgramCacheR *cache,
+                         vector<uint32_t> &ids) {
+        _allocator.reset(new matchdoc::MatchDocAllocator(_poolPtr));
+        vector<MatchDoc> docs = _allocator->batchAllocate(4);
+        ASSERT_NO_FATAL_FAILURE(
+            _matchDocUtil.extendMatchDocAllocator<uint32_t>(_allocator, docs, "id", {1, 2, 3, 4}));
+        ASSERT_NO_FATAL_FAILURE(_matchDocUtil.extendMatchDocAllocator<int32_t>(
+            _allocator, docs, "i32", {INT32_MAX, -1, 0, INT32_MIN}));
+        ASSERT_NO_FATAL_FAILURE(_matchDocUtil.extendMatchDocAllocator<uint32_t>(
+            _allocator, docs, "u32", {4000000000u, 0, 1, UINT32_MAX}));
+        ASSERT_NO_FATAL_FAILURE(_matchDocUtil.extendMatchDocAllocator<int64_t>(
+            _allocator, docs, "i64", {INT64_MAX, -1, 0, INT64_MIN + 1}));
+        ASSERT_NO_FATAL_FAILURE(_matchDocUtil.extendMatchDocAllocator<float>(
+            _allocator, docs, "f", {0.1f, 0.3f, 16777216.0f, -0.5f}));
+        _table.reset(new Table(docs, _allocator));
+        ASSERT_NO_FATAL_FAILURE(prepareCalcTable({}, {}, conditionStr));
+        ConditionParser parser(_poolPtr.get());
+        ASSERT_TRUE(parser.parseCondition(conditionStr, _calcTable->_condition));
+        _calcTable->_calcProgramCacheR = cache;
+        ASSERT_TRUE(_calcTable->filterTable(_table));
+        auto columnData = _table->getColumn("id")->getColumnData<uint32_t>();
+        ASSERT_TRUE(columnData);
+        ids.clear();
+        for (size_t i = 0; i < _table->getRowCount(); ++i) {
+            ids.push_back(columnData->get(i));
+        }
+    };
+    vector<pair<string, bool>> cases = {
+        // int32 and float arithmetic wraps and rounds in the column type
+        {R"json({"op":">", "params":[{"op":"+", "params":["$i32", 1]}, 0]})json", false},
+        {R"json({"op":"<", "params":[{"op":"*", "params":["$f", 3]}, 0.9]})json", false},
+        {R"json({"op":">", "params":[{"op":"-", "params":["$i64", 1]}, 0]})json", true},
+        {R"json({"op":">=", "params":["$i32", -2147483648]})json", true},
+        {R"json({"op":">", "params":["$u32", 3000000000]})json", true},
+        {R"json({"op":"=", "params":["$f", 0.1]})json", true},
+        {R"json({"op":">", "params":["$f", 0.3]})json", true},
+        {R"json({"op":"=", "params":["$f", 16777217]})json", true},
+    };
+    for (const auto &[conditionStr, compiled] : cases) {
+        vector<uint32_t> expected, actual;
+        ASSERT_NO_FATAL_FAILURE(filterIds(conditionStr, nullptr, expected));
+        CalcProgramCacheR cache;
+        cache._capacity = 16;
+        ASSERT_NO_FATAL_FAILURE(filterIds(conditionStr, &cache, actual));
+        ASSERT_EQ(expected, actual) << conditionStr;
+        ASSERT_EQ(compiled, cache.getProgram(conditionStr, *_table) != nullptr) << conditionStr;
+    }
+}
+
 TEST_F(CalcTableRTest, testCloneColumn) {
     ASSERT_NO_FATAL_FAILURE(prepareTable());
     ASSERT_NO_FATAL_FAILURE(prepareCalcTable());
@@ -337,6 +337,7 @@ static const string EMPTY_STRING;
 GraphTransformEnv::GraphTransformEnv() {
     disableWatermark = autil::EnvUtil::getEnv("disableWatermark", disableWatermark);
     useQrsTimestamp = autil::EnvUtil::getEnv("useQrsTimestamp", useQrsTimestamp);
+    streamingFinalAgg = autil::EnvUtil::getEnv("streamingFinalAgg", streamingFinalAgg);
 }
 
 GraphTransformEnv::~GraphTransformEnv() {}
@@ -1166,17 +1167,30 @@ void GraphTransform::addExchangeBorder() {
         for (const auto &pair : node.output2buildInputs) {
             auto remoteGraphId = pair.first->root->getRoot()->getGraphId();
             bool sameGraph = (graphId == remoteGraphId);
+            const auto &mergeKernel = getExchangeMergeKernel(*pair.first);
             for (const auto &buildInput : pair.second) {
-                addExchangeBorder(buildOutput, node, buildInput, sameGraph);
+                addExchangeBorder(buildOutput, node, buildInput, sameGraph, mergeKernel);
             }
         }
     }
 }
 
+std::string GraphTransform::getExchangeMergeKernel(plan::PlanNode &outputNode) const {
+    static const bool streamingFinalAgg = GraphTransformEnv::get().streamingFinalAgg;
+    // final agg folds every input table into its accumulators, feed it partition tables as
+    // they arrive instead of one table merged from all partitions
+    if (streamingFinalAgg && outputNode.op != nullptr && outputNode.op->opName == "sql.AggKernel"
+        && getJsonStringValue(*outputNode.op, AGG_SCOPE_ATTRIBUTE) == "FINAL") {
+        return "sql.TableStreamMergeKernel";
+    }
+    return "sql.TableMergeKernel";
+}
+
 void GraphTransform::addExchangeBorder(navi::P buildOutput,
                                        plan::ExchangeNode &exchangeNode,
                                        navi::P buildInput,
-                                       bool sameGraph) {
+                                       bool sameGraph,
+                                       const std::string &mergeKernel) {
     if (sameGraph) {
         if (exchangeNode.root->getRoot()->getGraphId() == _rootGraphId) {
             buildInput.from(buildOutput).require(true);
@@ -1184,14 +1198,14 @@ void GraphTransform::addExchangeBorder(navi::P buildOutput,
             _builder->subGraph(_rootGraphId);
             auto identityName = addMergedNode();
             auto innerBuildOutput = _builder->node(identityName).out(DEFAULT_OUTPUT_PORT);
-            buildInput.from(innerBuildOutput).require(true).merge("sql.TableMergeKernel");
+            buildInput.from(innerBuildOutput).require(true).merge(mergeKernel);
             _builder->subGraphAttr("table_distribution", ROOT_GRAPH_TABLE_DISTRIBUTION);
             auto innerBuildInput = _builder->node(identityName).in(DEFAULT_INPUT_PORT).autoNext();
-            addExchangeBorder(buildOutput, exchangeNode, innerBuildInput, false);
+            addExchangeBorder(buildOutput, exchangeNode, innerBuildInput, false, mergeKernel);
         }
     } else {
         auto buildEdge = buildInput.from(buildOutput).require(true);
-        buildEdge.merge("sql.TableMergeKernel");
+        buildEdge.merge(mergeKernel);
         buildEdge.split("sql.TableSplitKernel")
             .attr("table_distribution", exchangeNode.root->getRemoteDist());
     }
@@ -211,6 +211,7 @@ public:
 public:
     bool disableWatermark = false;
     bool useQrsTimestamp = true;
+    bool streamingFinalAgg = false;
 };
 
 class GraphTransform : public plan::NodeVisitor {
@@ -317,7 +318,9 @@ private:
     void addExchangeBorder(navi::P buildOutput,
                            plan::ExchangeNode &exchangeNode,
                            navi::P buildInput,
-                           bool sameGraph);
+                           bool sameGraph,
+                           const std::string &mergeKernel);
+    std::string getExchangeMergeKernel(plan::PlanNode &outputNode) const;
     void addTargetWatermark(plan::ScanNode &node);
     void buildEdge(const std::string &outputNode, const navi::P &buildInput);
 
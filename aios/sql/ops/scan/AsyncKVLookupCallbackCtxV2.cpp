@@ -72,6 +72,8 @@ public:
         REGISTER_GAUGE_MUTABLE_METRIC(_docsCount, "AsyncKV.docsCount");
         REGISTER_GAUGE_MUTABLE_METRIC(_failedDocsCount, "AsyncKV.failedDocsCount");
         REGISTER_GAUGE_MUTABLE_METRIC(_notFoundDocsCount, "AsyncKV.notFoundDocsCount");
+        REGISTER_GAUGE_MUTABLE_METRIC(_coalescedCount, "AsyncKV.coalescedCount");
+        REGISTER_GAUGE_MUTABLE_METRIC(_coalescedRatio, "AsyncKV.coalescedRatio");
         REGISTER_LATENCY_MUTABLE_METRIC(_watermarkLatency, "AsyncKV.watermarkLatency");
         REGISTER_QPS_MUTABLE_METRIC(_waitWatermarkFailedQps, "AsyncKV.waitWatermarkFailedQps");
         return true;
@@ -95,6 +97,11 @@ public:
         REPORT_MUTABLE_METRIC(_docsCount, kvMetrics->docsCount);
         REPORT_MUTABLE_METRIC(_failedDocsCount, kvMetrics->failedDocsCount);
         REPORT_MUTABLE_METRIC(_notFoundDocsCount, kvMetrics->notFoundDocsCount);
+        REPORT_MUTABLE_METRIC(_coalescedCount, kvMetrics->indexCollector.GetCoalescedCount());
+        if (kvMetrics->docsCount > 0) {
+            REPORT_MUTABLE_METRIC(_coalescedRatio,
+                                  (double)kvMetrics->indexCollector.GetCoalescedCount() / kvMetrics->docsCount);
+        }
 
         if (kvMetrics->needWatermark) {
             REPORT_MUTABLE_METRIC(_watermarkLatency, kvMetrics->waitWatermarkTime / 1000.0f);
@@ -116,6 +123,8 @@ private:
     MutableMetric *_docsCount = nullptr;
     MutableMetric *_failedDocsCount = nullptr;
     MutableMetric *_notFoundDocsCount = nullptr;
+    MutableMetric *_coalescedCount = nullptr;
+    MutableMetric *_coalescedRatio = nullptr;
     MutableMetric *_watermarkLatency = nullptr;
     MutableMetric *_waitWatermarkFailedQps = nullptr;
 };
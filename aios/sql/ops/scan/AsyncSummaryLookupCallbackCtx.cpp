@@ -53,6 +53,8 @@ public:
         REGISTER_LATENCY_MUTABLE_METRIC(_lookupTime, "AsyncSummary.lookupTime");
         REGISTER_GAUGE_MUTABLE_METRIC(_docsCount, "AsyncSummary.docsCount");
         REGISTER_GAUGE_MUTABLE_METRIC(_failedDocsCount, "AsyncSummary.failedDocsCount");
+        REGISTER_GAUGE_MUTABLE_METRIC(_blockAccessCount, "AsyncSummary.blockAccessCount");
+        REGISTER_GAUGE_MUTABLE_METRIC(_blockLoadCount, "AsyncSummary.blockLoadCount");
         return true;
     }
 
@@ -62,6 +64,8 @@ public:
         REPORT_MUTABLE_METRIC(_lookupTime, summaryMetrics->lookupTime / 1000.0f);
         REPORT_MUTABLE_METRIC(_docsCount, summaryMetrics->docsCount);
         REPORT_MUTABLE_METRIC(_failedDocsCount, summaryMetrics->failedDocsCount);
+        REPORT_MUTABLE_METRIC(_blockAccessCount, summaryMetrics->blockAccessCount);
+        REPORT_MUTABLE_METRIC(_blockLoadCount, summaryMetrics->blockLoadCount);
     }
 
 private:
@@ -69,6 +73,8 @@ private:
     MutableMetric *_lookupTime = nullptr;
     MutableMetric *_docsCount = nullptr;
     MutableMetric *_failedDocsCount = nullptr;
+    MutableMetric *_blockAccessCount = nullptr;
+    MutableMetric *_blockLoadCount = nullptr;
 };
 
 AsyncSummaryLookupCallbackCtx::AsyncSummaryLookupCallbackCtx(
@@ -95,16 +101,21 @@ void AsyncSummaryLookupCallbackCtx::start(std::vector<docid_t> docIds,
 
     // no need lock
     _terminator.reset(new TimeoutTerminator(timeout));
+    // the reader sorts docids and reads each segment in one batch, the counter tells how many
+    // compressed summary blocks the batch touched and how many of them had to be decompressed
+    indexlib::file_system::ReadOption option(_terminator.get());
+    option.blockCounter = &_blockCounter;
     if (_asyncPipe->getAsyncPipe() == nullptr) {
         NAVI_LOG(DEBUG, "async pipe is nullptr, use sync await");
-        auto result = future_lite::coro::syncAwait(_summaryReader->GetDocument(
-            _docIds, _poolPtr.get(), _terminator.get(), &_summaryDocVec));
+        auto result = future_lite::coro::syncAwait(
+            _summaryReader->GetDocument(_docIds, _poolPtr.get(), option, &_summaryDocVec));
         processErrorCodes(result);
+        collectBlockCounter();
         _metricsCollector.lookupTime = incCallbackVersion();
     } else {
         assert(_executor && "executor is nullptr");
         NAVI_LOG(DEBUG, "async pipe ready, use async getDocument");
-        _summaryReader->GetDocument(_docIds, _poolPtr.get(), _terminator.get(), &_summaryDocVec)
+        _summaryReader->GetDocument(_docIds, _poolPtr.get(), option, &_summaryDocVec)
             .via(_executor)
             .start([ctx = shared_from_this()](
                        future_lite::Try<indexlib::index::ErrorCodeVec> errorCodeTry) {
@@ -119,6 +130,7 @@ void AsyncSummaryLookupCallbackCtx::prepareDocs(std::vector<docid_t> docIds, siz
     _summaryDocVec.clear();
     _summaryDocDataVec.clear();
     _errorDocIds.clear();
+    _blockCounter.Reset();
     _summaryDocVec.reserve(docsCount);
     _summaryDocDataVec.reserve(docsCount);
     _metricsCollector.docsCount = docsCount;
@@ -145,8 +157,19 @@ void AsyncSummaryLookupCallbackCtx::processErrorCodes(
     _metricsCollector.failedDocsCount = _errorDocIds.size();
 }
 
+void AsyncSummaryLookupCallbackCtx::collectBlockCounter() {
+    _metricsCollector.blockAccessCount = _blockCounter.compressBlockAccessCount;
+    _metricsCollector.blockLoadCount = _blockCounter.compressBlockLoadCount;
+    NAVI_LOG(TRACE3,
+             "summary lookup docs[%lu], compress block access[%ld], load[%ld]",
+             _docIds.size(),
+             _metricsCollector.blockAccessCount,
+             _metricsCollector.blockLoadCount);
+}
+
 void AsyncSummaryLookupCallbackCtx::onSessionCallback(
     const future_lite::Try<indexlib::index::ErrorCodeVec> &errorCodeTry) {
+    collectBlockCounter();
     _metricsCollector.lookupTime = incCallbackVersion();
 
     if (errorCodeTry.hasError()) {
@@ -29,6 +29,7 @@
 #include "indexlib/index/common/ErrorCode.h"
 #include "indexlib/index/normal/summary/summary_reader.h"
 #include "indexlib/indexlib.h"
+#include "indexlib/util/cache/BlockAccessCounter.h"
 #include "navi/common.h"
 #include "navi/engine/AsyncPipe.h"
 #include "sql/common/Log.h" // IWYU pragma: keep
@@ -76,6 +77,8 @@ struct AsyncSummaryLookupMetricsCollector {
     int64_t lookupTime = 0;
     size_t docsCount = 0;
     size_t failedDocsCount = 0;
+    int64_t blockAccessCount = 0;
+    int64_t blockLoadCount = 0;
 };
 
 class AsyncSummaryLookupCallbackCtx
@@ -106,6 +109,7 @@ public: // for kernel && scan
 private:
     void prepareDocs(std::vector<docid_t> docIds, size_t fieldCount);
     void processErrorCodes(const indexlib::index::ErrorCodeVec &errorCodes);
+    void collectBlockCounter();
 
 private:
     CountedAsyncPipePtr _asyncPipe;
@@ -116,6 +120,7 @@ private:
     indexlib::index::SearchSummaryDocVec _summaryDocVec;
     std::vector<docid_t> _errorDocIds;
     autil::TimeoutTerminatorPtr _terminator;
+    indexlib::util::BlockAccessCounter _blockCounter;
     autil::mem_pool::PoolPtr _poolPtr;
     future_lite::Executor *_executor = nullptr;
     AsyncSummaryLookupMetricsCollector _metricsCollector;
@@ -67,6 +67,9 @@ public:
 private:
     bool doBatchScan(table::TablePtr &table, bool &eof) override;
     bool doUpdateScanQuery(const StreamQueryPtr &inputQuery) override;
+    bool isDeterministic() const override {
+        return _attributeExpressionCreatorR->_attributeExpressionCreator->isDeterministic();
+    }
     bool prepareKKVReader();
     void filterPks(const std::vector<std::string> &pks);
     bool parseQuery();
@@ -95,6 +95,9 @@ private:
     bool initAsyncParam();
     bool doBatchScan(table::TablePtr &table, bool &eof) override;
     bool doUpdateScanQuery(const StreamQueryPtr &inputQuery) override;
+    bool isDeterministic() const override {
+        return _attributeExpressionCreatorR->_attributeExpressionCreator->isDeterministic();
+    }
     bool prepareIndexInfo();
     bool prepareLookUpCtx();
     KVLookupOption prepareLookupOption();
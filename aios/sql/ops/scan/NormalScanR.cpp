@@ -139,6 +139,8 @@ void NormalScanR::def(navi::ResourceDefBuilder &builder) const {
 
 bool NormalScanR::config(navi::ResourceConfigContext &ctx) {
     NAVI_JSONIZE(ctx, "enable_scan_timeout", _enableScanTimeout, _enableScanTimeout);
+    NAVI_JSONIZE(
+        ctx, "attr_batch_seek_threshold", _attrBatchSeekThreshold, _attrBatchSeekThreshold);
     return true;
 }
 
@@ -186,6 +188,7 @@ navi::ErrorCode NormalScanR::init(navi::ResourceInitContext &ctx) {
         SQL_LOG(WARN, "table [%s] init scan column failed.", _scanInitParamR->tableName.c_str());
         return navi::EC_ABORT;
     }
+    initProjectColumn();
     if (_batchSize == 0) {
         const auto &matchDocAllocator = _attributeExpressionCreatorR->_matchDocAllocator;
         uint32_t docSize = matchDocAllocator->getDocSize();
@@ -261,7 +264,7 @@ bool NormalScanR::doBatchScan(table::TablePtr &table, bool &eof) {
     eof = false;
     const auto &matchDocAllocator = _attributeExpressionCreatorR->_matchDocAllocator;
     if (_scanIter != NULL && _seekCount < _limit) {
-        uint32_t batchSize = _batchSize;
+        uint32_t batchSize = nextBatchSize();
         if (_limit > _seekCount) {
             batchSize = std::min(_limit - _seekCount, batchSize);
         }
@@ -309,7 +312,7 @@ bool NormalScanR::doBatchScan(table::TablePtr &table, bool &eof) {
     _scanInitParamR->incSeekTime(seekTimer.done_us());
 
     autil::ScopedTime2 evaluteTimer;
-    evaluateAttribute(matchDocs, matchDocAllocator, _attributeExpressionVec, eof);
+    evaluateAttribute(matchDocs, matchDocAllocator, _projectExpressionVec, eof);
     _scanInitParamR->incEvaluateTime(evaluteTimer.done_us());
 
     autil::ScopedTime2 outputTimer;
@@ -323,6 +326,11 @@ bool NormalScanR::doBatchScan(table::TablePtr &table, bool &eof) {
         _innerScanInfo.set_totalseekdoccount(_innerScanInfo.totalseekdoccount()
                                              + _scanIter->getTotalSeekDocCount());
         _innerScanInfo.set_usetruncate(_scanIter->useTruncate());
+        std::vector<std::string> reorderTraces;
+        _scanIter->collectReorderTraces(reorderTraces);
+        for (const auto &trace : reorderTraces) {
+            SQL_LOG(TRACE2, "query executor %s", trace.c_str());
+        }
         _scanIter.reset();
     }
     getInvertedTracers(_tracerMap);
@@ -352,9 +360,29 @@ bool NormalScanR::doUpdateScanQuery(const StreamQueryPtr &inputQuery) {
             WARN, "table [%s] create ha3 scan iterator failed", _scanInitParamR->tableName.c_str());
         return false;
     }
+    initProjectColumn();
     return true;
 }
 
+void NormalScanR::initProjectColumn() {
+    _projectExpressionVec.clear();
+    std::set<matchdoc::ReferenceBase *> materializedRefs;
+    if (_scanIter) {
+        for (auto expr : _scanIter->getMaterializedExpressions()) {
+            materializedRefs.insert(expr->getReferenceBase());
+        }
+    }
+    for (auto expr : _attributeExpressionVec) {
+        if (materializedRefs.count(expr->getReferenceBase()) > 0) {
+            SQL_LOG(TRACE2,
+                    "output column [%s] materialized by scan iterator, skip evaluate",
+                    expr->getOriginalString().c_str());
+            continue;
+        }
+        _projectExpressionVec.push_back(expr);
+    }
+}
+
 bool NormalScanR::initOutputColumn() {
     const auto &outputFields = _scanInitParamR->calcInitParamR->outputFields;
     const auto &outputFieldsType = _scanInitParamR->calcInitParamR->outputFieldsType;
@@ -449,6 +477,7 @@ bool NormalScanR::initOutputColumn() {
         }
         auto refer = expr->getReferenceBase();
         refer->setSerializeLevel(SL_ATTRIBUTE);
+        expr->setBatchSeekThreshold(_attrBatchSeekThreshold);
         _attributeExpressionVec.push_back(expr);
     }
     matchDocAllocator->extend();
@@ -100,6 +100,9 @@ private:
     void initNestTableJoinType();
     bool doBatchScan(table::TablePtr &table, bool &eof) override;
     bool doUpdateScanQuery(const StreamQueryPtr &inputQuery) override;
+    bool isDeterministic() const override {
+        return _attributeExpressionCreatorR->_attributeExpressionCreator->isDeterministic();
+    }
     std::shared_ptr<matchdoc::MatchDocAllocator>
     copyMatchDocAllocator(std::vector<matchdoc::MatchDoc> &matchDocVec,
                           const std::shared_ptr<matchdoc::MatchDocAllocator> &matchDocAllocator,
@@ -109,6 +112,7 @@ private:
     doCreateTable(std::shared_ptr<matchdoc::MatchDocAllocator> outputAllocator,
                   std::vector<matchdoc::MatchDoc> copyMatchDocs) override;
     bool initOutputColumn();
+    void initProjectColumn();
     bool copyField(const std::string &expr,
                    const std::string &outputName,
                    std::map<std::string, std::pair<std::string, bool>> &expr2Outputs);
@@ -153,8 +157,12 @@ private:
     RESOURCE_DEPEND_ON(UseSubR, _useSubR);
     navi::ResourceInitContext _ctx;
     bool _enableScanTimeout = true;
+    // output columns of a batch with at least this many docs are read column-wise, 0 disables
+    uint32_t _attrBatchSeekThreshold = DEFAULT_ATTR_BATCH_SEEK_THRESHOLD;
     std::map<std::string, std::string> _copyFieldMap;
     std::vector<suez::turing::AttributeExpression *> _attributeExpressionVec;
+    // output columns not yet materialized by the scan iterator, evaluated after limit
+    std::vector<suez::turing::AttributeExpression *> _projectExpressionVec;
     ScanIteratorPtr _scanIter;
     bool _isDocIdsOptimize = false;
     NestTableJoinType _nestTableJoinType = LEFT_JOIN;
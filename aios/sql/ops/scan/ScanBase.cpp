@@ -15,6 +15,7 @@
  */
 #include "sql/ops/scan/ScanBase.h"
 
+#include <algorithm>
 #include <engine/ResourceInitContext.h>
 #include <limits>
 #include <memory>
@@ -41,6 +42,7 @@
 #include "navi/log/NaviLogger.h"
 #include "navi/resource/GraphMemoryPoolR.h"
 #include "sql/common/Log.h"
+#include "sql/common/common.h"
 #include "sql/framework/PushDownOp.h"
 #include "sql/proto/SqlSearchInfo.pb.h"
 #include "sql/proto/SqlSearchInfoCollector.h"
@@ -138,6 +140,8 @@ ScanBase::ScanBase()
     , _scanOnce(true)
     , _pushDownMode(false)
     , _batchSize(0)
+    , _adaptiveBatchSize(false)
+    , _curBatchSize(0)
     , _limit(std::numeric_limits<uint32_t>::max())
     , _seekCount(0) {}
 
@@ -147,12 +151,23 @@ ScanBase::~ScanBase() {
 
 bool ScanBase::doInit() {
     _batchSize = _scanInitParamR->batchSize;
+    _adaptiveBatchSize = (_batchSize == 0);
     _limit = _scanInitParamR->limit;
     return true;
 }
 
 bool ScanBase::batchScan(table::TablePtr &table, bool &eof) {
     _scanInitParamR->incComputeTime();
+    if (getFromResultCache(table)) {
+        eof = true;
+        _scanInitParamR->scanInfo.set_resultcachehit(true);
+        _scanInitParamR->incTotalOutputCount(table->getRowCount());
+        if (_sqlSearchInfoCollectorR) {
+            _sqlSearchInfoCollectorR->getCollector()->overwriteScanInfo(_scanInitParamR->scanInfo);
+        }
+        onBatchScanFinish();
+        return true;
+    }
 
     autil::ScopedTime2 batchScanTimer;
     auto ret = doBatchScan(table, eof);
@@ -189,9 +204,63 @@ bool ScanBase::batchScan(table::TablePtr &table, bool &eof) {
             return false;
         }
     }
+    putToResultCache(table, eof);
     return true;
 }
 
+bool ScanBase::getFromResultCache(table::TablePtr &table) {
+    // only the first batch of a one-shot synchronous scan is eligible
+    if (!_sqlResultCacheR || !_sqlResultCacheR->isEnabled() || !_scanOnce || _asyncPipe
+        || _scanInitParamR->scanInfo.totalcomputetimes() != 1
+        || _scanInitParamR->resultCacheKey.empty() || _scanInitParamR->targetWatermark > 0
+        || !isDeterministic()) {
+        return false;
+    }
+    SqlResultCacheVersion version;
+    if (!_sqlResultCacheR->getTableVersion(_scanInitParamR->tableName, version)) {
+        return false;
+    }
+    auto data = _sqlResultCacheR->get(_scanInitParamR->resultCacheKey, version);
+    if (data) {
+        auto pool = _graphMemoryPoolR->getPool();
+        table = make_shared<Table>(pool);
+        table->deserializeFromString(*data, pool.get());
+        SQL_LOG(TRACE1,
+                "scan table [%s] hit result cache, row count [%lu]",
+                _scanInitParamR->tableName.c_str(),
+                table->getRowCount());
+        return true;
+    }
+    _resultCacheVersion = version;
+    return false;
+}
+
+void ScanBase::putToResultCache(const table::TablePtr &table, bool eof) {
+    if (_resultCacheVersion.versionId < 0) {
+        return;
+    }
+    SqlResultCacheVersion expectVersion = _resultCacheVersion;
+    _resultCacheVersion = SqlResultCacheVersion();
+    if (!eof || !table || !_scanOnce) {
+        // streaming or multi-batch output is not cached
+        return;
+    }
+    // push down calc creates its expressions while computing, check them after the scan
+    if (!isDeterministic() || (_scanPushDownR && !_scanPushDownR->isDeterministic())) {
+        return;
+    }
+    // skip the fill if the tablet switched version while scanning, the entry is tagged with
+    // the watermark seen before the scan so its staleness is never underestimated
+    SqlResultCacheVersion version;
+    if (!_sqlResultCacheR->getTableVersion(_scanInitParamR->tableName, version)
+        || version.versionId != expectVersion.versionId) {
+        return;
+    }
+    string data;
+    table->serializeToString(data, _graphMemoryPoolR->getPool().get());
+    _sqlResultCacheR->put(_scanInitParamR->resultCacheKey, expectVersion, std::move(data));
+}
+
 bool ScanBase::updateScanQuery(const StreamQueryPtr &inputQuery) {
     autil::ScopedTime2 updateScanQueryTimer;
     auto ret = doUpdateScanQuery(inputQuery);
@@ -250,6 +319,30 @@ table::TablePtr ScanBase::doCreateTable(matchdoc::MatchDocAllocatorPtr outputAll
     return make_shared<Table>(copyMatchDocs, outputAllocator);
 }
 
+uint32_t ScanBase::nextBatchSize() {
+    if (!_adaptiveBatchSize) {
+        return _batchSize;
+    }
+    // a kernel is only scheduled again after downstream took its last output, so every
+    // call here means the previous batch was consumed and the next one may grow
+    bool shrink = false;
+    if (_curBatchSize == 0) {
+        // a pending result cache fill only keeps a scan whose first batch hits eof, so
+        // that batch takes the full size instead of starting small
+        _curBatchSize = _resultCacheVersion.versionId >= 0
+                            ? _batchSize
+                            : std::min(DEFAULT_INIT_BATCH_COUNT, _batchSize);
+    } else if (_queryMemPoolR->getPool()->getAllocatedSize() >= MAX_SQL_POOL_SIZE / 2) {
+        uint32_t minBatchSize = std::min(MIN_ADAPTIVE_BATCH_COUNT, _batchSize);
+        shrink = _curBatchSize > minBatchSize;
+        _curBatchSize = std::max(_curBatchSize / 2, minBatchSize);
+    } else if (_curBatchSize < _batchSize) {
+        _curBatchSize = _curBatchSize > _batchSize / 2 ? _batchSize : _curBatchSize * 2;
+    }
+    _scanInitParamR->updateBatchSize(_curBatchSize, shrink);
+    return _curBatchSize;
+}
+
 bool ScanBase::initAsyncPipe(navi::ResourceInitContext &ctx) {
     auto asyncPipe = ctx.createRequireKernelAsyncPipe();
     if (!asyncPipe) {
@@ -28,6 +28,7 @@
 #include "sql/proto/SqlSearchInfo.pb.h"
 #include "sql/proto/SqlSearchInfoCollectorR.h"
 #include "sql/resource/QueryMetricReporterR.h"
+#include "sql/resource/SqlResultCacheR.h"
 #include "sql/resource/TimeoutTerminatorR.h"
 #include "suez/turing/navi/QueryMemPoolR.h"
 
@@ -76,6 +77,7 @@ protected:
                 const std::shared_ptr<matchdoc::MatchDocAllocator> &matchDocAllocator,
                 bool reuseMatchDocAllocator);
     bool initAsyncPipe(navi::ResourceInitContext &ctx);
+    uint32_t nextBatchSize();
     void setAsyncPipe(const std::shared_ptr<navi::AsyncPipe> &asyncPipe) {
         _asyncPipe = asyncPipe;
     }
@@ -87,6 +89,10 @@ private:
     virtual bool doUpdateScanQuery(const StreamQueryPtr &inputQuery) {
         return false;
     }
+    // scan output only depends on the table data, required by the result cache
+    virtual bool isDeterministic() const {
+        return false;
+    }
     virtual std::shared_ptr<matchdoc::MatchDocAllocator>
     copyMatchDocAllocator(std::vector<matchdoc::MatchDoc> &matchDocVec,
                           const std::shared_ptr<matchdoc::MatchDocAllocator> &matchDocAllocator,
@@ -96,6 +102,8 @@ private:
     doCreateTable(std::shared_ptr<matchdoc::MatchDocAllocator> outputAllocator,
                   std::vector<matchdoc::MatchDoc> copyMatchDocs);
 
+    bool getFromResultCache(std::shared_ptr<table::Table> &table);
+    void putToResultCache(const std::shared_ptr<table::Table> &table, bool eof);
     void reportBaseMetrics();
     virtual void onBatchScanFinish() {}
     virtual void reportFinishMetrics() {}
@@ -118,10 +126,15 @@ protected:
     RESOURCE_DEPEND_ON(QueryMetricReporterR, _queryMetricReporterR);
     RESOURCE_DEPEND_ON(suez::turing::QueryMemPoolR, _queryMemPoolR);
     RESOURCE_DEPEND_ON(TimeoutTerminatorR, _timeoutTerminatorR);
+    RESOURCE_DEPEND_ON_FALSE(SqlResultCacheR, _sqlResultCacheR);
     // optional
     bool _scanOnce;
     bool _pushDownMode;
     uint32_t _batchSize;
+    // batch size was not fixed by the plan, batches grow from a small first batch up to
+    // _batchSize and shrink under query memory pressure
+    bool _adaptiveBatchSize;
+    uint32_t _curBatchSize;
     uint32_t _limit;
     uint32_t _seekCount; // statistics
     // for lifetime
@@ -129,6 +142,8 @@ protected:
     std::string _tableMeta;
     ScanPushDownR *_scanPushDownR = nullptr;
     std::shared_ptr<navi::AsyncPipe> _asyncPipe;
+    // version the scan result is cached under, invalid if the scan is not cacheable
+    SqlResultCacheVersion _resultCacheVersion;
 };
 
 typedef std::shared_ptr<ScanBase> ScanBasePtr;
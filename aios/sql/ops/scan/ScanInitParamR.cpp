@@ -19,10 +19,13 @@
 #include <cstdint>
 #include <engine/NaviConfigContext.h>
 #include <limits>
+#include <set>
 
 #include "autil/EnvUtil.h"
 #include "autil/HashAlgorithm.h"
 #include "autil/legacy/exception.h"
+#include "autil/legacy/fast_jsonizable.h"
+#include "iquan/common/Common.h"
 #include "navi/builder/ResourceDefBuilder.h"
 #include "navi/engine/Resource.h"
 #include "navi/proto/KernelDef.pb.h"
@@ -142,6 +145,7 @@ bool ScanInitParamR::config(navi::ResourceConfigContext &ctx) {
         KernelUtil::stripName(fieldInfos);
         KernelUtil::stripName(usedFields);
         KernelUtil::stripName(hashFields);
+        initResultCacheKey(ctx);
     } catch (const autil::legacy::ExceptionBase &e) {
         SQL_LOG(ERROR, "scanInitParam init failed error:[%s].", e.what());
         return false;
@@ -172,6 +176,43 @@ navi::ErrorCode ScanInitParamR::init(navi::ResourceInitContext &ctx) {
     return navi::EC_NONE;
 }
 
+void ScanInitParamR::initResultCacheKey(navi::ResourceConfigContext &ctx) {
+    resultCacheKey.clear();
+    auto scanHintMap = getScanHintMap();
+    bool disableResultCache = false;
+    if (scanHintMap && fromHint(*scanHintMap, "disableResultCache", disableResultCache)
+        && disableResultCache) {
+        return;
+    }
+    // plan transform patches these into json attrs per query, they don't change the scan output
+    static const std::set<std::string> patchKeys = {IQUAN_OP_ID,
+                                                    SCAN_TARGET_WATERMARK,
+                                                    SCAN_TARGET_WATERMARK_TYPE,
+                                                    iquan::IQUAN_EXEC_ATTR_SOURCE_SPEC};
+    auto *jsonAttrs = ctx.getJsonAttrs();
+    if (jsonAttrs && jsonAttrs->IsObject()) {
+        for (auto iter = jsonAttrs->MemberBegin(); iter != jsonAttrs->MemberEnd(); ++iter) {
+            std::string key(iter->name.GetString(), iter->name.GetStringLength());
+            if (patchKeys.count(key) > 0) {
+                continue;
+            }
+            appendResultCacheKey(key, autil::legacy::FastToJsonString(iter->value));
+        }
+    }
+    // integer attrs only carry per query patches, leave them out
+    for (const auto &pair : ctx.getBinaryAttrs()) {
+        appendResultCacheKey(pair.first, pair.second);
+    }
+}
+
+void ScanInitParamR::appendResultCacheKey(const std::string &key, const std::string &value) {
+    resultCacheKey.append(key);
+    resultCacheKey.append(1, ':');
+    resultCacheKey.append(autil::StringUtil::toString(value.size()));
+    resultCacheKey.append(1, ':');
+    resultCacheKey.append(value);
+}
+
 const std::map<std::string, std::string> *ScanInitParamR::getScanHintMap() const {
     auto it = hintsMap.find(SQL_SCAN_HINT);
     if (it == hintsMap.end()) {
@@ -298,6 +339,16 @@ void ScanInitParamR::incDegradedDocsCount(int64_t count) {
     scanInfo.set_degradeddocscount(scanInfo.degradeddocscount() + count);
 }
 
+void ScanInitParamR::updateBatchSize(uint32_t batchSize, bool shrink) {
+    if (scanInfo.firstbatchsize() == 0) {
+        scanInfo.set_firstbatchsize(batchSize);
+    }
+    scanInfo.set_maxbatchsize(std::max(scanInfo.maxbatchsize(), batchSize));
+    if (shrink) {
+        scanInfo.set_batchshrinktimes(scanInfo.batchshrinktimes() + 1);
+    }
+}
+
 REGISTER_RESOURCE(ScanInitParamR);
 
 } // namespace sql
@@ -115,6 +115,8 @@ public:
         return autil::StringUtil::fromString(it->second, val);
     }
     void patchHintInfo();
+    void initResultCacheKey(navi::ResourceConfigContext &ctx);
+    void appendResultCacheKey(const std::string &key, const std::string &value);
     const std::map<std::string, std::string> *getScanHintMap() const;
 
 public:
@@ -132,6 +134,7 @@ public:
     void updateDurationTime(int64_t time);
     void updateExtraInfo(const std::string &info);
     void incDegradedDocsCount(int64_t count);
+    void updateBatchSize(uint32_t batchSize, bool shrink);
 
 private:
     RESOURCE_DEPEND_DECLARE();
@@ -176,6 +179,8 @@ public:
     std::string aggValueField;
     bool aggDistinct = false;
     std::map<std::string, std::pair<std::string, std::string>> aggRangeMap;
+    // identifies the scan subplan with bound params, empty if the scan can not be cached
+    std::string resultCacheKey;
 };
 
 NAVI_TYPEDEF_PTR(ScanInitParamR);
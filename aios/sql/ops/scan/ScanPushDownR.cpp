@@ -153,6 +153,15 @@ void ScanPushDownR::setMatchInfo(
     }
 }
 
+bool ScanPushDownR::isDeterministic() const {
+    for (const auto &pushDown : _pushDownOps) {
+        if (!pushDown->isDeterministic()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool ScanPushDownR::compute(table::TablePtr &table, bool &eof) const {
     for (size_t i = 0; i < _pushDownOps.size(); ++i) {
         if (!_pushDownOps[i]->compute(table, eof)) {
@@ -67,6 +67,7 @@ public:
                       const suez::turing::IndexInfoHelper *indexInfoHelper,
                       const std::shared_ptr<indexlib::index::InvertedIndexReader> &indexReader);
     bool compute(table::TablePtr &table, bool &eof) const;
+    bool isDeterministic() const;
 
 private:
     bool initPushDownOp(navi::ResourceInitContext &ctx, navi::KernelConfigContext &pushDownOpsCtx);
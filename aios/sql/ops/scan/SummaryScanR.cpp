@@ -22,6 +22,7 @@
 #include <ext/alloc_traits.h>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <unordered_set>
 #include <utility>
 
@@ -455,24 +456,46 @@ bool SummaryScanR::convertPK2DocId(const std::vector<string> &pks) {
         pkIndexReaders.emplace_back(primaryKeyReader);
     }
     int tableSize = pkIndexReaders.size();
-    _docIds.clear();
-    _tableIdx.clear();
-    for (const auto &pk : pks) {
-        for (int i = 0; i < tableSize; ++i) {
-            docid_t docId = INVALID_DOCID;
-            try {
-                docId = pkIndexReaders[i]->Lookup(pk);
-            } catch (...) {
-                SQL_LOG(ERROR, "primary key index lookup fail for key %s", pk.c_str());
-                return false;
+    // each table resolves the pks not found in previous tables with one batch lookup
+    std::vector<docid_t> pkDocIds(pks.size(), INVALID_DOCID);
+    std::vector<int> pkTableIdx(pks.size(), -1);
+    std::vector<size_t> pendingPos(pks.size());
+    std::iota(pendingPos.begin(), pendingPos.end(), 0);
+    std::vector<string> pendingPks = pks;
+    std::vector<docid_t> foundDocIds;
+    for (int i = 0; i < tableSize && !pendingPos.empty(); ++i) {
+        try {
+            pkIndexReaders[i]->BatchLookup(pendingPks, &foundDocIds);
+        } catch (...) {
+            SQL_LOG(ERROR,
+                    "primary key index batch lookup fail for keys %s",
+                    StringUtil::toString(pendingPks).c_str());
+            return false;
+        }
+        size_t stillPending = 0;
+        for (size_t j = 0; j < pendingPos.size(); ++j) {
+            if (foundDocIds[j] != INVALID_DOCID) {
+                pkDocIds[pendingPos[j]] = foundDocIds[j];
+                pkTableIdx[pendingPos[j]] = i;
+                continue;
             }
-            if (docId != INVALID_DOCID) {
-                _docIds.emplace_back(docId);
-                _tableIdx.emplace_back(i);
-                break;
-            } else {
-                SQL_LOG(DEBUG, "can not find primary key %s", pk.c_str());
+            if (stillPending != j) {
+                pendingPks[stillPending] = std::move(pendingPks[j]);
+                pendingPos[stillPending] = pendingPos[j];
             }
+            ++stillPending;
+        }
+        pendingPks.resize(stillPending);
+        pendingPos.resize(stillPending);
+    }
+    _docIds.clear();
+    _tableIdx.clear();
+    for (size_t j = 0; j < pks.size(); ++j) {
+        if (pkDocIds[j] != INVALID_DOCID) {
+            _docIds.emplace_back(pkDocIds[j]);
+            _tableIdx.emplace_back(pkTableIdx[j]);
+        } else {
+            SQL_LOG(DEBUG, "can not find primary key %s", pks[j].c_str());
         }
     }
     SQL_LOG(TRACE3,
@@ -85,6 +85,9 @@ public:
 private:
     bool doBatchScan(table::TablePtr &table, bool &eof) override;
     bool doUpdateScanQuery(const StreamQueryPtr &inputQuery) override;
+    bool isDeterministic() const override {
+        return _attributeExpressionCreatorR->_attributeExpressionCreator->isDeterministic();
+    }
     void initSummary();
     void initExtraSummary();
     bool genDocIdFromRawPks(std::vector<std::string> pks);
@@ -57,12 +57,18 @@ AUTIL_LOG_SETUP(sql, DocIdRangesReduceOptimize);
 DocIdRangesReduceOptimize::DocIdRangesReduceOptimize(
     const std::vector<suez::SortDescription> &sortDescs,
     const std::map<std::string, FieldInfo> &fieldInfos)
-    : _fieldInfos(fieldInfos) {
+    : _acceptAllKeys(false)
+    , _fieldInfos(fieldInfos) {
     for (const auto &sortDesc : sortDescs) {
         _keyVec.push_back(sortDesc.field);
     }
 }
 
+DocIdRangesReduceOptimize::DocIdRangesReduceOptimize(
+    const std::map<std::string, FieldInfo> &fieldInfos)
+    : _acceptAllKeys(true)
+    , _fieldInfos(fieldInfos) {}
+
 DocIdRangesReduceOptimize::~DocIdRangesReduceOptimize() {}
 
 void DocIdRangesReduceOptimize::visitAndCondition(AndCondition *condition) {
@@ -174,7 +180,7 @@ void DocIdRangesReduceOptimize::tryAddKeyRange(const SimpleValue &attr,
         return;
     }
     const string &attrName = SqlJsonUtil::getColumnName(attr);
-    if (std::count(_keyVec.begin(), _keyVec.end(), attrName) == 0) {
+    if (!_acceptAllKeys && std::count(_keyVec.begin(), _keyVec.end(), attrName) == 0) {
         SQL_LOG(TRACE3, "attr [%s] not found in sort desc", attrName.c_str());
         return;
     }
@@ -253,13 +259,7 @@ isearch::search::LayerMetaPtr DocIdRangesReduceOptimize::reduceDocIdRange(
     isearch::search::IndexPartitionReaderWrapperPtr &readerPtr) {
     const indexlib::table::DimensionDescriptionVector &dimens = convertDimens();
     SQL_LOG(DEBUG, "after convert to dimentions, dimens : %s", toDebugString(dimens).c_str());
-    isearch::search::LayerMetaPtr layerMeta(new isearch::search::LayerMeta(pool));
-    layerMeta->quota = lastRange->quota;
-    layerMeta->maxQuota = lastRange->maxQuota;
-    layerMeta->quotaMode = lastRange->quotaMode;
-    layerMeta->needAggregate = lastRange->needAggregate;
-    layerMeta->quotaType = lastRange->quotaType;
-
+    isearch::search::LayerMetaPtr layerMeta = createEmptyLayerMeta(lastRange, pool);
     for (size_t i = 0; i < lastRange->size(); ++i) {
         if ((*lastRange)[i].ordered != isearch::search::DocIdRangeMeta::OT_ORDERED) {
             layerMeta->push_back((*lastRange)[i]);
@@ -284,4 +284,54 @@ isearch::search::LayerMetaPtr DocIdRangesReduceOptimize::reduceDocIdRange(
     return layerMeta;
 }
 
+isearch::search::LayerMetaPtr DocIdRangesReduceOptimize::pruneDocIdRangeByZoneMap(
+    const isearch::search::LayerMetaPtr &lastRange,
+    autil::mem_pool::Pool *pool,
+    isearch::search::IndexPartitionReaderWrapperPtr &readerPtr) {
+    indexlib::table::DimensionDescriptionVector dimens;
+    for (const auto &k2r : _key2keyRange) {
+        auto dimen = k2r.second->convertDimenDescription();
+        if (dimen) {
+            dimens.emplace_back(std::move(dimen));
+        }
+    }
+    if (dimens.empty()) {
+        return lastRange;
+    }
+    SQL_LOG(DEBUG, "zone map prune dimens : %s", toDebugString(dimens).c_str());
+    isearch::search::LayerMetaPtr layerMeta = createEmptyLayerMeta(lastRange, pool);
+    bool pruned = false;
+    for (size_t i = 0; i < lastRange->size(); ++i) {
+        const auto &rangeMeta = (*lastRange)[i];
+        indexlib::DocIdRange rangeLimit(rangeMeta.begin, rangeMeta.end + 1);
+        indexlib::DocIdRangeVector resultRanges;
+        if (rangeLimit.second <= rangeLimit.first
+            || !readerPtr->getZoneMapDocIdRanges(dimens, rangeLimit, resultRanges)) {
+            layerMeta->push_back(rangeMeta);
+            continue;
+        }
+        pruned = true;
+        for (const auto &resultRange : resultRanges) {
+            isearch::search::DocIdRangeMeta prunedMeta(
+                resultRange.first, resultRange.second - 1, rangeMeta.ordered);
+            if (prunedMeta.begin <= prunedMeta.end) {
+                layerMeta->push_back(prunedMeta);
+            }
+        }
+    }
+    return pruned ? layerMeta : lastRange;
+}
+
+isearch::search::LayerMetaPtr
+DocIdRangesReduceOptimize::createEmptyLayerMeta(const isearch::search::LayerMetaPtr &lastRange,
+                                                autil::mem_pool::Pool *pool) {
+    isearch::search::LayerMetaPtr layerMeta(new isearch::search::LayerMeta(pool));
+    layerMeta->quota = lastRange->quota;
+    layerMeta->maxQuota = lastRange->maxQuota;
+    layerMeta->quotaMode = lastRange->quotaMode;
+    layerMeta->needAggregate = lastRange->needAggregate;
+    layerMeta->quotaType = lastRange->quotaType;
+    return layerMeta;
+}
+
 } // namespace sql
@@ -53,6 +53,8 @@ class DocIdRangesReduceOptimize : public ConditionVisitor {
 public:
     DocIdRangesReduceOptimize(const std::vector<suez::SortDescription> &sortDescs,
                               const std::map<std::string, FieldInfo> &fieldInfos);
+    // collects ranges of all attributes instead of sort keys, for zone map pruning
+    explicit DocIdRangesReduceOptimize(const std::map<std::string, FieldInfo> &fieldInfos);
     ~DocIdRangesReduceOptimize();
 
 public:
@@ -64,6 +66,10 @@ public:
     reduceDocIdRange(const isearch::search::LayerMetaPtr &lastRange,
                      autil::mem_pool::Pool *pool,
                      isearch::search::IndexPartitionReaderWrapperPtr &readerPtr);
+    isearch::search::LayerMetaPtr
+    pruneDocIdRangeByZoneMap(const isearch::search::LayerMetaPtr &lastRange,
+                             autil::mem_pool::Pool *pool,
+                             isearch::search::IndexPartitionReaderWrapperPtr &readerPtr);
 
 private:
     void swapKey2KeyRange(std::unordered_map<std::string, KeyRangeBasePtr> &other) {
@@ -78,10 +84,14 @@ private:
                                          const std::string &op,
                                          const autil::SimpleValue &value);
     indexlib::table::DimensionDescriptionVector convertDimens();
+    static isearch::search::LayerMetaPtr
+    createEmptyLayerMeta(const isearch::search::LayerMetaPtr &lastRange,
+                         autil::mem_pool::Pool *pool);
     std::string toDebugString(const indexlib::table::DimensionDescriptionVector &dimens);
 
 private:
     std::vector<std::string> _keyVec;
+    bool _acceptAllKeys;
     const std::map<std::string, FieldInfo> &_fieldInfos;
     std::unordered_map<std::string, KeyRangeBasePtr> _key2keyRange;
     AUTIL_LOG_DECLARE();
@@ -66,6 +66,10 @@ uint32_t Ha3ScanIterator::getTotalScanCount() {
     return _singleLayerSearcher->getSeekTimes();
 }
 
+void Ha3ScanIterator::collectReorderTraces(std::vector<std::string> &traces) const {
+    _queryExecutor->collectReorderTraces(traces);
+}
+
 uint32_t Ha3ScanIterator::getTotalSeekDocCount() {
     return _singleLayerSearcher->getSeekDocCount();
 }
@@ -79,6 +79,7 @@ public:
     bool useTruncate() override;
     uint32_t getTotalScanCount() override;
     uint32_t getTotalSeekDocCount() override;
+    void collectReorderTraces(std::vector<std::string> &traces) const override;
 
 private:
     bool _needSubDoc;
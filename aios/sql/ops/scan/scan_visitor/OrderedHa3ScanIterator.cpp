@@ -15,11 +15,13 @@
  */
 #include "sql/ops/scan/OrderedHa3ScanIterator.h"
 
+#include <algorithm>
 #include <assert.h>
 #include <ext/alloc_traits.h>
 #include <iosfwd>
 #include <memory>
 
+#include "autil/StringUtil.h"
 #include "autil/mem_pool/PoolBase.h"
 #include "autil/mem_pool/PoolVector.h"
 #include "autil/result/Errors.h"
@@ -42,6 +44,7 @@
 #include "sql/ops/scan/MatchDocComparatorCreator.h"
 #include "sql/ops/scan/ScanIterator.h"
 #include "sql/ops/sort/SortInitParam.h"
+#include "suez/sdk/TableDefConfig.h"
 #include "suez/turing/expression/common.h"
 #include "suez/turing/expression/framework/AttributeExpression.h"
 #include "suez/turing/expression/framework/AttributeExpressionCreator.h"
@@ -82,7 +85,8 @@ OrderedHa3ScanIterator::OrderedHa3ScanIterator(
     , _layerMetas(param.layerMetas)
     , _matchDataCollectorCenter(nullptr)
     , _attributeExpressionCreator(attributeExpressionCreator)
-    , _comp(nullptr) {
+    , _comp(nullptr)
+    , _earlyTerminatedLayerCount(0) {
     if (param.matchDataManager) {
         _matchDataCollectorCenter = &param.matchDataManager->getMatchDataCollectorCenter();
     }
@@ -106,6 +110,7 @@ OrderedHa3ScanIterator::OrderedHa3ScanIterator(
             assert(false);
         }
     }
+    _orderedLayerDocCounts.resize(_orderedSingleLayerSearcher.size(), 0);
     SQL_LOG(TRACE2,
             "order single layer searcher [%lu], unordered single layer searcher [%lu]",
             _orderedSingleLayerSearcher.size(),
@@ -149,12 +154,40 @@ uint32_t OrderedHa3ScanIterator::getTotalScanCount() {
     return totalScanCount;
 }
 
+bool OrderedHa3ScanIterator::matchTableSortDescription(
+    const SortInitParam &sortDesc, const vector<suez::SortDescription> &tableSortDescs) {
+    if (sortDesc.keys.empty() || sortDesc.keys.size() > tableSortDescs.size()
+        || sortDesc.keys.size() != sortDesc.orders.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < sortDesc.keys.size(); ++i) {
+        const auto &tableSortDesc = tableSortDescs[i];
+        if (sortDesc.keys[i] != tableSortDesc.field) {
+            return false;
+        }
+        // indexlib sorts desc when the pattern is not set
+        string order = tableSortDesc.order;
+        autil::StringUtil::toUpperCase(order);
+        bool tableDesc = order != "ASC";
+        if (sortDesc.orders[i] != tableDesc) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Result<bool> OrderedHa3ScanIterator::batchSeek(size_t batchSize, vector<MatchDoc> &matchDocs) {
-    // build sort desc
-    // unordered seek to build docs priority queue with sort desc
+    MatchDocComparatorCreator matchDocComparatorCreator(_pool, _matchDocAllocator.get());
+    _comp = matchDocComparatorCreator.createComparator(_refNames, _orders);
+    AR_REQUIRE_TRUE(_comp, RuntimeError::make("create sort comparator failed"));
+    MatchDocPriorityQueue docPriorityQueue(_sortLimit, _pool, _comp);
+
+    // unordered seek to build docs priority queue with sort desc, docs are pushed in batches so
+    // that only the queue and one batch are alive at a time
     MatchDoc doc;
     indexlib::index::ErrorCode ec;
     vector<MatchDoc> tmpMatchDocs;
+    tmpMatchDocs.reserve(min(UNORDERED_BATCH_SIZE, max(_sortLimit, (size_t)1)));
     for (auto singleLayerSearcher : _unorderedSingleLayerSearcher) {
         while (true) {
             ec = singleLayerSearcher->seek(_needSubDoc, doc);
@@ -165,22 +198,15 @@ Result<bool> OrderedHa3ScanIterator::batchSeek(size_t batchSize, vector<MatchDoc
                 break;
             }
             tmpMatchDocs.emplace_back(doc);
+            if (tmpMatchDocs.size() >= UNORDERED_BATCH_SIZE) {
+                pushUnorderedDocs(tmpMatchDocs, docPriorityQueue);
+            }
         }
     }
-    for (auto attr : _sortDescExpr) {
-        attr->batchEvaluate(tmpMatchDocs.data(), tmpMatchDocs.size());
-    }
-    MatchDocComparatorCreator matchDocComparatorCreator(_pool, _matchDocAllocator.get());
-    _comp = matchDocComparatorCreator.createComparator(_refNames, _orders);
-    AR_REQUIRE_TRUE(_comp, RuntimeError::make("create sort comparator failed"));
-    MatchDocPriorityQueue docPriorityQueue(_sortLimit, _pool, _comp);
-    MatchDoc tmpDoc = matchdoc::INVALID_MATCHDOC;
-    ;
-    for (auto doc : tmpMatchDocs) {
-        docPriorityQueue.push(doc, &tmpDoc);
-    }
+    pushUnorderedDocs(tmpMatchDocs, docPriorityQueue);
 
     // build ordered singleLayerSearcher priority queue
+    MatchDoc tmpDoc = matchdoc::INVALID_MATCHDOC;
     RangePriorityQueueType rangePriorityQueue((RangeComp(_comp)));
     for (size_t i = 0; i < _orderedSingleLayerSearcher.size(); ++i) {
         if (!seekAndPushQueue(i, rangePriorityQueue)) {
@@ -190,14 +216,29 @@ Result<bool> OrderedHa3ScanIterator::batchSeek(size_t batchSize, vector<MatchDoc
     // update docs queue
     while (!rangePriorityQueue.empty()) {
         auto pair = rangePriorityQueue.top();
-        if (MatchDocPriorityQueue::ITEM_DENIED == docPriorityQueue.push(pair.first, &tmpDoc)) {
+        auto ret = docPriorityQueue.push(pair.first, &tmpDoc);
+        if (MatchDocPriorityQueue::ITEM_DENIED == ret) {
             break;
         }
+        if (MatchDocPriorityQueue::ITEM_REPLACED == ret) {
+            _matchDocAllocator->deallocate(tmpDoc);
+        }
         rangePriorityQueue.pop();
         if (!seekAndPushQueue(pair.second, rangePriorityQueue)) {
             return false;
         }
     }
+    // release range heads that can not enter top k
+    _earlyTerminatedLayerCount += rangePriorityQueue.size();
+    while (!rangePriorityQueue.empty()) {
+        _matchDocAllocator->deallocate(rangePriorityQueue.top().first);
+        rangePriorityQueue.pop();
+    }
+    SQL_LOG(TRACE2,
+            "ordered layers [%lu], early terminated layers [%lu], top k [%lu]",
+            _orderedSingleLayerSearcher.size(),
+            _earlyTerminatedLayerCount,
+            _sortLimit);
     // output sorted docPriorityQueue
     int64_t docSize = docPriorityQueue.count();
     _matchDocs.resize(docSize);
@@ -205,19 +246,41 @@ Result<bool> OrderedHa3ScanIterator::batchSeek(size_t batchSize, vector<MatchDoc
         _matchDocs[i] = docPriorityQueue.top();
         docPriorityQueue.pop();
     }
-    // TODO delete tmp doc
     matchDocs.insert(matchDocs.begin(), _matchDocs.begin(), _matchDocs.end());
     return true;
 }
 
+void OrderedHa3ScanIterator::pushUnorderedDocs(vector<MatchDoc> &docs,
+                                               MatchDocPriorityQueue &docPriorityQueue) {
+    if (docs.empty()) {
+        return;
+    }
+    for (auto attr : _sortDescExpr) {
+        attr->batchEvaluate(docs.data(), docs.size());
+    }
+    MatchDoc tmpDoc = matchdoc::INVALID_MATCHDOC;
+    for (auto doc : docs) {
+        if (MatchDocPriorityQueue::ITEM_ACCEPTED != docPriorityQueue.push(doc, &tmpDoc)) {
+            _matchDocAllocator->deallocate(tmpDoc);
+        }
+    }
+    docs.clear();
+}
+
 bool OrderedHa3ScanIterator::seekAndPushQueue(size_t i,
                                               RangePriorityQueueType &rangePriorityQueue) {
+    if (_orderedLayerDocCounts[i] >= _sortLimit) {
+        // every later doc of the layer sorts behind the k docs it already gave
+        ++_earlyTerminatedLayerCount;
+        return true;
+    }
     MatchDoc doc;
     indexlib::index::ErrorCode ec = _orderedSingleLayerSearcher[i]->seek(_needSubDoc, doc);
     if (ec != indexlib::index::ErrorCode::OK) {
         return false;
     }
     if (matchdoc::INVALID_MATCHDOC != doc) {
+        ++_orderedLayerDocCounts[i];
         for (auto attr : _sortDescExpr) {
             attr->evaluate(doc);
         }
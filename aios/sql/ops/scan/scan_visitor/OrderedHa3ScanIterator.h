@@ -46,6 +46,7 @@ class DeletionMapReaderAdaptor;
 } // namespace indexlib
 
 namespace suez {
+class SortDescription;
 namespace turing {
 class AttributeExpression;
 class AttributeExpressionCreator;
@@ -53,6 +54,9 @@ class AttributeExpressionCreator;
 } // namespace suez
 
 namespace isearch {
+namespace rank {
+class MatchDocPriorityQueue;
+} // namespace rank
 namespace search {
 class MatchDataCollectorCenter;
 } // namespace search
@@ -76,6 +80,18 @@ public:
     autil::Result<bool> batchSeek(size_t batchSize,
                                   std::vector<matchdoc::MatchDoc> &matchDocs) override;
     uint32_t getTotalScanCount() override;
+    const std::vector<suez::turing::AttributeExpression *> &
+    getMaterializedExpressions() const override {
+        return _sortDescExpr;
+    }
+    // ordered layers left before their end because no remaining doc could enter top k
+    size_t getEarlyTerminatedLayerCount() const {
+        return _earlyTerminatedLayerCount;
+    }
+    // docs of ordered layers are only merged as sorted runs when the sort keys are a prefix
+    // of the table sort description with the same directions
+    static bool matchTableSortDescription(const SortInitParam &sortDesc,
+                                          const std::vector<suez::SortDescription> &tableSortDescs);
 
     class RangeComp {
     public:
@@ -98,6 +114,11 @@ public:
 
 private:
     bool seekAndPushQueue(size_t i, RangePriorityQueueType &rangePriorityQueue);
+    void pushUnorderedDocs(std::vector<matchdoc::MatchDoc> &docs,
+                           isearch::rank::MatchDocPriorityQueue &docPriorityQueue);
+
+private:
+    static constexpr size_t UNORDERED_BATCH_SIZE = 1024;
 
 private:
     autil::mem_pool::Pool *_pool;
@@ -118,6 +139,9 @@ private:
     std::vector<isearch::search::SingleLayerSearcherPtr> _unorderedSingleLayerSearcher;
     suez::turing::AttributeExpressionCreator *_attributeExpressionCreator;
     isearch::rank::Comparator *_comp;
+    // docs taken from each ordered layer, a layer never contributes more than top k docs
+    std::vector<size_t> _orderedLayerDocCounts;
+    size_t _earlyTerminatedLayerCount;
 
 private:
     AUTIL_LOG_DECLARE();
@@ -164,6 +164,10 @@ bool QueryScanIterator::moveToCorrectRange(docid_t &docId) {
     return false;
 }
 
+void QueryScanIterator::collectReorderTraces(std::vector<std::string> &traces) const {
+    _queryExecutor->collectReorderTraces(traces);
+}
+
 uint32_t QueryScanIterator::getTotalSeekDocCount() {
     return _queryExecutor->getSeekDocCount();
 }
@@ -63,6 +63,7 @@ public:
     autil::Result<bool> batchSeek(size_t batchSize,
                                   std::vector<matchdoc::MatchDoc> &matchDocs) override;
     uint32_t getTotalSeekDocCount() override;
+    void collectReorderTraces(std::vector<std::string> &traces) const override;
 
 private:
     inline bool tryToMakeItInRange(docid_t &docId);
@@ -18,6 +18,7 @@
 #include <memory>
 #include <stddef.h>
 #include <stdint.h>
+#include <string>
 #include <vector>
 
 #include "autil/result/Result.h"
@@ -27,6 +28,11 @@
 namespace matchdoc {
 class MatchDoc;
 } // namespace matchdoc
+namespace suez {
+namespace turing {
+class AttributeExpression;
+} // namespace turing
+} // namespace suez
 
 namespace sql {
 
@@ -59,6 +65,15 @@ public:
     virtual uint32_t getTotalSeekDocCount() {
         return _totalSeekDocCount;
     }
+    // child reorder decisions made by the query executor while seeking
+    virtual void collectReorderTraces(std::vector<std::string> &traces) const {}
+    // expressions whose values are already stored in every doc returned by batchSeek,
+    // the scan skips evaluating them again when projecting output columns
+    virtual const std::vector<suez::turing::AttributeExpression *> &
+    getMaterializedExpressions() const {
+        static const std::vector<suez::turing::AttributeExpression *> empty;
+        return empty;
+    }
     bool isTimeout() const {
         if (_isTimeout) {
             return true;
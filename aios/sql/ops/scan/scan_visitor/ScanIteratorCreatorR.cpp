@@ -160,6 +160,13 @@ navi::ErrorCode ScanIteratorCreatorR::init(navi::ResourceInitContext &ctx) {
     } else {
         SQL_LOG(DEBUG, "not find table [%s] sort description", tableName.c_str());
     }
+    if (condition) {
+        DocIdRangesReduceOptimize zoneMapOptimize(_scanInitParamR->fieldInfos);
+        condition->accept(&zoneMapOptimize);
+        layerMeta = zoneMapOptimize.pruneDocIdRangeByZoneMap(
+            layerMeta, pool, _indexPartitionReaderWrapper);
+        SQL_LOG(DEBUG, "after zone map prune, layer meta: %s", layerMeta->toString().c_str());
+    }
     if (layerMeta) {
         layerMeta->quotaMode = QM_PER_DOC;
         proportionalLayerQuota(*layerMeta.get());
@@ -494,11 +501,24 @@ ScanIteratorPtr ScanIteratorCreatorR::createScanIterator(bool &emptyScan) {
     ScanIteratorPtr scanIterator = ScanIteratorPtr();
     if (_scanInitParamR->sortDesc.topk != 0) { // has sort desc
         SQL_LOG(TRACE2, "create ordered ha3 scan iter");
+        // sorted segments are only merged as sorted runs when the order by follows the
+        // table sort pattern, otherwise they are scanned like unordered ones
+        bool sortMatched = false;
+        const auto &tableSortDescription = _ha3TableInfoR->getTableSortDescMap();
+        auto iter = tableSortDescription.find(_scanInitParamR->tableName);
+        if (iter != tableSortDescription.end()) {
+            sortMatched = OrderedHa3ScanIterator::matchTableSortDescription(
+                _scanInitParamR->sortDesc, iter->second);
+        }
+        SQL_LOG(TRACE2, "sort desc match table sort description [%d]", sortMatched);
         for (size_t i = 0; i < layerMeta->size(); ++i) {
             isearch::search::LayerMetaPtr singleLayerMeta(
                 new isearch::search::LayerMeta(*layerMeta));
             singleLayerMeta->clear();
             singleLayerMeta->push_back((*layerMeta)[i]);
+            if (!sortMatched) {
+                (*singleLayerMeta)[0].ordered = isearch::search::DocIdRangeMeta::OT_UNORDERED;
+            }
             layerMetas.emplace_back(singleLayerMeta);
         }
         scanIterator.reset(
@@ -30,6 +30,7 @@
 #include "sql/ops/scan/Ha3ScanIterator.h"
 #include "sql/ops/sort/SortInitParam.h"
 #include "sql/ops/test/OpTestBase.h"
+#include "suez/sdk/TableDefConfig.h"
 #include "suez/turing/expression/common.h"
 #include "suez/turing/expression/framework/AttributeExpressionCreator.h"
 #include "suez/turing/expression/util/TableInfo.h"
@@ -453,4 +454,96 @@ TEST_F(OrderedHa3ScanIteratorTest, testTop9) {
     ASSERT_NO_FATAL_FAILURE(checkReference<int64_t>(output, "id", {10, 1, 4, 0, 2, 9, 6, 3, 7}));
 }
 
+TEST_F(OrderedHa3ScanIteratorTest, testEarlyTerminate) {
+    prepareResource();
+    std::vector<LayerMetaPtr> layerMetas;
+    std::vector<QueryExecutorPtr> queryExecutors;
+    createLayerMeta(0, 2, DocIdRangeMeta::OT_ORDERED, layerMetas);
+    createLayerMeta(3, 6, DocIdRangeMeta::OT_ORDERED, layerMetas);
+    createLayerMeta(7, 7, DocIdRangeMeta::OT_UNORDERED, layerMetas);
+    createLayerMeta(8, 9, DocIdRangeMeta::OT_UNORDERED, layerMetas);
+
+    createQueryExecutor({0, 1, 2}, queryExecutors);
+    createQueryExecutor({3, 4, 5, 6}, queryExecutors);
+    createQueryExecutor({7}, queryExecutors);
+    createQueryExecutor({8, 9}, queryExecutors);
+
+    Ha3ScanIteratorParam param;
+    param.queryExecutors = queryExecutors;
+    param.matchDocAllocator = _matchDocAllocator;
+    param.layerMetas = layerMetas;
+
+    SortInitParam sortDesc;
+    sortDesc.topk = 2;
+    sortDesc.keys = {"attr1"};
+    sortDesc.orders = {false};
+
+    OrderedHa3ScanIterator orderedHa3ScanIterator(
+        param, _poolPtr.get(), sortDesc, _attributeExpressionCreator.get());
+
+    ASSERT_TRUE(orderedHa3ScanIterator.init());
+
+    vector<MatchDoc> output;
+    ASSERT_TRUE(orderedHa3ScanIterator.batchSeek(10, output).unwrap());
+    ASSERT_NO_FATAL_FAILURE(checkDocIds(output, {9, 0}));
+    ASSERT_NO_FATAL_FAILURE(checkReference<int32_t>(output, "attr1", {2, 3}));
+    // head of layer 1 and second doc of layer 0 can not enter top 2
+    ASSERT_EQ(2, orderedHa3ScanIterator.getEarlyTerminatedLayerCount());
+}
+
+TEST_F(OrderedHa3ScanIteratorTest, testOrderedLayerLimit) {
+    prepareResource();
+    std::vector<LayerMetaPtr> layerMetas;
+    std::vector<QueryExecutorPtr> queryExecutors;
+    createLayerMeta(0, 2, DocIdRangeMeta::OT_ORDERED, layerMetas);
+    createLayerMeta(3, 6, DocIdRangeMeta::OT_ORDERED, layerMetas);
+
+    createQueryExecutor({0, 1, 2}, queryExecutors);
+    createQueryExecutor({3, 4, 5, 6}, queryExecutors);
+
+    Ha3ScanIteratorParam param;
+    param.queryExecutors = queryExecutors;
+    param.matchDocAllocator = _matchDocAllocator;
+    param.layerMetas = layerMetas;
+
+    SortInitParam sortDesc;
+    sortDesc.topk = 1;
+    sortDesc.keys = {"attr1"};
+    sortDesc.orders = {false};
+
+    OrderedHa3ScanIterator orderedHa3ScanIterator(
+        param, _poolPtr.get(), sortDesc, _attributeExpressionCreator.get());
+
+    ASSERT_TRUE(orderedHa3ScanIterator.init());
+
+    vector<MatchDoc> output;
+    ASSERT_TRUE(orderedHa3ScanIterator.batchSeek(10, output).unwrap());
+    ASSERT_NO_FATAL_FAILURE(checkDocIds(output, {0}));
+    ASSERT_NO_FATAL_FAILURE(checkReference<int32_t>(output, "attr1", {3}));
+    // layer 0 stops after its first doc without seeking the second one
+    ASSERT_EQ(2, orderedHa3ScanIterator.getEarlyTerminatedLayerCount());
+}
+
+TEST_F(OrderedHa3ScanIteratorTest, testMatchTableSortDescription) {
+    std::vector<suez::SortDescription> tableSortDescs
+        = {suez::SortDescription("attr1", "ASC"), suez::SortDescription("id", "")};
+    SortInitParam sortDesc;
+    ASSERT_FALSE(OrderedHa3ScanIterator::matchTableSortDescription(sortDesc, tableSortDescs));
+    sortDesc.keys = {"attr1"};
+    sortDesc.orders = {false};
+    ASSERT_TRUE(OrderedHa3ScanIterator::matchTableSortDescription(sortDesc, tableSortDescs));
+    sortDesc.orders = {true};
+    ASSERT_FALSE(OrderedHa3ScanIterator::matchTableSortDescription(sortDesc, tableSortDescs));
+    // empty sort pattern means desc
+    sortDesc.keys = {"attr1", "id"};
+    sortDesc.orders = {false, true};
+    ASSERT_TRUE(OrderedHa3ScanIterator::matchTableSortDescription(sortDesc, tableSortDescs));
+    sortDesc.keys = {"id"};
+    sortDesc.orders = {true};
+    ASSERT_FALSE(OrderedHa3ScanIterator::matchTableSortDescription(sortDesc, tableSortDescs));
+    sortDesc.keys = {"attr1", "id", "attr2"};
+    sortDesc.orders = {false, true, false};
+    ASSERT_FALSE(OrderedHa3ScanIterator::matchTableSortDescription(sortDesc, tableSortDescs));
+}
+
 } // namespace sql
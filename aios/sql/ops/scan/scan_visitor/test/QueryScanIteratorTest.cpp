@@ -16,6 +16,7 @@
 #include "autil/mem_pool/PoolBase.h"
 #include "autil/result/Result.h"
 #include "ha3/common/TimeoutTerminator.h"
+#include "ha3/search/AndQueryExecutor.h"
 #include "ha3/search/Filter.h"
 #include "ha3/search/FilterWrapper.h"
 #include "ha3/search/IndexPartitionReaderUtil.h"
@@ -359,6 +360,64 @@ TEST_F(QueryScanIteratorTest, testSeekWithSubTerm) {
     ASSERT_EQ(3, matchDocVec[2].getDocId());
 }
 
+TEST_F(QueryScanIteratorTest, testAndQueryReorderDenseChildToPostFilter) {
+    // the sparse term generates more than ADJUST_PROBE_INTERVAL candidates, almost all of them
+    // pass the dense term
+    constexpr docid_t docCount = 20000;
+    string sparseStr = "SPARSE:";
+    string denseStr = "DENSE:";
+    vector<docid_t> expect;
+    for (docid_t docId = 0; docId < docCount; ++docId) {
+        bool inSparse = docId % 3 == 0;
+        bool inDense = docId % 50 != 7;
+        if (inSparse) {
+            sparseStr += autil::StringUtil::toString(docId) + ";";
+        }
+        if (inDense) {
+            denseStr += autil::StringUtil::toString(docId) + ";";
+        }
+        if (inSparse && inDense) {
+            expect.push_back(docId);
+        }
+    }
+    FakeIndex fakeIndex;
+    fakeIndex.indexes["phrase"] = sparseStr + "\n" + denseStr + "\n";
+    auto indexReaderWrapper = FakeIndexPartitionReaderCreator::createIndexPartitionReader(fakeIndex);
+    indexReaderWrapper->setTopK(docCount);
+    for (bool adaptiveReorder : {false, true}) {
+        auto queryExecutor = QueryExecutorConstructor::prepareAndQueryExecutor(
+            &_pool, indexReaderWrapper.get(), "phrase", "SPARSE", "DENSE", NULL);
+        QueryExecutorPtr queryExecutorPtr(queryExecutor,
+                                          [](QueryExecutor *p) { POOL_DELETE_CLASS(p); });
+        auto andQueryExecutor = dynamic_cast<AndQueryExecutor *>(queryExecutor);
+        ASSERT_TRUE(andQueryExecutor);
+        andQueryExecutor->setAdaptiveReorder(adaptiveReorder);
+        ASSERT_EQ("SPARSE", andQueryExecutor->getSortedQueryExecutors()[0]->toString());
+
+        LayerMetaPtr layerMeta(new LayerMeta(&_pool));
+        layerMeta->push_back(DocIdRangeMeta(0, docCount - 1, DocIdRangeMeta::OT_UNKNOWN, docCount));
+        MatchDocAllocatorPtr allocator(new MatchDocAllocator(&_pool));
+        QueryScanIterator scanIter(queryExecutorPtr, {}, allocator, {}, layerMeta);
+        vector<MatchDoc> matchDocVec;
+        ASSERT_TRUE(scanIter.batchSeek(docCount, matchDocVec).unwrap());
+        vector<docid_t> docIds;
+        for (auto matchDoc : matchDocVec) {
+            docIds.push_back(matchDoc.getDocId());
+        }
+        ASSERT_EQ(expect, docIds) << adaptiveReorder;
+        if (!adaptiveReorder) {
+            ASSERT_EQ(0, andQueryExecutor->getReorderCount());
+            ASSERT_EQ(0, andQueryExecutor->getPostFilterCount());
+            continue;
+        }
+        ASSERT_GT(andQueryExecutor->getReorderCount(), 0);
+        ASSERT_EQ(1, andQueryExecutor->getPostFilterCount());
+        const auto &sortedQueryExecutors = andQueryExecutor->getSortedQueryExecutors();
+        ASSERT_EQ(2, sortedQueryExecutors.size());
+        ASSERT_EQ("DENSE", sortedQueryExecutors.back()->toString());
+    }
+}
+
 indexlib::partition::IndexPartitionPtr
 QueryScanIteratorTest::makeIndexPartition(const std::string &rootPath,
                                           const std::string &tableName) {
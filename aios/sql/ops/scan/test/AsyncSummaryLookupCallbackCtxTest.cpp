@@ -62,6 +62,28 @@ TEST_F(AsyncSummaryLookupCallbackCtxTest, testOnSessionCallback) {
     ASSERT_EQ(0, ctx._errorDocIds.size());
 }
 
+TEST_F(AsyncSummaryLookupCallbackCtxTest, testOnSessionCallback_BlockCounter) {
+    auto pipe = std::make_shared<navi::MockAsyncPipe>();
+    CountedAsyncPipePtr countedPipe(new CountedAsyncPipe(pipe));
+    AsyncSummaryLookupCallbackCtx ctx(countedPipe, {}, NULL, _poolPtr, nullptr);
+    EXPECT_CALL(*pipe, setData(_)).WillOnce(Return(navi::EC_NONE));
+    ctx._docIds = {1, 2, 3};
+    ctx._blockCounter.compressBlockAccessCount = 3;
+    ctx._blockCounter.compressBlockLoadCount = 1;
+    indexlib::index::ErrorCodeVec errorCodes(3, indexlib::index::ErrorCode::OK);
+    future_lite::Try<indexlib::index::ErrorCodeVec> errorCodeTry(std::move(errorCodes));
+    ctx._startVersion = 1;
+    ctx._callbackVersion = 0;
+    ctx.onSessionCallback(errorCodeTry);
+    ASSERT_FALSE(ctx.hasError());
+    ASSERT_EQ(3, ctx._metricsCollector.blockAccessCount);
+    ASSERT_EQ(1, ctx._metricsCollector.blockLoadCount);
+
+    ctx.prepareDocs({4}, 1);
+    ASSERT_EQ(0, ctx._blockCounter.compressBlockAccessCount);
+    ASSERT_EQ(0, ctx._blockCounter.compressBlockLoadCount);
+}
+
 TEST_F(AsyncSummaryLookupCallbackCtxTest, testOnSessionCallback_ErrorDocId) {
     auto pipe = std::make_shared<navi::MockAsyncPipe>();
     CountedAsyncPipePtr countedPipe(new CountedAsyncPipe(pipe));
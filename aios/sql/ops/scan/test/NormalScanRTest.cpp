@@ -306,6 +306,95 @@ TEST_F(NormalScanRTest, testInit1) {
     }
 }
 
+TEST_F(NormalScanRTest, testAdaptiveBatchSize) {
+    {
+        autil::legacy::json::JsonMap attributeMap;
+        attributeMap["table_type"] = string("normal");
+        attributeMap["table_name"] = _tableName;
+        attributeMap["db_name"] = string("default");
+        attributeMap["catalog_name"] = string("default");
+        attributeMap["hash_fields"] = ParseJson(string(R"json(["id"])json"));
+        attributeMap["output_fields_internal"] = ParseJson(string(R"json(["$attr1"])json"));
+        string jsonStr = autil::legacy::FastToJsonString(attributeMap);
+        auto *naviRHelper = getNaviRHelper();
+        naviRHelper->kernelConfig(jsonStr);
+        auto scanR = naviRHelper->getOrCreateRes<NormalScanR>();
+        ASSERT_TRUE(scanR);
+        ASSERT_TRUE(scanR->_adaptiveBatchSize);
+        ASSERT_EQ(1 << 18, scanR->_batchSize);
+        ASSERT_EQ(DEFAULT_INIT_BATCH_COUNT, scanR->nextBatchSize());
+        ASSERT_EQ(DEFAULT_INIT_BATCH_COUNT * 2, scanR->nextBatchSize());
+        for (size_t i = 0; i < 20; ++i) {
+            scanR->nextBatchSize();
+        }
+        ASSERT_EQ(1 << 18, scanR->nextBatchSize());
+        const auto &scanInfo = scanR->_scanInitParamR->scanInfo;
+        ASSERT_EQ(DEFAULT_INIT_BATCH_COUNT, scanInfo.firstbatchsize());
+        ASSERT_EQ(1 << 18, scanInfo.maxbatchsize());
+        ASSERT_EQ(0, scanInfo.batchshrinktimes());
+    }
+    { // fixed by plan
+        autil::legacy::json::JsonMap attributeMap;
+        attributeMap["table_type"] = string("normal");
+        attributeMap["table_name"] = _tableName;
+        attributeMap["db_name"] = string("default");
+        attributeMap["catalog_name"] = string("default");
+        attributeMap["hash_fields"] = ParseJson(string(R"json(["id"])json"));
+        attributeMap["output_fields_internal"] = ParseJson(string(R"json(["$attr1"])json"));
+        attributeMap["batch_size"] = Any(100);
+        string jsonStr = autil::legacy::FastToJsonString(attributeMap);
+        auto *naviRHelper = getNaviRHelper();
+        naviRHelper->kernelConfig(jsonStr);
+        auto scanR = naviRHelper->getOrCreateRes<NormalScanR>();
+        ASSERT_TRUE(scanR);
+        ASSERT_FALSE(scanR->_adaptiveBatchSize);
+        ASSERT_EQ(100, scanR->nextBatchSize());
+        ASSERT_EQ(100, scanR->nextBatchSize());
+        ASSERT_EQ(0, scanR->_scanInitParamR->scanInfo.firstbatchsize());
+    }
+}
+
+TEST_F(NormalScanRTest, testAdaptiveBatchSizeShrink) {
+    autil::legacy::json::JsonMap attributeMap;
+    attributeMap["table_type"] = string("normal");
+    attributeMap["table_name"] = _tableName;
+    attributeMap["db_name"] = string("default");
+    attributeMap["catalog_name"] = string("default");
+    attributeMap["hash_fields"] = ParseJson(string(R"json(["id"])json"));
+    attributeMap["output_fields_internal"] = ParseJson(string(R"json(["$attr1"])json"));
+    string jsonStr = autil::legacy::FastToJsonString(attributeMap);
+    auto *naviRHelper = getNaviRHelper();
+    naviRHelper->kernelConfig(jsonStr);
+    auto scanR = naviRHelper->getOrCreateRes<NormalScanR>();
+    ASSERT_TRUE(scanR);
+    ASSERT_TRUE(scanR->_adaptiveBatchSize);
+    ASSERT_EQ(DEFAULT_INIT_BATCH_COUNT, scanR->nextBatchSize());
+    ASSERT_EQ(DEFAULT_INIT_BATCH_COUNT * 2, scanR->nextBatchSize());
+    ASSERT_EQ(DEFAULT_INIT_BATCH_COUNT * 4, scanR->nextBatchSize());
+
+    // query pool over half of its limit, batch halves down to the minimum
+    auto pool = scanR->_queryMemPoolR->getPool();
+    size_t allocSize = pool->_allocSize;
+    pool->_allocSize = MAX_SQL_POOL_SIZE / 2;
+    vector<uint32_t> batchSizes;
+    for (size_t i = 0; i < 5; ++i) {
+        batchSizes.push_back(scanR->nextBatchSize());
+    }
+    ASSERT_EQ(vector<uint32_t>({512, 256, 128, MIN_ADAPTIVE_BATCH_COUNT, MIN_ADAPTIVE_BATCH_COUNT}),
+              batchSizes);
+
+    // pressure gone, batch grows again
+    pool->_allocSize = allocSize;
+    ASSERT_EQ(MIN_ADAPTIVE_BATCH_COUNT * 2, scanR->nextBatchSize());
+    ASSERT_EQ(MIN_ADAPTIVE_BATCH_COUNT * 4, scanR->nextBatchSize());
+
+    const auto &scanInfo = scanR->_scanInitParamR->scanInfo;
+    ASSERT_EQ(DEFAULT_INIT_BATCH_COUNT, scanInfo.firstbatchsize());
+    ASSERT_EQ(DEFAULT_INIT_BATCH_COUNT * 4, scanInfo.maxbatchsize());
+    // staying at the minimum is not a shrink
+    ASSERT_EQ(4, scanInfo.batchshrinktimes());
+}
+
 TEST_F(NormalScanRTest, testInit2) {
     { // default with sqlBizResource
         autil::legacy::json::JsonMap attributeMap;
@@ -576,6 +665,52 @@ TEST_F(NormalScanRTest, testDoBatchScan5) {
     }
 }
 
+TEST_F(NormalScanRTest, testDoBatchScanWithSortPushDown) {
+    autil::legacy::json::JsonMap attributeMap;
+    attributeMap["table_type"] = string("normal");
+    attributeMap["table_name"] = _tableName;
+    attributeMap["db_name"] = string("default");
+    attributeMap["catalog_name"] = string("default");
+    attributeMap["hash_fields"] = ParseJson(string(R"json(["id"])json"));
+    attributeMap["output_fields_internal"]
+        = ParseJson(string(R"json(["$attr1", "$attr2", "$id"])json"));
+    attributeMap["push_down_ops"] = ParseJson(R"json([
+    {
+        "attrs": {
+            "condition": {"op":"QUERY", "params":["index_2", "'a' OR 'b'"], "type":"UDF"},
+            "output_field_exprs": {}
+        },
+        "op_name": "CalcOp"
+    },
+    {
+        "attrs": {
+            "order_fields": ["attr1"],
+            "directions": ["DESC"],
+            "limit": 2,
+            "offset": 0
+        },
+        "op_name": "SortOp"
+    }])json");
+    string jsonStr = autil::legacy::FastToJsonString(attributeMap);
+    auto *naviRHelper = getNaviRHelper();
+    naviRHelper->kernelConfig(jsonStr);
+    auto scanR = naviRHelper->getOrCreateRes<NormalScanR>();
+    ASSERT_TRUE(scanR);
+    // sort key is materialized by the ordered scan iterator, only the rest is projected
+    ASSERT_NO_FATAL_FAILURE(checkExpr(scanR->_attributeExpressionVec, {"attr1", "attr2", "id"}));
+    ASSERT_NO_FATAL_FAILURE(checkExpr(scanR->_projectExpressionVec, {"attr2", "id"}));
+    TablePtr table;
+    bool eof = false;
+    ASSERT_TRUE(scanR->doBatchScan(table, eof));
+    ASSERT_TRUE(eof);
+    ASSERT_TRUE(table != nullptr);
+    ASSERT_EQ(2, table->getRowCount());
+    ASSERT_EQ("3", table->toString(0, 0));
+    ASSERT_EQ("4", table->toString(0, 2));
+    ASSERT_EQ("2", table->toString(1, 0));
+    ASSERT_EQ("3", table->toString(1, 2));
+}
+
 TEST_F(NormalScanRTest, testTimeout) {
     autil::legacy::json::JsonMap attributeMap;
     attributeMap["table_type"] = string("normal");
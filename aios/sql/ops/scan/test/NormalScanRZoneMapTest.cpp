@@ -0,0 +1,252 @@
+#include <algorithm>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "autil/StringUtil.h"
+#include "autil/legacy/legacy_jsonizable.h"
+#include "indexlib/config/BuildConfig.h"
+#include "indexlib/config/OnlineConfig.h"
+#include "indexlib/config/TabletOptions.h"
+#include "indexlib/config/TabletSchema.h"
+#include "indexlib/framework/ITablet.h"
+#include "indexlib/framework/IndexRoot.h"
+#include "indexlib/index/attribute/Common.h"
+#include "indexlib/index/attribute/config/AttributeConfig.h"
+#include "indexlib/partition/index_application.h"
+#include "indexlib/table/normal_table/test/NormalTableTestHelper.h"
+#include "navi/tester/NaviResourceHelper.h"
+#include "sql/ops/scan/NormalScanR.h"
+#include "sql/ops/scan/ScanInitParamR.h"
+#include "sql/ops/test/OpTestBase.h"
+#include "suez/turing/expression/util/TableInfoConfigurator.h"
+#include "suez/turing/navi/TableInfoR.h"
+#include "table/Table.h"
+#include "unittest/unittest.h"
+
+using namespace std;
+using namespace autil;
+using namespace autil::legacy;
+using namespace autil::legacy::json;
+using namespace table;
+using namespace suez::turing;
+
+namespace sql {
+
+// builds the same docs into a table with zone maps and one without, scans over both must agree
+class NormalScanRZoneMapTest : public OpTestBase {
+public:
+    NormalScanRZoneMapTest() {
+        _tableName = "zone_map_table";
+        _needBuildTablet = true;
+        _needExprResource = true;
+    }
+    ~NormalScanRZoneMapTest() {}
+
+public:
+    void prepareTablet() override {
+        ASSERT_NO_FATAL_FAILURE(prepareNormalTablet(_tableName, ZONE_MAP_BLOCK_SIZE));
+        ASSERT_NO_FATAL_FAILURE(prepareNormalTablet(PLAIN_TABLE_NAME, 0));
+    }
+
+    void prepareNormalTablet(const std::string &tableName, uint32_t zoneMapBlockSize) {
+        std::string testPath = _testPath + tableName;
+        indexlibv2::framework::IndexRoot indexRoot(testPath, testPath);
+        auto tabletSchema = indexlibv2::table::NormalTableTestHelper::MakeSchema(
+            "pk:uint64;price:int32;stock:int32:false:-1:true", // fields
+            "pk:primarykey64:pk",                              // indexes
+            "pk;price;stock",                                  // attributes
+            "");                                               // summarys
+        ASSERT_TRUE(tabletSchema);
+        auto typedSchema
+            = std::dynamic_pointer_cast<indexlibv2::config::TabletSchema>(tabletSchema);
+        ASSERT_TRUE(typedSchema);
+        typedSchema->TEST_SetTableName(tableName);
+        if (zoneMapBlockSize > 0) {
+            for (const std::string attrName : {"price", "stock"}) {
+                auto attrConfig = std::dynamic_pointer_cast<indexlibv2::index::AttributeConfig>(
+                    tabletSchema->GetIndexConfig(indexlibv2::index::ATTRIBUTE_INDEX_TYPE_STR,
+                                                 attrName));
+                ASSERT_TRUE(attrConfig);
+                attrConfig->SetZoneMapBlockSize(zoneMapBlockSize);
+            }
+        }
+        auto helper = make_shared<indexlibv2::table::NormalTableTestHelper>();
+        _dependentHolders.push_back(helper);
+        ASSERT_TRUE(helper->Open(indexRoot, tabletSchema, createTabletOptions()).IsOK());
+        // two segments merged into one, then a segment whose last block is partial
+        ASSERT_TRUE(helper->BuildSegment(makeDocs(0, 40)).IsOK());
+        ASSERT_TRUE(helper->BuildSegment(makeDocs(40, 80)).IsOK());
+        auto mergeOption = indexlibv2::table::TableTestHelper::MergeOption::OptimizeMergeOption();
+        ASSERT_TRUE(helper->Merge(mergeOption).IsOK());
+        ASSERT_TRUE(helper->BuildSegment(makeDocs(80, DOC_COUNT)).IsOK());
+        auto tabletPtr = helper->GetITablet();
+        ASSERT_TRUE(tabletPtr);
+        _tabletMap.insert(make_pair(tableName, tabletPtr));
+    }
+
+    std::shared_ptr<indexlibv2::config::TabletOptions> createTabletOptions() {
+        std::string jsonStr = R"( {
+    "online_index_config": {
+        "build_config": {
+            "sharding_column_num" : 1,
+            "level_num" : 3
+        }
+    }
+    } )";
+        auto tabletOptions = std::make_shared<indexlibv2::config::TabletOptions>();
+        FastFromJsonString(*tabletOptions, jsonStr);
+        tabletOptions->SetIsOnline(true);
+        tabletOptions->SetIsLeader(true);
+        tabletOptions->SetFlushLocal(false);
+        tabletOptions->SetFlushRemote(true);
+        tabletOptions->TEST_GetOnlineConfig().TEST_GetBuildConfig().TEST_SetBuildingMemoryLimit(
+            64 * 1024 * 1024);
+        return tabletOptions;
+    }
+
+    // price grows with pk so blocks have tight ranges, stock holds a null only block
+    // [16, 32) and scattered nulls
+    static std::string makeDocs(int32_t begin, int32_t end) {
+        std::string docs;
+        for (int32_t pk = begin; pk < end; ++pk) {
+            std::string stock = (pk >= 16 && pk < 32) || pk % 5 == 0
+                                    ? std::string("__NULL__")
+                                    : StringUtil::toString(pk - 50);
+            docs += "cmd=add,pk=" + StringUtil::toString(pk)
+                    + ",price=" + StringUtil::toString(pk * 10) + ",stock=" + stock + ";";
+        }
+        return docs;
+    }
+
+    void preparePlainTableInfo() {
+        auto *tableInfoR = getNaviRHelper()->getOrCreateRes<TableInfoR>();
+        ASSERT_TRUE(tableInfoR);
+        tableInfoR->_tableInfoMapWithoutRel[PLAIN_TABLE_NAME]
+            = TableInfoConfigurator::createFromIndexApp(PLAIN_TABLE_NAME, _indexApp);
+        ASSERT_TRUE(tableInfoR->_tableInfoMapWithoutRel[PLAIN_TABLE_NAME]);
+    }
+
+    void scanTable(const std::string &tableName,
+                   const std::string &conditionJson,
+                   std::vector<std::string> &rows,
+                   uint64_t &totalScanCount) {
+        JsonMap attributeMap;
+        attributeMap["table_type"] = string("normal");
+        attributeMap["table_name"] = tableName;
+        attributeMap["db_name"] = string("default");
+        attributeMap["catalog_name"] = string("default");
+        attributeMap["hash_fields"] = ParseJson(string(R"json(["pk"])json"));
+        attributeMap["output_fields_internal"]
+            = ParseJson(string(R"json(["$pk", "$price", "$stock"])json"));
+        attributeMap["push_down_ops"] = ParseJson(R"json([{"attrs": {"condition": )json"
+                                                  + conditionJson
+                                                  + R"json(}, "op_name": "CalcOp"}])json");
+        attributeMap["limit"] = Any(DOC_COUNT * 2);
+        auto *naviRHelper = getNaviRHelper();
+        naviRHelper->kernelConfig(FastToJsonString(attributeMap));
+        auto scanR = naviRHelper->getOrCreateRes<NormalScanR>();
+        ASSERT_TRUE(scanR);
+        bool eof = false;
+        while (!eof) {
+            TablePtr table;
+            ASSERT_TRUE(scanR->doBatchScan(table, eof));
+            ASSERT_TRUE(table);
+            for (size_t row = 0; row < table->getRowCount(); ++row) {
+                rows.push_back(table->toString(row, 0) + "," + table->toString(row, 1) + ","
+                               + table->toString(row, 2));
+            }
+        }
+        std::sort(rows.begin(), rows.end());
+        totalScanCount = scanR->_scanInitParamR->scanInfo.totalscancount();
+    }
+
+    void checkSameResult(const std::string &conditionJson,
+                         size_t expectRowCount,
+                         bool expectPruned) {
+        std::vector<std::string> zoneMapRows;
+        uint64_t zoneMapScanCount = 0;
+        ASSERT_NO_FATAL_FAILURE(
+            scanTable(_tableName, conditionJson, zoneMapRows, zoneMapScanCount));
+        std::vector<std::string> plainRows;
+        uint64_t plainScanCount = 0;
+        ASSERT_NO_FATAL_FAILURE(
+            scanTable(PLAIN_TABLE_NAME, conditionJson, plainRows, plainScanCount));
+        ASSERT_EQ(plainRows, zoneMapRows) << conditionJson;
+        ASSERT_EQ(expectRowCount, zoneMapRows.size()) << conditionJson;
+        ASSERT_EQ((uint64_t)DOC_COUNT, plainScanCount) << conditionJson;
+        if (expectPruned) {
+            ASSERT_GT(plainScanCount, zoneMapScanCount) << conditionJson;
+        } else {
+            ASSERT_EQ(plainScanCount, zoneMapScanCount) << conditionJson;
+        }
+    }
+
+private:
+    static constexpr uint32_t ZONE_MAP_BLOCK_SIZE = 16;
+    // 80 merged docs and 37 built docs, the last block holds 5 docs
+    static constexpr int32_t DOC_COUNT = 117;
+    inline static const std::string PLAIN_TABLE_NAME = "plain_table";
+};
+
+TEST_F(NormalScanRZoneMapTest, testRangeQuery) {
+    ASSERT_NO_FATAL_FAILURE(preparePlainTableInfo());
+    // in merged segment
+    ASSERT_NO_FATAL_FAILURE(checkSameResult(
+        R"({"op":"AND","type":"OTHER","params":[{"op":">=","type":"OTHER","params":["$price",300]},{"op":"<","type":"OTHER","params":["$price",520]}]})",
+        22,
+        true));
+    // across the merged and the built segment
+    ASSERT_NO_FATAL_FAILURE(checkSameResult(
+        R"({"op":"AND","type":"OTHER","params":[{"op":">","type":"OTHER","params":["$price",750]},{"op":"<=","type":"OTHER","params":["$price",850]}]})",
+        10,
+        true));
+    // in the partial last block
+    ASSERT_NO_FATAL_FAILURE(checkSameResult(
+        R"({"op":">=","type":"OTHER","params":["$price",1120]})", 5, true));
+    // matches nothing
+    ASSERT_NO_FATAL_FAILURE(checkSameResult(
+        R"({"op":">","type":"OTHER","params":["$price",100000]})", 0, true));
+    // or on one attribute unions the ranges
+    ASSERT_NO_FATAL_FAILURE(checkSameResult(
+        R"({"op":"OR","type":"OTHER","params":[{"op":"<","type":"OTHER","params":["$price",30]},{"op":">","type":"OTHER","params":["$price",1150]}]})",
+        4,
+        true));
+    // or across attributes is not used for pruning
+    ASSERT_NO_FATAL_FAILURE(checkSameResult(
+        R"({"op":"OR","type":"OTHER","params":[{"op":"<","type":"OTHER","params":["$price",30]},{"op":"=","type":"OTHER","params":["$stock",16]}]})",
+        4,
+        false));
+}
+
+TEST_F(NormalScanRZoneMapTest, testEqualQuery) {
+    ASSERT_NO_FATAL_FAILURE(preparePlainTableInfo());
+    ASSERT_NO_FATAL_FAILURE(
+        checkSameResult(R"({"op":"=","type":"OTHER","params":["$price",370]})", 1, true));
+    ASSERT_NO_FATAL_FAILURE(
+        checkSameResult(R"({"op":"=","type":"OTHER","params":["$price",1160]})", 1, true));
+    ASSERT_NO_FATAL_FAILURE(
+        checkSameResult(R"({"op":"=","type":"OTHER","params":["$price",375]})", 0, true));
+    ASSERT_NO_FATAL_FAILURE(checkSameResult(
+        R"({"op":"AND","type":"OTHER","params":[{"op":"=","type":"OTHER","params":["$price",660]},{"op":"=","type":"OTHER","params":["$stock",16]}]})",
+        1,
+        true));
+}
+
+TEST_F(NormalScanRZoneMapTest, testNullQuery) {
+    ASSERT_NO_FATAL_FAILURE(preparePlainTableInfo());
+    // the null only block [16, 32) holds no value in range
+    ASSERT_NO_FATAL_FAILURE(checkSameResult(
+        R"({"op":"AND","type":"OTHER","params":[{"op":">=","type":"OTHER","params":["$stock",-40]},{"op":"<","type":"OTHER","params":["$stock",-10]}]})",
+        11,
+        true));
+    // null docs are read back as the encoded null value, blocks holding nulls must be kept
+    ASSERT_NO_FATAL_FAILURE(checkSameResult(
+        R"({"op":"=","type":"OTHER","params":["$stock",-2147483648]})", 37, false));
+    ASSERT_NO_FATAL_FAILURE(checkSameResult(
+        R"({"op":"<","type":"OTHER","params":["$stock",-45]})", 41, false));
+}
+
+} // namespace sql
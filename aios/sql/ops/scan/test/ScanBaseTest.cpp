@@ -6,9 +6,14 @@
 #include "build_service/analyzer/Token.h"
 #include "ha3/turing/common/ModelConfig.h"
 #include "navi/common.h"
+#include "sql/ops/scan/ScanBase.h"
+#include "sql/ops/scan/ScanInitParamR.h"
 #include "sql/ops/test/OpTestBase.h"
+#include "sql/resource/SqlResultCacheR.h"
 #include "suez/turing/expression/util/FieldBoost.h"
 #include "table/Row.h"
+#include "table/Table.h"
+#include "table/TableUtil.h"
 
 using namespace std;
 using namespace suez::turing;
@@ -23,6 +28,54 @@ using namespace isearch::turing;
 
 namespace sql {
 
+class FakeResultCacheR : public SqlResultCacheR {
+public:
+    bool getTableVersion(const std::string &tableName,
+                         SqlResultCacheVersion &version) const override {
+        version = _version;
+        return true;
+    }
+
+public:
+    SqlResultCacheVersion _version;
+};
+
+class FakeScanR : public ScanBase {
+private:
+    bool doBatchScan(TablePtr &table, bool &eof) override {
+        ++_scanTimes;
+        if (_totalRows == 0) {
+            table = _output;
+            eof = true;
+            return true;
+        }
+        // emits _totalRows rows in batches sized like a real scan
+        size_t rowCount = std::min((size_t)nextBatchSize(), _totalRows - _outputRows);
+        matchdoc::MatchDocAllocatorPtr allocator;
+        auto docs = _matchDocUtil->createMatchDocs(allocator, rowCount);
+        vector<int32_t> ids;
+        for (size_t i = 0; i < rowCount; ++i) {
+            ids.push_back(_outputRows + i);
+        }
+        _matchDocUtil->extendMatchDocAllocator<int32_t>(allocator, docs, "id", ids);
+        _outputRows += rowCount;
+        table = std::make_shared<Table>(docs, allocator);
+        eof = _outputRows == _totalRows;
+        return true;
+    }
+    bool isDeterministic() const override {
+        return _isDeterministic;
+    }
+
+public:
+    TablePtr _output;
+    size_t _scanTimes = 0;
+    bool _isDeterministic = true;
+    size_t _totalRows = 0;
+    size_t _outputRows = 0;
+    MatchDocUtil *_matchDocUtil = nullptr;
+};
+
 class ScanBaseTest : public OpTestBase {
 public:
     ScanBaseTest();
@@ -33,6 +86,28 @@ public:
         _needBuildIndex = true;
         _needExprResource = true;
     }
+
+public:
+    void prepareFakeScanR(FakeScanR &scanR, SqlResultCacheR *resultCacheR) {
+        auto *naviRHelper = getNaviRHelper();
+        auto scanIPR = std::make_shared<ScanInitParamR>();
+        scanIPR->tableName = _tableName;
+        scanIPR->resultCacheKey = "scan_key";
+        _scanInitParamRs.push_back(scanIPR);
+        scanR._scanInitParamR = scanIPR.get();
+        scanR._sqlResultCacheR = resultCacheR;
+        ASSERT_TRUE(naviRHelper->getOrCreateRes(scanR._queryMemPoolR));
+        ASSERT_TRUE(naviRHelper->getOrCreateRes(scanR._graphMemoryPoolR));
+        matchdoc::MatchDocAllocatorPtr allocator;
+        auto docs = _matchDocUtil.createMatchDocs(allocator, 3);
+        _matchDocUtil.extendMatchDocAllocator<int32_t>(allocator, docs, "id", {1, 2, 3});
+        _matchDocUtil.extendMatchDocAllocator(allocator, docs, "name", {"a", "bb", "ccc"});
+        scanR._output = std::make_shared<Table>(docs, allocator);
+        scanR._matchDocUtil = &_matchDocUtil;
+    }
+
+private:
+    std::vector<std::shared_ptr<ScanInitParamR>> _scanInitParamRs;
 };
 
 ScanBaseTest::ScanBaseTest() {}
@@ -57,4 +132,104 @@ ScanBaseTest::~ScanBaseTest() {}
 //     ASSERT_EQ(1000, scanBase._limit);
 // }
 
+TEST_F(ScanBaseTest, testResultCacheFillAndHit) {
+    FakeResultCacheR resultCacheR;
+    resultCacheR._capacity = 1 << 20;
+    resultCacheR._version.versionId = 1;
+
+    FakeScanR fillScanR;
+    ASSERT_NO_FATAL_FAILURE(prepareFakeScanR(fillScanR, &resultCacheR));
+    TablePtr fillTable;
+    bool eof = false;
+    ASSERT_TRUE(fillScanR.batchScan(fillTable, eof));
+    ASSERT_TRUE(eof);
+    ASSERT_EQ(1, fillScanR._scanTimes);
+    ASSERT_FALSE(fillScanR._scanInitParamR->scanInfo.resultcachehit());
+    ASSERT_EQ(1, resultCacheR.getEntryCount());
+
+    FakeScanR hitScanR;
+    ASSERT_NO_FATAL_FAILURE(prepareFakeScanR(hitScanR, &resultCacheR));
+    TablePtr hitTable;
+    eof = false;
+    ASSERT_TRUE(hitScanR.batchScan(hitTable, eof));
+    ASSERT_TRUE(eof);
+    ASSERT_EQ(0, hitScanR._scanTimes);
+    ASSERT_TRUE(hitScanR._scanInitParamR->scanInfo.resultcachehit());
+    ASSERT_EQ(3, hitScanR._scanInitParamR->scanInfo.totaloutputcount());
+    ASSERT_TRUE(hitTable != nullptr);
+    ASSERT_EQ(TableUtil::toString(fillTable), TableUtil::toString(hitTable));
+
+    // version switch drops the entry and scans again
+    resultCacheR._version.versionId = 2;
+    FakeScanR missScanR;
+    ASSERT_NO_FATAL_FAILURE(prepareFakeScanR(missScanR, &resultCacheR));
+    TablePtr missTable;
+    ASSERT_TRUE(missScanR.batchScan(missTable, eof));
+    ASSERT_EQ(1, missScanR._scanTimes);
+    ASSERT_FALSE(missScanR._scanInitParamR->scanInfo.resultcachehit());
+}
+
+TEST_F(ScanBaseTest, testResultCacheFillLargeAdaptiveScan) {
+    FakeResultCacheR resultCacheR;
+    resultCacheR._capacity = 1 << 20;
+    resultCacheR._version.versionId = 1;
+    size_t totalRows = DEFAULT_INIT_BATCH_COUNT * 4;
+
+    // no plan batch size, the first batch still covers the whole result
+    FakeScanR fillScanR;
+    ASSERT_NO_FATAL_FAILURE(prepareFakeScanR(fillScanR, &resultCacheR));
+    fillScanR._batchSize = 1 << 18;
+    fillScanR._adaptiveBatchSize = true;
+    fillScanR._totalRows = totalRows;
+    TablePtr fillTable;
+    bool eof = false;
+    ASSERT_TRUE(fillScanR.batchScan(fillTable, eof));
+    ASSERT_TRUE(eof);
+    ASSERT_EQ(totalRows, fillTable->getRowCount());
+    ASSERT_EQ(1 << 18, fillScanR._scanInitParamR->scanInfo.firstbatchsize());
+    ASSERT_EQ(1, resultCacheR.getEntryCount());
+
+    FakeScanR hitScanR;
+    ASSERT_NO_FATAL_FAILURE(prepareFakeScanR(hitScanR, &resultCacheR));
+    hitScanR._batchSize = 1 << 18;
+    hitScanR._adaptiveBatchSize = true;
+    hitScanR._totalRows = totalRows;
+    TablePtr hitTable;
+    eof = false;
+    ASSERT_TRUE(hitScanR.batchScan(hitTable, eof));
+    ASSERT_TRUE(eof);
+    ASSERT_EQ(0, hitScanR._scanTimes);
+    ASSERT_TRUE(hitScanR._scanInitParamR->scanInfo.resultcachehit());
+    ASSERT_EQ(TableUtil::toString(fillTable), TableUtil::toString(hitTable));
+
+    // without the result cache the scan keeps starting small
+    FakeScanR smallScanR;
+    ASSERT_NO_FATAL_FAILURE(prepareFakeScanR(smallScanR, nullptr));
+    smallScanR._batchSize = 1 << 18;
+    smallScanR._adaptiveBatchSize = true;
+    smallScanR._totalRows = totalRows;
+    TablePtr smallTable;
+    eof = false;
+    ASSERT_TRUE(smallScanR.batchScan(smallTable, eof));
+    ASSERT_FALSE(eof);
+    ASSERT_EQ(DEFAULT_INIT_BATCH_COUNT, smallTable->getRowCount());
+}
+
+TEST_F(ScanBaseTest, testResultCacheSkipNonDeterministic) {
+    FakeResultCacheR resultCacheR;
+    resultCacheR._capacity = 1 << 20;
+    resultCacheR._version.versionId = 1;
+    for (size_t i = 0; i < 2; ++i) {
+        FakeScanR scanR;
+        ASSERT_NO_FATAL_FAILURE(prepareFakeScanR(scanR, &resultCacheR));
+        scanR._isDeterministic = false;
+        TablePtr table;
+        bool eof = false;
+        ASSERT_TRUE(scanR.batchScan(table, eof));
+        ASSERT_EQ(1, scanR._scanTimes);
+        ASSERT_FALSE(scanR._scanInitParamR->scanInfo.resultcachehit());
+        ASSERT_EQ(0, resultCacheR.getEntryCount());
+    }
+}
+
 } // namespace sql
@@ -47,12 +47,16 @@ public:
     navi::ErrorCode compute(navi::KernelComputeContext &ctx) override;
     bool doConfig(navi::KernelConfigContext &ctx) override;
 
-private:
+protected:
     bool mergeTableData(navi::NaviPartId index, navi::DataPtr &data);
-    bool outputTableData(navi::KernelComputeContext &ctx);
 
 private:
+    bool outputTableData(navi::KernelComputeContext &ctx);
+
+protected:
     table::TablePtr _outputTable;
+
+private:
     int64_t _oneBatch = 0;
 };
 
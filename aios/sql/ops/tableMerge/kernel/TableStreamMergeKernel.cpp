@@ -0,0 +1,91 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sql/ops/tableMerge/kernel/TableStreamMergeKernel.h"
+
+#include "autil/StringUtil.h"
+#include "navi/engine/Kernel.h"
+#include "navi/engine/KernelComputeContext.h"
+#include "navi/engine/PortMergeKernel.h"
+#include "navi/log/NaviLogger.h"
+#include "navi/util/ReadyBitMap.h"
+#include "sql/data/TableData.h"
+
+using namespace std;
+using namespace navi;
+using namespace autil;
+
+namespace sql {
+
+static const std::string TABLE_STREAM_MERGE_KERNEL_NAME = "sql.TableStreamMergeKernel";
+
+std::string TableStreamMergeKernel::getName() const {
+    return TABLE_STREAM_MERGE_KERNEL_NAME;
+}
+
+InputTypeDef TableStreamMergeKernel::inputType() const {
+    return IT_OPTIONAL;
+}
+
+ErrorCode TableStreamMergeKernel::compute(KernelComputeContext &ctx) {
+    NAVI_KERNEL_LOG(TRACE3,
+                    "table stream merge kernel start compute, bitmap [%s]",
+                    StringUtil::toString(*_dataReadyMap).c_str());
+    bool hasValue = false;
+    auto usedPartCount = getUsedPartCount();
+    for (auto i = 0; i < usedPartCount; ++i) {
+        StreamData streamData;
+        auto index = getUsedPartId(i);
+        auto ec = getData(ctx, index, streamData);
+        if (EC_NONE != ec) {
+            NAVI_KERNEL_LOG(ERROR, "get data failed, index: %d", index);
+            return ec;
+        }
+        if (!streamData.hasValue) {
+            continue;
+        }
+        hasValue = true;
+        if (streamData.eof && !_dataReadyMap->isFinish(index)) {
+            NAVI_KERNEL_LOG(TRACE2, "set finish for partId [%d]", index);
+            _dataReadyMap->setFinish(index, true);
+        }
+        if (streamData.data && !mergeTableData(index, streamData.data)) {
+            NAVI_KERNEL_LOG(ERROR, "merge table data from partId [%d] failed", index);
+            return EC_ABORT;
+        }
+    }
+    auto eof = _dataReadyMap->isFinish();
+    if (!hasValue || (!_outputTable && !eof)) {
+        ctx.setIgnoreDeadlock();
+        return EC_NONE;
+    }
+    _dataReadyMap->setReady(false);
+    TableDataPtr tableData;
+    if (_outputTable) {
+        tableData.reset(new TableData(_outputTable));
+    }
+    NAVI_KERNEL_LOG(
+        DEBUG, "output table [%p] data [%p] eof [%d]", _outputTable.get(), tableData.get(), eof);
+    if (!ctx.setOutput(OUTPUT_PORT, tableData, eof)) {
+        NAVI_KERNEL_LOG(ERROR, "setOutput failed");
+        return EC_UNKNOWN;
+    }
+    _outputTable.reset();
+    return EC_NONE;
+}
+
+REGISTER_KERNEL(TableStreamMergeKernel);
+
+} // namespace sql
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <string>
+
+#include "navi/common.h"
+#include "navi/proto/KernelDef.pb.h"
+#include "sql/ops/tableMerge/kernel/TableMergeKernel.h"
+
+namespace navi {
+class KernelComputeContext;
+} // namespace navi
+
+namespace sql {
+
+// forwards partition tables as soon as they arrive instead of waiting for every partition, so
+// a streaming consumer like the final agg folds each partial result in and drops it while slow
+// partitions are still running. tables arriving in the same round are merged into one batch.
+class TableStreamMergeKernel : public TableMergeKernel {
+public:
+    TableStreamMergeKernel() = default;
+    ~TableStreamMergeKernel() = default;
+    TableStreamMergeKernel(const TableStreamMergeKernel &) = delete;
+    TableStreamMergeKernel &operator=(const TableStreamMergeKernel &) = delete;
+
+public:
+    std::string getName() const override;
+    navi::InputTypeDef inputType() const override;
+    navi::ErrorCode compute(navi::KernelComputeContext &ctx) override;
+};
+
+} // namespace sql
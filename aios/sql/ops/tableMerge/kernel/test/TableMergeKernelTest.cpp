@@ -1,4 +1,5 @@
 #include "sql/ops/tableMerge/kernel/TableMergeKernel.h"
+#include "sql/ops/tableMerge/kernel/TableStreamMergeKernel.h"
 
 #include <algorithm>
 #include <cstdint>
@@ -108,7 +109,8 @@ public:
 private:
     void initCluster();
     void buildCluster(NaviTestCluster &cluster);
-    void buildSimpleGraph(GraphDef *def);
+    void buildSimpleGraph(GraphDef *def, const std::string &mergeKernel = "sql.TableMergeKernel");
+    void runGraph(NaviTestCluster &cluster, std::vector<NaviUserData> &dataVec);
 
 private:
     autil::mem_pool::PoolPtr _poolPtr;
@@ -154,7 +156,7 @@ void TableMergeKernelTest::buildCluster(NaviTestCluster &cluster) {
     rootResourceMap.reset();
 }
 
-void TableMergeKernelTest::buildSimpleGraph(GraphDef *def) {
+void TableMergeKernelTest::buildSimpleGraph(GraphDef *def, const std::string &mergeKernel) {
     GraphBuilder builder(def);
     // a2_source(*2) -- sql.TableMergeKernel --> qrs_identity --> GraphOutput1
     builder.newSubGraph("biz_qrs");
@@ -166,10 +168,31 @@ void TableMergeKernelTest::buildSimpleGraph(GraphDef *def) {
         .out("output0")
         .to(n1.in("input0"))
         .require(true)
-        .merge("sql.TableMergeKernel");
+        .merge(mergeKernel);
     ASSERT_TRUE(builder.ok());
 }
 
+void TableMergeKernelTest::runGraph(NaviTestCluster &cluster, std::vector<NaviUserData> &dataVec) {
+    RunGraphParams params;
+    params.setTimeoutMs(100000);
+    auto navi = cluster.getNavi("host_0");
+    auto userResult = navi->runGraph(_graphDef.release(), params);
+    while (true) {
+        NaviUserData data;
+        bool eof = false;
+        if (userResult->nextData(data, eof) && data.data) {
+            dataVec.push_back(data);
+        }
+        if (eof) {
+            break;
+        }
+    }
+    auto naviResult = userResult->getNaviResult();
+    ASSERT_EQ("EC_NONE", std::string(CommonUtil::getErrorString(naviResult->ec)))
+        << naviResult->errorEvent.message;
+    ASSERT_EQ("", naviResult->errorEvent.message);
+}
+
 TEST_F(TableMergeKernelTest, testMergeTableData_Error_GetTableFailed) {
     TableMergeKernel kernel;
     DataPtr data;
@@ -253,6 +276,38 @@ TEST_F(TableMergeKernelTest, testSimple) {
     }
 }
 
+TEST_F(TableMergeKernelTest, testStreamMerge) {
+    NaviTestCluster cluster;
+    ASSERT_NO_FATAL_FAILURE(buildCluster(cluster));
+    ASSERT_NO_FATAL_FAILURE(buildSimpleGraph(_graphDef.get(), "sql.TableStreamMergeKernel"));
+    std::vector<NaviUserData> dataVec;
+    ASSERT_NO_FATAL_FAILURE(runGraph(cluster, dataVec));
+
+    // batches are forwarded as they arrive, only the total is deterministic
+    ASSERT_LE(2, dataVec.size());
+    ASSERT_GE(4, dataVec.size());
+    std::vector<int32_t> values;
+    for (const auto &data : dataVec) {
+        auto tableData = dynamic_pointer_cast<TableData>(data.data);
+        ASSERT_NE(nullptr, tableData);
+        auto table = tableData->getTable();
+        auto column = table->getColumn("a")->getColumnData<int32_t>();
+        ASSERT_NE(nullptr, column);
+        for (size_t i = 0; i < table->getRowCount(); ++i) {
+            values.push_back(column->get(i));
+        }
+    }
+    std::sort(values.begin(), values.end());
+    ASSERT_EQ(std::vector<int32_t>({0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 4, 4}), values);
+}
+
+TEST_F(TableMergeKernelTest, testStreamMergeKernelDef) {
+    TableStreamMergeKernel kernel;
+    ASSERT_EQ("sql.TableStreamMergeKernel", kernel.getName());
+    ASSERT_EQ(TableType::TYPE_ID, kernel.dataType());
+    ASSERT_EQ(IT_OPTIONAL, kernel.inputType());
+}
+
 // TEST_F(TableMergeKernelTest, testSimple_PoolUsageExceed)
 // {
 //     NaviTestCluster cluster;
@@ -12,6 +12,7 @@ def config(config_path, meta_info, biz_name, conf):
             "TableDataSourceKernel",
             "TableDataIdentityKernel",
             "sql.TableMergeKernel",
+            "sql.TableStreamMergeKernel",
         ],
         "init_resource" : [
             "A",
@@ -61,7 +61,10 @@ public:
         , slowQueryFactory(-1)
         , needPrintSlowLog(false)
         , needPrintErrorLog(false)
-        , enableTurboJet(false) {}
+        , enableTurboJet(false)
+        , resultCacheCapacity(0)
+        , resultCacheMaxStaleness(0)
+        , calcProgramCacheSize(0) {}
 
     ~SqlConfig() {}
 
@@ -98,6 +101,10 @@ public:
         needPrintSlowLog = slowQueryFactory > 0.0;
         json.Jsonize("need_print_error_log", needPrintErrorLog, needPrintErrorLog);
         json.Jsonize("enable_turbojet", enableTurboJet, enableTurboJet);
+        json.Jsonize("result_cache_capacity", resultCacheCapacity, resultCacheCapacity);
+        json.Jsonize(
+            "result_cache_max_staleness_us", resultCacheMaxStaleness, resultCacheMaxStaleness);
+        json.Jsonize("calc_program_cache_size", calcProgramCacheSize, calcProgramCacheSize);
         std::map<std::string, std::vector<std::string>> dbNameAliasMap;
         json.Jsonize("db_name_alias", dbNameAliasMap, dbNameAliasMap);
         for (const auto &pair : dbNameAliasMap) {
@@ -137,6 +144,9 @@ public:
     bool needPrintSlowLog;
     bool needPrintErrorLog;
     bool enableTurboJet;
+    size_t resultCacheCapacity;     // bytes, 0 disables the scan result cache
+    int64_t resultCacheMaxStaleness; // us of realtime watermark advance a cached result tolerates
+    size_t calcProgramCacheSize;     // compiled calc programs kept, 0 disables compiled calc
     std::map<std::string, std::string> dbNameAlias;
     std::map<std::string, std::vector<std::string>> tableNameAlias;
 };
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sql/resource/SqlResultCacheR.h"
+
+#include <utility>
+
+#include "build_service/util/LocatorUtil.h"
+#include "indexlib/framework/ITablet.h"
+#include "indexlib/framework/Locator.h"
+#include "indexlib/framework/TabletInfos.h"
+#include "indexlib/framework/Version.h"
+#include "navi/builder/ResourceDefBuilder.h"
+#include "navi/engine/Resource.h"
+#include "sql/common/Log.h"
+#include "sql/resource/SqlConfig.h"
+
+namespace navi {
+class ResourceInitContext;
+} // namespace navi
+
+using namespace std;
+using namespace autil;
+
+namespace sql {
+AUTIL_LOG_SETUP(sql, SqlResultCacheR);
+
+const std::string SqlResultCacheR::RESOURCE_ID = "sql_result_cache_r";
+
+SqlResultCacheR::SqlResultCacheR()
+    : _capacity(0)
+    , _maxStaleness(0)
+    , _usedBytes(0) {}
+
+SqlResultCacheR::~SqlResultCacheR() {}
+
+void SqlResultCacheR::def(navi::ResourceDefBuilder &builder) const {
+    builder.name(RESOURCE_ID, navi::RS_BIZ_PART);
+}
+
+bool SqlResultCacheR::config(navi::ResourceConfigContext &ctx) {
+    return true;
+}
+
+navi::ErrorCode SqlResultCacheR::init(navi::ResourceInitContext &ctx) {
+    const auto &sqlConfig = _sqlConfigResource->getSqlConfig();
+    _capacity = sqlConfig.resultCacheCapacity;
+    _maxStaleness = sqlConfig.resultCacheMaxStaleness;
+    if (_maxStaleness < 0) {
+        SQL_LOG(ERROR, "invalid result cache max staleness [%ld]", _maxStaleness);
+        return navi::EC_ABORT;
+    }
+    if (isEnabled()) {
+        SQL_LOG(INFO,
+                "sql result cache enabled, capacity [%lu] bytes, max staleness [%ld] us",
+                _capacity,
+                _maxStaleness);
+    }
+    return navi::EC_NONE;
+}
+
+bool SqlResultCacheR::getTableVersion(const std::string &tableName,
+                                      SqlResultCacheVersion &version) const {
+    if (!_tabletManagerR) {
+        return false;
+    }
+    auto tablet = _tabletManagerR->getTablet(tableName);
+    if (!tablet) {
+        return false;
+    }
+    auto tabletInfos = tablet->GetTabletInfos();
+    version.versionId = tabletInfos->GetLoadedPublishVersion().GetVersionId();
+    version.watermark
+        = build_service::util::LocatorUtil::GetSwiftWatermark(tabletInfos->GetLatestLocator());
+    return true;
+}
+
+std::shared_ptr<const std::string> SqlResultCacheR::get(const std::string &key,
+                                                        const SqlResultCacheVersion &version) {
+    ScopedLock lock(_mutex);
+    auto iter = _entryMap.find(key);
+    if (iter == _entryMap.end()) {
+        return nullptr;
+    }
+    auto entryIter = iter->second;
+    const auto &cached = entryIter->version;
+    if (cached.versionId != version.versionId
+        || version.watermark - cached.watermark > _maxStaleness) {
+        SQL_LOG(TRACE1,
+                "drop stale result cache, cached version [%ld] watermark [%ld], "
+                "current version [%ld] watermark [%ld]",
+                cached.versionId,
+                cached.watermark,
+                version.versionId,
+                version.watermark);
+        erase(entryIter);
+        return nullptr;
+    }
+    _lruList.splice(_lruList.begin(), _lruList, entryIter);
+    return entryIter->data;
+}
+
+void SqlResultCacheR::put(const std::string &key,
+                          const SqlResultCacheVersion &version,
+                          std::string data) {
+    Entry entry;
+    entry.key = key;
+    entry.version = version;
+    entry.data = std::make_shared<const std::string>(std::move(data));
+    size_t entrySize = entry.size();
+    if (entrySize > _capacity) {
+        return;
+    }
+    ScopedLock lock(_mutex);
+    auto iter = _entryMap.find(key);
+    if (iter != _entryMap.end()) {
+        erase(iter->second);
+    }
+    while (!_lruList.empty() && _usedBytes + entrySize > _capacity) {
+        erase(std::prev(_lruList.end()));
+    }
+    _lruList.push_front(std::move(entry));
+    _entryMap[key] = _lruList.begin();
+    _usedBytes += entrySize;
+}
+
+size_t SqlResultCacheR::getUsedBytes() const {
+    ScopedLock lock(_mutex);
+    return _usedBytes;
+}
+
+size_t SqlResultCacheR::getEntryCount() const {
+    ScopedLock lock(_mutex);
+    return _lruList.size();
+}
+
+void SqlResultCacheR::erase(EntryList::iterator iter) {
+    _usedBytes -= iter->size();
+    _entryMap.erase(iter->key);
+    _lruList.erase(iter);
+}
+
+REGISTER_RESOURCE(SqlResultCacheR);
+
+} // namespace sql
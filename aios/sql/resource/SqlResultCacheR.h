@@ -0,0 +1,110 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <list>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+
+#include "autil/Lock.h"
+#include "autil/Log.h" // IWYU pragma: keep
+#include "navi/common.h"
+#include "navi/engine/Resource.h"
+#include "navi/engine/ResourceConfigContext.h"
+#include "sql/resource/SqlConfigResource.h"
+#include "sql/resource/TabletManagerR.h"
+
+namespace navi {
+class ResourceDefBuilder;
+class ResourceInitContext;
+} // namespace navi
+
+namespace sql {
+
+struct SqlResultCacheVersion {
+    int64_t versionId = -1;
+    int64_t watermark = 0;
+};
+
+// caches serialized scan results of a partition, keyed by the scan subplan (op attrs with
+// dynamic params already bound). entries are dropped once the tablet switches version or
+// the realtime watermark moves further than the configured staleness
+class SqlResultCacheR : public navi::Resource {
+public:
+    SqlResultCacheR();
+    ~SqlResultCacheR();
+    SqlResultCacheR(const SqlResultCacheR &) = delete;
+    SqlResultCacheR &operator=(const SqlResultCacheR &) = delete;
+
+public:
+    void def(navi::ResourceDefBuilder &builder) const override;
+    bool config(navi::ResourceConfigContext &ctx) override;
+    navi::ErrorCode init(navi::ResourceInitContext &ctx) override;
+
+public:
+    bool isEnabled() const {
+        return _capacity > 0;
+    }
+    std::shared_ptr<const std::string> get(const std::string &key,
+                                           const SqlResultCacheVersion &version);
+    void put(const std::string &key, const SqlResultCacheVersion &version, std::string data);
+    size_t getUsedBytes() const;
+    size_t getEntryCount() const;
+
+public: // virtual for test
+    virtual bool getTableVersion(const std::string &tableName,
+                                 SqlResultCacheVersion &version) const;
+
+public:
+    static const std::string RESOURCE_ID;
+
+private:
+    struct Entry {
+        std::string key;
+        SqlResultCacheVersion version;
+        std::shared_ptr<const std::string> data;
+        size_t size() const {
+            return 2 * key.size() + data->size();
+        }
+    };
+    typedef std::list<Entry> EntryList;
+
+private:
+    void erase(EntryList::iterator iter);
+
+private:
+    RESOURCE_DEPEND_DECLARE();
+
+private:
+    RESOURCE_DEPEND_ON(SqlConfigResource, _sqlConfigResource);
+    RESOURCE_DEPEND_ON_FALSE(TabletManagerR, _tabletManagerR);
+    size_t _capacity;
+    int64_t _maxStaleness;
+    size_t _usedBytes;
+    EntryList _lruList; // most recently used first
+    std::unordered_map<std::string, EntryList::iterator> _entryMap;
+    mutable autil::ThreadMutex _mutex;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+NAVI_TYPEDEF_PTR(SqlResultCacheR);
+
+} // namespace sql
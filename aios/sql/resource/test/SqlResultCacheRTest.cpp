@@ -0,0 +1,97 @@
+#include "sql/resource/SqlResultCacheR.h"
+
+#include <memory>
+#include <string>
+
+#include "autil/Log.h"
+#include "navi/tester/NaviResourceHelper.h"
+#include "unittest/unittest.h"
+
+using namespace std;
+using namespace testing;
+
+namespace sql {
+
+class SqlResultCacheRTest : public TESTBASE {
+public:
+    void setUp() override {}
+    void tearDown() override {}
+
+private:
+    SqlResultCacheVersion makeVersion(int64_t versionId, int64_t watermark) {
+        SqlResultCacheVersion version;
+        version.versionId = versionId;
+        version.watermark = watermark;
+        return version;
+    }
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+AUTIL_LOG_SETUP(resource, SqlResultCacheRTest);
+
+TEST_F(SqlResultCacheRTest, testCreateResource) {
+    navi::NaviResourceHelper naviRes;
+    SqlResultCacheR *resultCacheR = nullptr;
+    ASSERT_TRUE(naviRes.getOrCreateRes(resultCacheR));
+    ASSERT_FALSE(resultCacheR->isEnabled());
+}
+
+TEST_F(SqlResultCacheRTest, testPutGet) {
+    SqlResultCacheR cache;
+    cache._capacity = 1024;
+    ASSERT_TRUE(cache.isEnabled());
+    ASSERT_EQ(nullptr, cache.get("k1", makeVersion(1, 100)));
+    cache.put("k1", makeVersion(1, 100), "v1");
+    auto data = cache.get("k1", makeVersion(1, 100));
+    ASSERT_TRUE(data);
+    ASSERT_EQ("v1", *data);
+    ASSERT_EQ(1, cache.getEntryCount());
+    ASSERT_EQ(2 * 2 + 2, cache.getUsedBytes());
+
+    cache.put("k1", makeVersion(1, 100), "v1new");
+    ASSERT_EQ("v1new", *cache.get("k1", makeVersion(1, 100)));
+    ASSERT_EQ(1, cache.getEntryCount());
+    ASSERT_EQ(2 * 2 + 5, cache.getUsedBytes());
+}
+
+TEST_F(SqlResultCacheRTest, testInvalidate) {
+    SqlResultCacheR cache;
+    cache._capacity = 1024;
+    cache._maxStaleness = 10;
+    cache.put("k1", makeVersion(1, 100), "v1");
+    // realtime advance within staleness still hits
+    ASSERT_TRUE(cache.get("k1", makeVersion(1, 110)));
+    // too stale
+    ASSERT_FALSE(cache.get("k1", makeVersion(1, 111)));
+    ASSERT_EQ(0, cache.getEntryCount());
+
+    cache.put("k1", makeVersion(1, 100), "v1");
+    // version switch
+    ASSERT_FALSE(cache.get("k1", makeVersion(2, 100)));
+    ASSERT_EQ(0, cache.getEntryCount());
+    ASSERT_EQ(0, cache.getUsedBytes());
+}
+
+TEST_F(SqlResultCacheRTest, testEvict) {
+    SqlResultCacheR cache;
+    cache._capacity = 25;
+    cache.put("k1", makeVersion(1, 0), string(6, 'a'));
+    cache.put("k2", makeVersion(1, 0), string(6, 'b'));
+    ASSERT_EQ(2, cache.getEntryCount());
+    // touch k1 so k2 becomes the eviction victim
+    ASSERT_TRUE(cache.get("k1", makeVersion(1, 0)));
+    cache.put("k3", makeVersion(1, 0), string(6, 'c'));
+    ASSERT_EQ(2, cache.getEntryCount());
+    ASSERT_TRUE(cache.get("k1", makeVersion(1, 0)));
+    ASSERT_FALSE(cache.get("k2", makeVersion(1, 0)));
+    ASSERT_TRUE(cache.get("k3", makeVersion(1, 0)));
+
+    // entry larger than the whole cache is ignored
+    cache.put("k4", makeVersion(1, 0), string(64, 'd'));
+    ASSERT_FALSE(cache.get("k4", makeVersion(1, 0)));
+    ASSERT_EQ(2, cache.getEntryCount());
+}
+
+} // namespace sql
@@ -67,7 +67,7 @@ bool RawDocument::exist(const std::string& fieldName) const { return exist(autil
 
 void RawDocument::eraseField(const std::string& fieldName) { eraseField(autil::StringView(fieldName)); }
 
-bool RawDocument::NeedTrace() const { return !GetTraceId().empty(); }
+bool RawDocument::NeedTrace() const { return !getField(autil::StringView(BUILTIN_KEY_TRACE_ID)).empty(); }
 
 std::string RawDocument::GetTraceId() const { return getField(BUILTIN_KEY_TRACE_ID); }
 
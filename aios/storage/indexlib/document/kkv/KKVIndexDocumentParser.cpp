@@ -63,7 +63,7 @@ bool KKVIndexDocumentParser::ParseKey(const RawDocument& rawDoc, KVDocument* doc
         return true;
     }
 
-    auto pkeyValue = rawDoc.getField(pkeyFieldName);
+    const autil::StringView& pkeyValue = rawDoc.getField(autil::StringView(pkeyFieldName));
     if (_indexConfig->DenyEmptyPrimaryKey() && pkeyValue.empty()) {
         ERROR_COLLECTOR_LOG(ERROR, "prefix key value is empty!");
         return false;
@@ -73,7 +73,7 @@ bool KKVIndexDocumentParser::ParseKey(const RawDocument& rawDoc, KVDocument* doc
     _keyExtractor->HashPrefixKey(pkeyValue, pkeyHash);
 
     const auto& skeyFieldName = _indexConfig->GetSuffixFieldName();
-    auto skeyValue = rawDoc.getField(skeyFieldName);
+    const autil::StringView& skeyValue = rawDoc.getField(autil::StringView(skeyFieldName));
     if (_indexConfig->DenyEmptySuffixKey() && skeyValue.empty()) {
         // delete message without skey means delete all in that pkey
         if (rawDoc.getDocOperateType() != DELETE_DOC) {
@@ -94,7 +94,7 @@ bool KKVIndexDocumentParser::ParseKey(const RawDocument& rawDoc, KVDocument* doc
         ERROR_COLLECTOR_LOG(ERROR,
                             "suffix key field is empty for add doc, "
                             "which prefix key is [%s]!",
-                            pkeyValue.c_str());
+                            pkeyValue.to_string().c_str());
         return true;
     }
 
@@ -104,7 +104,7 @@ bool KKVIndexDocumentParser::ParseKey(const RawDocument& rawDoc, KVDocument* doc
     // } else {
     //     document->setIdentifier(pkValue);
     // }
-    doc->SetPkField(autil::StringView(pkeyFieldName), autil::StringView(pkeyValue));
+    doc->SetPkField(autil::StringView(pkeyFieldName), pkeyValue);
     doc->SetPKeyHash(pkeyHash);
     if (hasSkey) {
         doc->SetSKeyHash(skeyHash);
@@ -37,18 +37,16 @@ KKVKeysExtractor::KKVKeysExtractor(const std::shared_ptr<config::KKVIndexConfig>
 
 KKVKeysExtractor::~KKVKeysExtractor() {}
 
-void KKVKeysExtractor::HashPrefixKey(const std::string& pkey, uint64_t& pkeyHash)
+void KKVKeysExtractor::HashPrefixKey(const autil::StringView& pkey, uint64_t& pkeyHash)
 {
-    autil::StringView pkeyStr(pkey);
-    bool ret = indexlib::index::KeyHasherWrapper::GetHashKey(_prefixKeyFieldType, _prefixKeyUseNumberHash,
-                                                             pkeyStr.data(), pkeyStr.size(), pkeyHash);
+    bool ret = indexlib::index::KeyHasherWrapper::GetHashKey(_prefixKeyFieldType, _prefixKeyUseNumberHash, pkey.data(),
+                                                             pkey.size(), pkeyHash);
     assert(ret);
     (void)ret;
 }
 
-void KKVKeysExtractor::HashSuffixKey(const std::string& suffixKey, uint64_t& suffixKeyHash)
+void KKVKeysExtractor::HashSuffixKey(const autil::StringView& suffixKey, uint64_t& suffixKeyHash)
 {
-    autil::StringView suffixKeyStr(suffixKey);
     bool ret = indexlib::index::KeyHasherWrapper::GetHashKey(_suffixKeyFieldType, /*useNumberHash=*/true,
                                                              suffixKey.data(), suffixKey.size(), suffixKeyHash);
     assert(ret);
@@ -16,6 +16,7 @@
 #pragma once
 
 #include "autil/Log.h"
+#include "autil/StringView.h"
 #include "indexlib/base/Constant.h"
 #include "indexlib/base/FieldType.h"
 #include "indexlib/document/IDocumentParser.h"
@@ -34,8 +35,8 @@ public:
     ~KKVKeysExtractor();
 
 public:
-    void HashPrefixKey(const std::string& pkey, uint64_t& pkeyHash);
-    void HashSuffixKey(const std::string& suffixKey, uint64_t& skeyHash);
+    void HashPrefixKey(const autil::StringView& pkey, uint64_t& pkeyHash);
+    void HashSuffixKey(const autil::StringView& suffixKey, uint64_t& skeyHash);
 
 private:
     FieldType _prefixKeyFieldType;
@@ -52,7 +52,8 @@ void ExtendDocFieldsConvertor::convertIndexField(const NormalExtendDocument* doc
 
     FieldType fieldType = fieldConfig->GetFieldType();
     if (fieldType == ft_raw) {
-        const std::string& fieldValue = document->getRawDocument()->getField(fieldConfig->GetFieldName());
+        const autil::StringView& fieldValue =
+            document->getRawDocument()->getField(autil::StringView(fieldConfig->GetFieldName()));
         if (fieldValue.empty()) {
             return;
         }
@@ -51,7 +51,7 @@ public:
     }
     const std::shared_ptr<ClassifiedDocument>& getClassifiedDocument() const { return _classifiedDocument; }
 
-    void setIdentifier(const std::string& identifier) { _identifier = identifier; }
+    void setIdentifier(std::string identifier) { _identifier = std::move(identifier); }
     const std::string& getIdentifier() const { return _identifier; }
 
 public: // modified fields
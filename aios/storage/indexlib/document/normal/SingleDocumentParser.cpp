@@ -258,11 +258,10 @@ void SingleDocumentParser::SetPrimaryKeyField(NormalExtendDocument* document)
 
     const shared_ptr<RawDocument>& rawDoc = document->getRawDocument();
     const shared_ptr<ClassifiedDocument>& classifiedDoc = document->getClassifiedDocument();
-    string pkValue = rawDoc->getField(pkFieldName);
-    document->setIdentifier(pkValue);
+    document->setIdentifier(rawDoc->getField(autil::StringView(pkFieldName)).to_string());
 
     AUTIL_LOG(TRACE3, "the primary key is:%s", rawDoc->toString().c_str());
-    classifiedDoc->setPrimaryKey(pkValue);
+    classifiedDoc->setPrimaryKey(document->getIdentifier());
 }
 
 void SingleDocumentParser::AddModifiedFields(const NormalExtendDocument* document,
@@ -0,0 +1,89 @@
+#include "autil/StringUtil.h"
+#include "autil/TimeUtility.h"
+#include "indexlib/document/IDocumentBatch.h"
+#include "indexlib/document/RawDocument.h"
+#include "indexlib/document/normal/NormalDocument.h"
+#include "indexlib/document/normal/NormalDocumentParser.h"
+#include "indexlib/document/normal/test/TokenizeHelper.h"
+#include "indexlib/document/raw_document/DefaultRawDocument.h"
+#include "indexlib/framework/TabletSchemaLoader.h"
+#include "indexlib/table/normal_table/test/NormalTabletSchemaMaker.h"
+#include "unittest/unittest.h"
+
+using namespace std;
+
+namespace indexlibv2 { namespace document {
+
+// measures parse throughput of the normal table path: raw document -> extend document -> normal document
+class NormalDocumentParserPerfTest : public TESTBASE
+{
+public:
+    void setUp() override
+    {
+        _hashMapManager.reset(new KeyMapManager());
+        string field = "pk:string;price:long;title:text;category:string;tags:string:true;desc:string";
+        string index = "pk:PRIMARYKEY64:pk;price_idx:NUMBER:price;title_idx:TEXT:title;category_idx:STRING:category";
+        string attr = "price;category;tags";
+        string summary = "pk;title;desc";
+        _schema = table::NormalTabletSchemaMaker::Make(field, index, attr, summary);
+        ASSERT_TRUE(_schema);
+        ASSERT_TRUE(framework::TabletSchemaLoader::ResolveSchema(nullptr, "", _schema.get()).IsOK());
+        _tokenizeHelper.init(_schema);
+    }
+
+protected:
+    std::vector<std::shared_ptr<NormalExtendDocument>> MakeExtendDocs(size_t docCount)
+    {
+        std::vector<std::shared_ptr<NormalExtendDocument>> docs;
+        docs.reserve(docCount);
+        for (size_t i = 0; i < docCount; ++i) {
+            auto extendDoc = std::make_shared<NormalExtendDocument>();
+            std::shared_ptr<RawDocument> rawDoc(new DefaultRawDocument(_hashMapManager));
+            rawDoc->setDocOperateType(ADD_DOC);
+            string id = autil::StringUtil::toString(i);
+            rawDoc->setField("pk", "pk_" + id);
+            rawDoc->setField("price", autil::StringUtil::toString(i % 1000));
+            rawDoc->setField("title", "title " + id + " of the document parse benchmark");
+            rawDoc->setField("category", "category_" + autil::StringUtil::toString(i % 16));
+            rawDoc->setField("tags", "tag1\x1Dtag2\x1Dtag3");
+            rawDoc->setField("desc", string(128, 'a' + i % 26));
+            extendDoc->setRawDocument(rawDoc);
+            bool ret = _tokenizeHelper.process(extendDoc);
+            assert(ret);
+            (void)ret;
+            docs.push_back(extendDoc);
+        }
+        return docs;
+    }
+
+protected:
+    std::shared_ptr<config::TabletSchema> _schema;
+    std::shared_ptr<KeyMapManager> _hashMapManager;
+    TokenizeHelper _tokenizeHelper;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+AUTIL_LOG_SETUP(indexlib.document, NormalDocumentParserPerfTest);
+
+TEST_F(NormalDocumentParserPerfTest, testParseThroughput)
+{
+    const size_t docCount = 100000;
+    auto parser = std::make_shared<NormalDocumentParser>(nullptr, false);
+    ASSERT_TRUE(parser->Init(_schema, nullptr).IsOK());
+    auto docs = MakeExtendDocs(docCount);
+
+    int64_t beginTime = autil::TimeUtility::currentTime();
+    for (const auto& doc : docs) {
+        auto [status, docBatch] = parser->Parse(*doc);
+        ASSERT_TRUE(status.IsOK());
+        ASSERT_TRUE(docBatch);
+        ASSERT_EQ(1, docBatch->GetBatchSize());
+    }
+    int64_t timeUsed = std::max(autil::TimeUtility::currentTime() - beginTime, int64_t(1));
+    cout << "parse [" << docCount << "] docs, time used [" << timeUsed / 1000 << "] ms, throughput ["
+         << docCount * 1000 * 1000 / timeUsed << "] docs/s" << endl;
+}
+
+}} // namespace indexlibv2::document
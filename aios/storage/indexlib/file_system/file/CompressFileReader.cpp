@@ -391,9 +391,11 @@ future_lite::coro::Lazy<std::vector<FSResult<size_t>>> CompressFileReader::Batch
     }
     std::vector<FSResult<size_t>> ret(batchIO.size(), {ErrorCode::FSEC_OK, 0});
     vector<size_t> lostBlocks;
+    size_t blockAccessCount = 0;
     for (size_t i = 0; i < batchIO.size(); ++i) {
         const SingleIO& single = batchIO[i];
         pair<size_t, size_t> range = GetBlockRange(single.offset, single.len);
+        blockAccessCount += range.second - range.first;
         for (size_t bid = range.first; bid < range.second; ++bid) {
             auto iter = _blockIdxToIndex.find(bid);
             if (iter == _blockIdxToIndex.end()) {
@@ -405,6 +407,11 @@ future_lite::coro::Lazy<std::vector<FSResult<size_t>>> CompressFileReader::Batch
     }
     sort(lostBlocks.begin(), lostBlocks.end());
     lostBlocks.resize(distance(lostBlocks.begin(), unique(lostBlocks.begin(), lostBlocks.end())));
+    if (option.blockCounter) {
+        // every distinct block is loaded and decompressed once, however many ios of the batch hit it
+        option.blockCounter->compressBlockAccessCount += blockAccessCount;
+        option.blockCounter->compressBlockLoadCount += lostBlocks.size();
+    }
     if (!lostBlocks.empty()) {
         size_t idx = 0;
         size_t requiredCompressor = min(batchSize, lostBlocks.size());
@@ -438,6 +445,10 @@ future_lite::coro::Lazy<std::vector<FSResult<size_t>>> CompressFileReader::Batch
                 for (size_t ioIdx = 0; ioIdx < batchIO.size(); ++ioIdx) {
                     auto& single = batchIO[ioIdx];
                     pair<size_t, size_t> range = GetBlockRange(single.offset, single.len);
+                    if (range.first > blockInfo[i].first && range.second > range.first) {
+                        // ios are ordered by offset, the rest start after this block
+                        break;
+                    }
                     if (blockInfo[i].first >= range.first && blockInfo[i].first < range.second) {
                         if (batchResult[i] != ErrorCode::FSEC_OK) {
                             ret[ioIdx].ec = batchResult[i];
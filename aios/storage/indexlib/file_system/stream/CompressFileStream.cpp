@@ -60,7 +60,8 @@ CompressFileStream::BatchRead(file_system::BatchIO& batchIO, file_system::ReadOp
         // TODO (yiping.typ) : maybe use pool is better
         fileReader.reset(_fileReader->CreateSessionReader(nullptr));
     }
-    return fileReader->BatchRead(batchIO, option);
+    // the session reader has to outlive the read, keep it in this frame
+    co_return co_await fileReader->BatchRead(batchIO, option);
 }
 
 std::shared_ptr<FileStream> CompressFileStream::CreateSessionStream(autil::mem_pool::Pool* pool) const
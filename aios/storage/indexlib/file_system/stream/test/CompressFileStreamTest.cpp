@@ -1,6 +1,7 @@
 #include "indexlib/file_system/stream/CompressFileStream.h"
 
 #include "autil/Thread.h"
+#include "future_lite/coro/Lazy.h"
 #include "indexlib/file_system/Directory.h"
 #include "indexlib/file_system/FileSystemCreator.h"
 #include "indexlib/file_system/FileSystemOptions.h"
@@ -9,6 +10,7 @@
 #include "indexlib/file_system/file/CompressFileWriter.h"
 #include "indexlib/file_system/load_config/MmapLoadStrategy.h"
 #include "indexlib/file_system/test/LoadConfigListCreator.h"
+#include "indexlib/util/cache/BlockAccessCounter.h"
 #include "unittest/unittest.h"
 
 namespace indexlib::file_system {
@@ -173,4 +175,51 @@ TEST_F(CompressFileStreamTest, TestConcurreny)
     }
 }
 
+TEST_F(CompressFileStreamTest, TestBatchReadBlockCounter)
+{
+    std::string filePath = "tmp";
+    auto dir = GetRootDirectory("");
+    auto compressWriter = dir->CreateFileWriter(filePath, WriterOption::Compress("lz4", 1024)).GetOrThrow();
+    size_t dataLen = 8 * 1024;
+    std::string oriData(dataLen, '\0');
+    for (size_t i = 0; i < dataLen; ++i) {
+        oriData[i] = (char)(i * 3 % 127);
+    }
+    compressWriter->Write(oriData.data(), oriData.size()).GetOrThrow();
+    compressWriter->Close().GetOrThrow();
+
+    auto compressReader = std::dynamic_pointer_cast<CompressFileReader>(
+        dir->CreateFileReader(filePath, ReaderOption::SupportCompress(FSOT_LOAD_CONFIG)).GetOrThrow());
+    auto fileStream = std::make_shared<CompressFileStream>(compressReader, false, nullptr);
+    char buffer[4][64];
+    util::BlockAccessCounter counter;
+    ReadOption option;
+    option.blockCounter = &counter;
+    {
+        // three ios share block 0, the last one spans block 1 and 2
+        BatchIO batchIO({{buffer[0], 16, 0}, {buffer[1], 16, 100}, {buffer[2], 16, 1000}, {buffer[3], 64, 2020}});
+        auto result = future_lite::coro::syncAwait(fileStream->BatchRead(batchIO, option));
+        ASSERT_EQ(batchIO.size(), result.size());
+        for (size_t i = 0; i < batchIO.size(); ++i) {
+            ASSERT_EQ(batchIO[i].len, result[i].GetOrThrow());
+            ASSERT_EQ(0, oriData.compare(batchIO[i].offset, batchIO[i].len, (char*)batchIO[i].buffer, batchIO[i].len));
+        }
+        ASSERT_EQ(5, counter.compressBlockAccessCount);
+        ASSERT_EQ(3, counter.compressBlockLoadCount);
+    }
+    {
+        // unordered ios, block 2 is still held by the reader
+        counter.Reset();
+        BatchIO batchIO({{buffer[0], 16, 5000}, {buffer[1], 16, 2100}});
+        auto result = future_lite::coro::syncAwait(fileStream->BatchRead(batchIO, option));
+        ASSERT_EQ(batchIO.size(), result.size());
+        for (size_t i = 0; i < batchIO.size(); ++i) {
+            ASSERT_EQ(batchIO[i].len, result[i].GetOrThrow());
+            ASSERT_EQ(0, oriData.compare(batchIO[i].offset, batchIO[i].len, (char*)batchIO[i].buffer, batchIO[i].len));
+        }
+        ASSERT_EQ(2, counter.compressBlockAccessCount);
+        ASSERT_EQ(1, counter.compressBlockLoadCount);
+    }
+}
+
 } // namespace indexlib::file_system
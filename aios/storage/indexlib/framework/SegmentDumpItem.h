@@ -32,6 +32,10 @@ public:
 
     virtual Status Dump() noexcept = 0;
     virtual bool IsDumped() const = 0;
+    // items which only write into their own directory can be dumped concurrently with each other,
+    // the others are dumped one by one after them
+    virtual bool CanDumpConcurrently() const { return false; }
+    virtual std::string GetName() const { return ""; }
 };
 
 } // namespace indexlibv2::framework
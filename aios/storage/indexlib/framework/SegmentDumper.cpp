@@ -15,10 +15,13 @@
  */
 #include "indexlib/framework/SegmentDumper.h"
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <mutex>
 
+#include "autil/TimeUtility.h"
+#include "future_lite/coro/Collect.h"
 #include "future_lite/coro/Lazy.h"
 #include "indexlib/file_system/Directory.h"
 #include "indexlib/framework/Locator.h"
@@ -49,6 +52,84 @@ Status SegmentDumper::StoreSegmentInfo()
     return status;
 }
 
+Status SegmentDumper::DumpItem(const std::shared_ptr<SegmentDumpItem>& dumpItem)
+{
+    autil::ScopedTime2 timer;
+    auto status = dumpItem->Dump();
+    auto name = dumpItem->GetName();
+    if (!name.empty()) {
+        TABLET_LOG(INFO, "dump item [%s] of segment[%d] %s, time_used[%.3f]s", name.c_str(), GetSegmentId(),
+                   status.IsOK() ? "success" : "failed", timer.done_sec());
+        kmonitor::MetricsTags tags("index", name);
+        INDEXLIB_FM_REPORT_METRIC_WITH_TAGS_AND_VALUE(&tags, dumpIndexLatency, timer.done_ms());
+    }
+    return status;
+}
+
+future_lite::coro::Lazy<Status>
+SegmentDumper::DumpItemsWorker(const std::vector<std::shared_ptr<SegmentDumpItem>>* dumpItems,
+                               std::atomic<size_t>* nextItemIdx)
+{
+    // workers pull items one by one, so a slow index does not hold up the items queued behind it
+    while (true) {
+        size_t idx = nextItemIdx->fetch_add(1);
+        if (idx >= dumpItems->size()) {
+            break;
+        }
+        auto status = DumpItem((*dumpItems)[idx]);
+        if (!status.IsOK()) {
+            // stop the other workers from picking up new items
+            nextItemIdx->store(dumpItems->size());
+            co_return status;
+        }
+    }
+    co_return Status::OK();
+}
+
+Status SegmentDumper::DumpItems(const std::vector<std::shared_ptr<SegmentDumpItem>>& dumpItems,
+                                future_lite::Executor* executor)
+{
+    std::vector<std::shared_ptr<SegmentDumpItem>> concurrentItems;
+    std::vector<std::shared_ptr<SegmentDumpItem>> sequentialItems;
+    for (const auto& dumpItem : dumpItems) {
+        if (executor && _dumpThreadCount > 1 && dumpItem->CanDumpConcurrently()) {
+            concurrentItems.push_back(dumpItem);
+        } else {
+            sequentialItems.push_back(dumpItem);
+        }
+    }
+    if (concurrentItems.size() == 1) {
+        sequentialItems.insert(sequentialItems.begin(), concurrentItems[0]);
+        concurrentItems.clear();
+    }
+    if (!concurrentItems.empty()) {
+        size_t workerCount = std::min(concurrentItems.size(), (size_t)_dumpThreadCount);
+        TABLET_LOG(INFO, "dump [%lu] items of segment[%d] with [%lu] workers", concurrentItems.size(),
+                   GetSegmentId(), workerCount);
+        std::atomic<size_t> nextItemIdx(0);
+        std::vector<future_lite::coro::RescheduleLazy<Status>> workers;
+        for (size_t i = 0; i < workerCount; ++i) {
+            workers.push_back(DumpItemsWorker(&concurrentItems, &nextItemIdx).via(executor));
+        }
+        auto results = future_lite::coro::syncAwait(future_lite::coro::collectAll(std::move(workers)));
+        for (auto& result : results) {
+            if (result.hasError()) {
+                return Status::InternalError("dump segment item failed with exception");
+            }
+            if (!result.value().IsOK()) {
+                return result.value();
+            }
+        }
+    }
+    for (const auto& dumpItem : sequentialItems) {
+        auto status = DumpItem(dumpItem);
+        if (!status.IsOK()) {
+            return status;
+        }
+    }
+    return Status::OK();
+}
+
 Status SegmentDumper::Dump(future_lite::Executor* executor)
 {
     indexlib::util::ScopeLatencyReporter scopeTime(GetdumpSegmentLatencyMetric().get());
@@ -56,13 +137,10 @@ Status SegmentDumper::Dump(future_lite::Executor* executor)
     auto [st, dumpItems] = _dumpingSegment->CreateSegmentDumpItems();
     RETURN_IF_STATUS_ERROR(st, "create dump param failed, segId[%d]", segId);
 
-    for (size_t i = 0; i < dumpItems.size(); ++i) {
-        auto& dumpItem = dumpItems[i];
-        auto status = dumpItem->Dump();
-        if (!status.IsOK()) {
-            TABLET_LOG(ERROR, "dump segment failed, segId[%d], error:%s", segId, status.ToString().c_str());
-            return status;
-        }
+    auto dumpStatus = DumpItems(dumpItems, executor);
+    if (!dumpStatus.IsOK()) {
+        TABLET_LOG(ERROR, "dump segment failed, segId[%d], error:%s", segId, dumpStatus.ToString().c_str());
+        return dumpStatus;
     }
     auto status = StoreSegmentInfo();
     if (!status.IsOK()) {
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <assert.h>
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -48,15 +49,18 @@ class SegmentDumper : public SegmentDumpable
 {
 public:
     SegmentDumper(const std::string& tabletName, const std::shared_ptr<MemSegment>& segment, int64_t dumpExpandMemSize,
-                  std::shared_ptr<kmonitor::MetricsReporter> metricsReporter)
+                  std::shared_ptr<kmonitor::MetricsReporter> metricsReporter, uint32_t dumpThreadCount = 1)
         : _tabletName(tabletName)
         , _dumpingSegment(segment)
         , _dumpExpandMemSize(dumpExpandMemSize)
         , _metricsReporter(metricsReporter)
+        , _dumpThreadCount(dumpThreadCount)
     {
         if (_metricsReporter) {
             REGISTER_METRIC_WITH_INDEXLIB_PREFIX(_metricsReporter, dumpSegmentLatency, "build/dumpSegmentLatency",
                                                  kmonitor::GAUGE);
+            REGISTER_METRIC_WITH_INDEXLIB_PREFIX(_metricsReporter, dumpIndexLatency, "build/dumpIndexLatency",
+                                                 kmonitor::GAUGE);
         }
         _dumpingSegment->SetSegmentStatus(Segment::SegmentStatus::ST_DUMPING);
     }
@@ -71,13 +75,21 @@ public:
 
 private:
     virtual Status StoreSegmentInfo();
+    Status DumpItems(const std::vector<std::shared_ptr<SegmentDumpItem>>& dumpItems,
+                     future_lite::Executor* executor);
+    Status DumpItem(const std::shared_ptr<SegmentDumpItem>& dumpItem);
+    future_lite::coro::Lazy<Status> DumpItemsWorker(const std::vector<std::shared_ptr<SegmentDumpItem>>* dumpItems,
+                                                    std::atomic<size_t>* nextItemIdx);
 
 private:
     std::string _tabletName;
     std::shared_ptr<MemSegment> _dumpingSegment;
     int64_t _dumpExpandMemSize;
     std::shared_ptr<kmonitor::MetricsReporter> _metricsReporter;
+    // max concurrent dump items, bounded by build_config.dump_thread_count which dump memory is estimated with
+    uint32_t _dumpThreadCount;
     INDEXLIB_FM_DECLARE_METRIC(dumpSegmentLatency);
+    INDEXLIB_FM_DECLARE_METRIC(dumpIndexLatency);
 
     AUTIL_LOG_DECLARE();
 };
@@ -29,5 +29,6 @@ public:
 
     MOCK_METHOD(Status, Dump, (), (noexcept, override));
     MOCK_METHOD(bool, IsDumped, (), (const, override));
+    MOCK_METHOD(bool, CanDumpConcurrently, (), (const, override));
 };
 } // namespace indexlibv2::framework
@@ -28,8 +28,8 @@ class MockSegmentDumper : public SegmentDumper
 {
 public:
     MockSegmentDumper(const std::shared_ptr<MemSegment>& segment, int64_t dumpExpandMemSize,
-                      std::shared_ptr<kmonitor::MetricsReporter> metricsReporter)
-        : SegmentDumper("mock", segment, dumpExpandMemSize, metricsReporter)
+                      std::shared_ptr<kmonitor::MetricsReporter> metricsReporter, uint32_t dumpThreadCount = 1)
+        : SegmentDumper("mock", segment, dumpExpandMemSize, metricsReporter, dumpThreadCount)
     {
     }
     ~MockSegmentDumper() = default;
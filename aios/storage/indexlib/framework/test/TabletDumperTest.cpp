@@ -1,5 +1,12 @@
 #include "indexlib/framework/TabletDumper.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <unistd.h>
+
 #include "future_lite/executors/SimpleExecutor.h"
 #include "indexlib/framework/Version.h"
 #include "indexlib/framework/mock/MockMemSegment.h"
@@ -35,7 +42,8 @@ auto createSegmentDumpItem(bool success)
     return dumpItem;
 }
 
-auto createSegmentDumper(segmentid_t segmentId, const std::vector<std::shared_ptr<SegmentDumpItem>>& segmentDumpItems)
+auto createSegmentDumper(segmentid_t segmentId, const std::vector<std::shared_ptr<SegmentDumpItem>>& segmentDumpItems,
+                         uint32_t dumpThreadCount = 1)
 {
     SegmentMeta segmentMeta(segmentId);
     int64_t dumpExpandMemSize = 2048;
@@ -44,7 +52,7 @@ auto createSegmentDumper(segmentid_t segmentId, const std::vector<std::shared_pt
     EXPECT_CALL(*memSegment, CreateSegmentDumpItems())
         .WillRepeatedly(Return(std::make_pair(Status::OK(), segmentDumpItems)));
     EXPECT_CALL(*memSegment, EndDump()).WillRepeatedly(Return());
-    auto segmentDumper = std::make_unique<MockSegmentDumper>(memSegment, dumpExpandMemSize, nullptr);
+    auto segmentDumper = std::make_unique<MockSegmentDumper>(memSegment, dumpExpandMemSize, nullptr, dumpThreadCount);
     EXPECT_CALL(*segmentDumper, StoreSegmentInfo()).WillRepeatedly(Return(Status::OK()));
     assert(memSegment->GetSegmentStatus() == Segment::SegmentStatus::ST_DUMPING);
     return segmentDumper;
@@ -114,6 +122,93 @@ TEST_F(TabletDumperTest, testDump)
     }
 }
 
+namespace {
+// dump items block here until `target` of them dump at the same time, so concurrency is
+// observed without relying on sleeps
+class DumpGate
+{
+public:
+    explicit DumpGate(int32_t target) : _target(target) {}
+
+public:
+    void Enter()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _maxDumpingCount = std::max(_maxDumpingCount, ++_dumpingCount);
+        if (_dumpingCount >= _target) {
+            _released = true;
+            _cond.notify_all();
+        }
+        // bounded, a dumper that never reaches the target fails the max count check instead of hanging
+        _cond.wait_for(lock, std::chrono::seconds(10), [this]() { return _released; });
+    }
+    void Leave()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        --_dumpingCount;
+    }
+    int32_t GetDumpingCount()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _dumpingCount;
+    }
+    int32_t GetMaxDumpingCount()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _maxDumpingCount;
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    int32_t _target;
+    int32_t _dumpingCount = 0;
+    int32_t _maxDumpingCount = 0;
+    bool _released = false;
+};
+} // namespace
+
+TEST_F(TabletDumperTest, testDumpItemsConcurrently)
+{
+    auto createConcurrentDumpItem = [](bool success, DumpGate* gate) {
+        auto dumpItem = std::make_shared<MockSegmentDumpItem>();
+        EXPECT_CALL(*dumpItem, CanDumpConcurrently()).WillRepeatedly(Return(true));
+        EXPECT_CALL(*dumpItem, Dump()).Times(testing::AtMost(1)).WillOnce([=]() noexcept {
+            gate->Enter();
+            gate->Leave();
+            return success ? Status::OK() : Status::Corruption();
+        });
+        return dumpItem;
+    };
+    {
+        // concurrent items run on executor bounded by dump thread count, others run after them
+        DumpGate gate(/*target=*/3);
+        std::vector<std::shared_ptr<SegmentDumpItem>> dumpItems;
+        for (size_t i = 0; i < 6; ++i) {
+            dumpItems.push_back(createConcurrentDumpItem(true, &gate));
+        }
+        auto sequentialItem = std::make_shared<MockSegmentDumpItem>();
+        EXPECT_CALL(*sequentialItem, Dump()).Times(1).WillOnce([&]() noexcept {
+            EXPECT_EQ(0, gate.GetDumpingCount());
+            return Status::OK();
+        });
+        dumpItems.push_back(sequentialItem);
+        auto segmentDumper = createSegmentDumper(510234, dumpItems, /*dumpThreadCount=*/3);
+        ASSERT_TRUE(segmentDumper->Dump(_executor.get()).IsOK());
+        ASSERT_EQ(3, gate.GetMaxDumpingCount());
+    }
+    {
+        // one failed item fails the segment dump
+        DumpGate gate(/*target=*/2);
+        std::vector<std::shared_ptr<SegmentDumpItem>> dumpItems;
+        dumpItems.push_back(createConcurrentDumpItem(true, &gate));
+        dumpItems.push_back(createConcurrentDumpItem(false, &gate));
+        dumpItems.push_back(createConcurrentDumpItem(true, &gate));
+        auto segmentDumper = createSegmentDumper(510235, dumpItems, /*dumpThreadCount=*/2);
+        ASSERT_TRUE(segmentDumper->Dump(_executor.get()).IsCorruption());
+    }
+}
+
 TEST_F(TabletDumperTest, testDumpWithTrim)
 {
     int64_t dumperInterval = 1;
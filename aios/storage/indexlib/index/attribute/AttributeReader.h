@@ -75,6 +75,13 @@ public:
     virtual std::unique_ptr<AttributeIteratorBase> CreateSequentialIterator() const = 0;
     virtual bool GetSortedDocIdRange(const indexlib::index::RangeDescription& range, const DocIdRange& rangeLimit,
                                      DocIdRange& resultRange) const = 0;
+    // appends the parts of rangeLimit = [begin, end) that may hold a value in range according to segment zone maps,
+    // false if no segment inside rangeLimit carries a zone map
+    virtual bool GetZoneMapDocIdRanges(const indexlib::index::RangeDescription& range, const DocIdRange& rangeLimit,
+                                       DocIdRangeVector& resultRanges) const
+    {
+        return false;
+    }
     virtual std::string GetAttributeName() const = 0;
     virtual std::shared_ptr<AttributeDiskIndexer> TEST_GetIndexer(docid_t docId) const = 0;
 
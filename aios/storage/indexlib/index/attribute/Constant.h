@@ -26,6 +26,7 @@ constexpr uint32_t ATTRIBUTE_U32OFFSET_THRESHOLD_MAX = 0xFFFFFFFFL;
 inline const std::string ATTRIBUTE_DATA_FILE_NAME = "data";
 inline const std::string ATTRIBUTE_OFFSET_FILE_NAME = "offset";
 inline const std::string ATTRIBUTE_DATA_INFO_FILE_NAME = "data_info";
+inline const std::string ATTRIBUTE_ZONE_MAP_FILE_NAME = "zone_map";
 inline const std::string ATTRIBUTE_DATA_EXTEND_SLICE_FILE_NAME = "extend_slice_data";
 inline const std::string ATTRIBUTE_OFFSET_EXTEND_SUFFIX = ".extend64";
 inline const std::string ATTRIBUTE_EQUAL_COMPRESS_UPDATE_EXTEND_SUFFIX = ".extend_equal_compress";
@@ -35,6 +36,7 @@ inline const std::string ATTRIBUTE_U32OFFSET_THRESHOLD = "u32offset_threshold";
 inline const std::string ATTRIBUTE_COMPRESS_TYPE = "compress_type";
 inline const std::string ATTRIBUTE_SLICE_COUNT = "slice_count";
 inline const std::string ATTRIBUTE_SLICE_IDX = "slice_idx";
+inline const std::string ATTRIBUTE_ZONE_MAP_BLOCK_SIZE = "zone_map_block_size";
 } // namespace indexlib::index
 
 namespace indexlib {
@@ -58,6 +60,8 @@ using indexlib::index::ATTRIBUTE_SLICE_IDX;
 using indexlib::index::ATTRIBUTE_U32OFFSET_THRESHOLD;
 using indexlib::index::ATTRIBUTE_U32OFFSET_THRESHOLD_MAX;
 using indexlib::index::ATTRIBUTE_UPDATABLE;
+using indexlib::index::ATTRIBUTE_ZONE_MAP_BLOCK_SIZE;
+using indexlib::index::ATTRIBUTE_ZONE_MAP_FILE_NAME;
 } // namespace indexlibv2::index
 
 namespace indexlibv2 {
@@ -38,6 +38,7 @@
 #include "indexlib/index/attribute/Common.h"
 #include "indexlib/index/attribute/SingleValueAttributeCompressReader.h"
 #include "indexlib/index/attribute/SingleValueAttributeUnCompressReader.h"
+#include "indexlib/index/attribute/SingleValueAttributeZoneMap.h"
 #include "indexlib/index/attribute/SliceInfo.h"
 #include "indexlib/index/attribute/config/AttributeConfig.h"
 #include "indexlib/index/attribute/format/SingleValueAttributeFormatter.h"
@@ -139,6 +140,10 @@ public:
     template <class Compare>
     Status Search(T value, const DocIdRange& rangeLimit, const config::SortPattern& sortType, docid_t& docId) const;
     int32_t SearchNullCount(const config::SortPattern& sortType) const;
+    // appends the parts of rangeLimit = [begin, end) that may hold a value in [from, to], false if the segment has
+    // no usable zone map
+    bool GetZoneMapDocIdRanges(const T& from, const T& to, const DocIdRange& rangeLimit,
+                               DocIdRangeVector& resultRanges) const;
 
 public:
     uint32_t TEST_GetDataLength(docid_t docId, autil::mem_pool::Pool*) const override;
@@ -151,6 +156,7 @@ private:
 protected:
     std::unique_ptr<SingleValueAttributeCompressReader<T>> _compressReader;
     std::unique_ptr<SingleValueAttributeUnCompressReader<T>> _unCompressReader;
+    std::unique_ptr<SingleValueAttributeZoneMap<T>> _zoneMap;
     AttributeReaderType _attrReaderType = AttributeReaderType::UNKNOWN;
 
 private:
@@ -221,6 +227,15 @@ SingleValueAttributeDiskIndexer<T>::Open(const std::shared_ptr<config::IIndexCon
             status = _unCompressReader->Open(_attrConfig, fieldDir, sliceDocCount, _indexerParam.segmentId);
         }
         RETURN_IF_STATUS_ERROR(status, "open SingleValueAttributeReader fail, type[%d]", (int)_attrReaderType);
+        if (SingleValueAttributeZoneMap<T>::IsSupported(_attrConfig)) {
+            auto zoneMap = std::make_unique<SingleValueAttributeZoneMap<T>>();
+            bool isZoneMapExist = false;
+            status = zoneMap->Load(fieldDir, sliceDocCount, isZoneMapExist);
+            RETURN_IF_STATUS_ERROR(status, "load zone map failed, segId[%d]", _indexerParam.segmentId);
+            if (isZoneMapExist) {
+                _zoneMap = std::move(zoneMap);
+            }
+        }
     }
     AUTIL_LOG(INFO, "Finishing loading segment(%d) for attribute(%s), used[%.3f]s", _indexerParam.segmentId,
               attrPath.c_str(), timer.done_sec());
@@ -235,6 +250,9 @@ size_t SingleValueAttributeDiskIndexer<T>::EvaluateCurrentMemUsed()
         return totalMemUsed;
     }
     DISPATCH(EvaluateCurrentMemUsed, totalMemUsed);
+    if (_zoneMap) {
+        totalMemUsed += _zoneMap->EvaluateCurrentMemUsed();
+    }
     return totalMemUsed;
 }
 
@@ -321,15 +339,36 @@ inline bool SingleValueAttributeDiskIndexer<T>::UpdateField(docid_t docId, const
 {
     auto buf = (uint8_t*)value.data();
     auto bufLen = value.size();
+    bool ret = false;
     if (_attrReaderType == AttributeReaderType::COMPRESS_READER) {
-        return _compressReader->UpdateField(docId, buf, bufLen);
+        ret = _compressReader->UpdateField(docId, buf, bufLen);
     } else if (_attrReaderType == AttributeReaderType::UNCOMPRESS_READER) {
-        return _unCompressReader->UpdateField(docId, buf, bufLen, isNull);
+        ret = _unCompressReader->UpdateField(docId, buf, bufLen, isNull);
     } else {
         AUTIL_LOG(ERROR, "un-support reader type [%d]!", (int)_attrReaderType);
         assert(false);
     }
-    return false;
+    if (ret && _zoneMap) {
+        if (isNull || bufLen < sizeof(T)) {
+            _zoneMap->Update(docId, T {}, /*isNull*/ true);
+        } else {
+            _zoneMap->Update(docId, *(T*)buf, /*isNull*/ false);
+        }
+    }
+    return ret;
+}
+
+template <typename T>
+bool SingleValueAttributeDiskIndexer<T>::GetZoneMapDocIdRanges(const T& from, const T& to,
+                                                               const DocIdRange& rangeLimit,
+                                                               DocIdRangeVector& resultRanges) const
+{
+    // patch values are applied at read time and are not reflected in the zone map
+    if (!_zoneMap || _patch) {
+        return false;
+    }
+    _zoneMap->FindDocIdRanges(from, to, rangeLimit, resultRanges);
+    return true;
 }
 
 template <typename T>
@@ -16,6 +16,8 @@
 #pragma once
 #include <algorithm>
 #include <functional>
+#include <limits>
+#include <type_traits>
 
 #include "autil/Log.h"
 #include "indexlib/base/Define.h"
@@ -70,6 +72,8 @@ public:
     // rangeLimit = [begin, end), resultRange = [begin, end)
     bool GetSortedDocIdRange(const indexlib::index::RangeDescription& range, const DocIdRange& rangeLimit,
                              DocIdRange& resultRange) const override;
+    bool GetZoneMapDocIdRanges(const indexlib::index::RangeDescription& range, const DocIdRange& rangeLimit,
+                               DocIdRangeVector& resultRanges) const override;
     std::string GetAttributeName() const override;
     std::shared_ptr<AttributeDiskIndexer> TEST_GetIndexer(docid_t docId) const override;
     void EnableAccessCountors() override;
@@ -166,6 +170,68 @@ inline bool SingleValueAttributeReader<autil::uint128_t>::GetSortedDocIdRange(
     return false;
 }
 
+template <typename T>
+bool SingleValueAttributeReader<T>::GetZoneMapDocIdRanges(const indexlib::index::RangeDescription& range,
+                                                          const DocIdRange& rangeLimit,
+                                                          DocIdRangeVector& resultRanges) const
+{
+    if constexpr (!std::is_arithmetic_v<T>) {
+        return false;
+    } else {
+        T from = std::numeric_limits<T>::lowest();
+        T to = std::numeric_limits<T>::max();
+        if (range.from != indexlib::index::RangeDescription::INFINITE &&
+            !autil::StringUtil::fromString(range.from, from)) {
+            return false;
+        }
+        if (range.to != indexlib::index::RangeDescription::INFINITE && !autil::StringUtil::fromString(range.to, to)) {
+            return false;
+        }
+        auto appendRange = [](docid_t begin, docid_t end, DocIdRangeVector& ranges) {
+            if (begin >= end) {
+                return;
+            }
+            if (!ranges.empty() && ranges.back().second == begin) {
+                ranges.back().second = end;
+            } else {
+                ranges.emplace_back(begin, end);
+            }
+        };
+        bool hasZoneMap = false;
+        DocIdRangeVector ranges;
+        docid_t baseDocId = 0;
+        for (size_t i = 0; i < _segmentDocCount.size() && baseDocId < rangeLimit.second; ++i) {
+            docid_t segEndDocId = baseDocId + (docid_t)_segmentDocCount[i];
+            DocIdRange segRangeLimit(std::max(rangeLimit.first, baseDocId) - baseDocId,
+                                     std::min(rangeLimit.second, segEndDocId) - baseDocId);
+            if (segRangeLimit.first < segRangeLimit.second) {
+                DocIdRangeVector segRanges;
+                if (to < from) {
+                    hasZoneMap = true;
+                } else if (_onDiskIndexers[i] &&
+                           _onDiskIndexers[i]->GetZoneMapDocIdRanges(from, to, segRangeLimit, segRanges)) {
+                    hasZoneMap = true;
+                    for (const auto& [begin, end] : segRanges) {
+                        appendRange(begin + baseDocId, end + baseDocId, ranges);
+                    }
+                } else {
+                    appendRange(segRangeLimit.first + baseDocId, segRangeLimit.second + baseDocId, ranges);
+                }
+            }
+            baseDocId = segEndDocId;
+        }
+        if (!hasZoneMap) {
+            return false;
+        }
+        // building segments have no zone map
+        appendRange(std::max(rangeLimit.first, baseDocId), rangeLimit.second, ranges);
+        for (const auto& docIdRange : ranges) {
+            appendRange(docIdRange.first, docIdRange.second, resultRanges);
+        }
+        return true;
+    }
+}
+
 template <typename T>
 std::string SingleValueAttributeReader<T>::GetAttributeName() const
 {
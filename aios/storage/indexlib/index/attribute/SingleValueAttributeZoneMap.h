@@ -0,0 +1,290 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "autil/Log.h"
+#include "autil/NoCopyable.h"
+#include "indexlib/base/Status.h"
+#include "indexlib/base/Types.h"
+#include "indexlib/file_system/IDirectory.h"
+#include "indexlib/file_system/ReaderOption.h"
+#include "indexlib/file_system/RemoveOption.h"
+#include "indexlib/file_system/WriterOption.h"
+#include "indexlib/index/attribute/Constant.h"
+#include "indexlib/index/attribute/config/AttributeConfig.h"
+#include "indexlib/index/attribute/format/SingleEncodedNullValue.h"
+#include "indexlib/index/common/field_format/attribute/TypeInfo.h"
+
+namespace indexlibv2::index {
+
+// Per docid block min/max/null-count summary of a single value attribute segment, lets range predicates skip whole
+// blocks. In-place updates only widen a block, so the summary always covers the current values.
+template <typename T>
+class SingleValueAttributeZoneMap : private autil::NoCopyable
+{
+public:
+    static constexpr uint32_t DEFAULT_BLOCK_SIZE = 4096;
+
+    struct Block {
+        T minValue {};
+        T maxValue {};
+        uint32_t nullCount = 0;
+        bool hasValue = false;
+    };
+
+public:
+    explicit SingleValueAttributeZoneMap(uint32_t blockSize = DEFAULT_BLOCK_SIZE) : _blockSize(blockSize), _docCount(0)
+    {
+        assert(_blockSize > 0);
+    }
+    ~SingleValueAttributeZoneMap() = default;
+
+public:
+    static bool IsSupported(const std::shared_ptr<AttributeConfig>& attrConfig);
+
+    // docs must be appended in docid order
+    void Append(const T& value, bool isNull);
+    void Update(docid_t docId, const T& value, bool isNull);
+
+    Status Store(const std::shared_ptr<indexlib::file_system::IDirectory>& directory) const;
+    Status Load(const std::shared_ptr<indexlib::file_system::IDirectory>& directory, uint64_t docCount,
+                bool& isExist);
+
+    // appends the parts of rangeLimit = [begin, end) whose blocks may hold a value in [from, to], nulls count as the
+    // encoded null value
+    void FindDocIdRanges(const T& from, const T& to, const DocIdRange& rangeLimit,
+                         DocIdRangeVector& resultRanges) const;
+
+    uint32_t GetBlockSize() const { return _blockSize; }
+    uint64_t GetDocCount() const { return _docCount; }
+    const std::vector<Block>& GetBlocks() const { return _blocks; }
+    size_t EvaluateCurrentMemUsed() const { return _blocks.capacity() * sizeof(Block); }
+
+private:
+    uint32_t GetBlockDocCount(size_t blockIdx) const;
+    static void AddValue(Block& block, const T& value);
+    static void AppendDocIdRange(docid_t begin, docid_t end, DocIdRangeVector& resultRanges);
+
+private:
+    static constexpr size_t HEADER_SIZE = sizeof(uint32_t) + sizeof(uint64_t);
+    static constexpr size_t BLOCK_STORE_SIZE = sizeof(T) * 2 + sizeof(uint32_t);
+
+    uint32_t _blockSize;
+    uint64_t _docCount;
+    std::vector<Block> _blocks;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+AUTIL_LOG_SETUP_TEMPLATE(indexlib.index, SingleValueAttributeZoneMap, T);
+
+template <typename T>
+bool SingleValueAttributeZoneMap<T>::IsSupported(const std::shared_ptr<AttributeConfig>& attrConfig)
+{
+    if constexpr (!std::is_arithmetic_v<T>) {
+        return false;
+    } else {
+        // encoded types (fp16, date, ...) store values that are not comparable with the field value
+        return attrConfig && attrConfig->GetZoneMapBlockSize() > 0 && !attrConfig->IsMultiValue() &&
+               attrConfig->GetFieldType() == TypeInfo<T>::GetFieldType();
+    }
+}
+
+template <typename T>
+void SingleValueAttributeZoneMap<T>::Append(const T& value, bool isNull)
+{
+    if (_docCount % _blockSize == 0) {
+        _blocks.emplace_back();
+    }
+    ++_docCount;
+    Block& block = _blocks.back();
+    if (isNull) {
+        ++block.nullCount;
+        return;
+    }
+    AddValue(block, value);
+}
+
+template <typename T>
+void SingleValueAttributeZoneMap<T>::Update(docid_t docId, const T& value, bool isNull)
+{
+    size_t blockIdx = docId / _blockSize;
+    if (docId < 0 || blockIdx >= _blocks.size()) {
+        return;
+    }
+    Block& block = _blocks[blockIdx];
+    if (isNull) {
+        // old value is unknown, null count becomes an upper bound
+        block.nullCount = std::min(block.nullCount + 1, GetBlockDocCount(blockIdx));
+        return;
+    }
+    AddValue(block, value);
+}
+
+template <typename T>
+void SingleValueAttributeZoneMap<T>::AddValue(Block& block, const T& value)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        // nan never satisfies a range predicate
+        if (std::isnan(value)) {
+            return;
+        }
+    }
+    if (!block.hasValue) {
+        block.minValue = value;
+        block.maxValue = value;
+        block.hasValue = true;
+        return;
+    }
+    if (value < block.minValue) {
+        block.minValue = value;
+    }
+    if (block.maxValue < value) {
+        block.maxValue = value;
+    }
+}
+
+template <typename T>
+uint32_t SingleValueAttributeZoneMap<T>::GetBlockDocCount(size_t blockIdx) const
+{
+    uint64_t blockBegin = (uint64_t)blockIdx * _blockSize;
+    return std::min((uint64_t)_blockSize, _docCount - blockBegin);
+}
+
+template <typename T>
+Status SingleValueAttributeZoneMap<T>::Store(const std::shared_ptr<indexlib::file_system::IDirectory>& directory) const
+{
+    std::string content;
+    content.reserve(HEADER_SIZE + _blocks.size() * BLOCK_STORE_SIZE);
+    content.append((const char*)&_blockSize, sizeof(_blockSize));
+    content.append((const char*)&_docCount, sizeof(_docCount));
+    for (const auto& block : _blocks) {
+        content.append((const char*)&block.minValue, sizeof(T));
+        content.append((const char*)&block.maxValue, sizeof(T));
+        content.append((const char*)&block.nullCount, sizeof(uint32_t));
+    }
+    auto status =
+        directory->RemoveFile(ATTRIBUTE_ZONE_MAP_FILE_NAME, indexlib::file_system::RemoveOption::MayNonExist())
+            .Status();
+    RETURN_IF_STATUS_ERROR(status, "remove zone map in [%s] failed", directory->DebugString().c_str());
+    return directory
+        ->Store(ATTRIBUTE_ZONE_MAP_FILE_NAME, content, indexlib::file_system::WriterOption::AtomicDump())
+        .Status();
+}
+
+template <typename T>
+Status SingleValueAttributeZoneMap<T>::Load(const std::shared_ptr<indexlib::file_system::IDirectory>& directory,
+                                            uint64_t docCount, bool& isExist)
+{
+    Status status;
+    std::tie(status, isExist) = directory->IsExist(ATTRIBUTE_ZONE_MAP_FILE_NAME).StatusWith();
+    RETURN_IF_STATUS_ERROR(status, "check zone map in [%s] failed", directory->DebugString().c_str());
+    if (!isExist) {
+        return Status::OK();
+    }
+    std::string content;
+    status = directory
+                 ->Load(ATTRIBUTE_ZONE_MAP_FILE_NAME,
+                        indexlib::file_system::ReaderOption(indexlib::file_system::FSOT_MEM), content)
+                 .Status();
+    RETURN_IF_STATUS_ERROR(status, "load zone map in [%s] failed", directory->DebugString().c_str());
+    if (content.size() < HEADER_SIZE) {
+        RETURN_STATUS_ERROR(Corruption, "zone map in [%s] is truncated", directory->DebugString().c_str());
+    }
+    const char* cursor = content.data();
+    uint32_t blockSize = *(const uint32_t*)cursor;
+    cursor += sizeof(uint32_t);
+    uint64_t storedDocCount = *(const uint64_t*)cursor;
+    cursor += sizeof(uint64_t);
+    if (blockSize == 0 || storedDocCount != docCount) {
+        RETURN_STATUS_ERROR(Corruption, "zone map in [%s] mismatch, block size [%u], doc count [%lu] vs [%lu]",
+                            directory->DebugString().c_str(), blockSize, storedDocCount, docCount);
+    }
+    size_t blockCount = (docCount + blockSize - 1) / blockSize;
+    if (content.size() != HEADER_SIZE + blockCount * BLOCK_STORE_SIZE) {
+        RETURN_STATUS_ERROR(Corruption, "zone map in [%s] has unexpected size [%lu]", directory->DebugString().c_str(),
+                            content.size());
+    }
+    _blockSize = blockSize;
+    _docCount = docCount;
+    _blocks.resize(blockCount);
+    for (size_t i = 0; i < blockCount; ++i) {
+        Block& block = _blocks[i];
+        memcpy(&block.minValue, cursor, sizeof(T));
+        cursor += sizeof(T);
+        memcpy(&block.maxValue, cursor, sizeof(T));
+        cursor += sizeof(T);
+        memcpy(&block.nullCount, cursor, sizeof(uint32_t));
+        cursor += sizeof(uint32_t);
+        block.hasValue = block.nullCount < GetBlockDocCount(i);
+    }
+    return Status::OK();
+}
+
+template <typename T>
+void SingleValueAttributeZoneMap<T>::FindDocIdRanges(const T& from, const T& to, const DocIdRange& rangeLimit,
+                                                     DocIdRangeVector& resultRanges) const
+{
+    if (rangeLimit.first >= rangeLimit.second) {
+        return;
+    }
+    // null docs are read back as the encoded null value, a block holding nulls matches whenever that value does
+    T nullValue {};
+    SingleEncodedNullValue::GetEncodedValue<T>((void*)&nullValue);
+    bool nullMatch = !(nullValue < from) && !(to < nullValue);
+    docid_t coveredEnd = std::min(rangeLimit.second, (docid_t)_docCount);
+    for (size_t i = rangeLimit.first / _blockSize; i < _blocks.size(); ++i) {
+        docid_t blockBegin = (docid_t)(i * _blockSize);
+        if (blockBegin >= coveredEnd) {
+            break;
+        }
+        const Block& block = _blocks[i];
+        bool valueMatch = block.hasValue && !(block.maxValue < from) && !(to < block.minValue);
+        if (!valueMatch && !(nullMatch && block.nullCount > 0)) {
+            continue;
+        }
+        AppendDocIdRange(std::max(rangeLimit.first, blockBegin), std::min(coveredEnd, blockBegin + (docid_t)_blockSize),
+                         resultRanges);
+    }
+    if (rangeLimit.second > coveredEnd) {
+        // docs not described by the zone map are kept
+        AppendDocIdRange(std::max(rangeLimit.first, coveredEnd), rangeLimit.second, resultRanges);
+    }
+}
+
+template <typename T>
+void SingleValueAttributeZoneMap<T>::AppendDocIdRange(docid_t begin, docid_t end, DocIdRangeVector& resultRanges)
+{
+    if (begin >= end) {
+        return;
+    }
+    if (!resultRanges.empty() && resultRanges.back().second == begin) {
+        resultRanges.back().second = end;
+        return;
+    }
+    resultRanges.emplace_back(begin, end);
+}
+
+} // namespace indexlibv2::index
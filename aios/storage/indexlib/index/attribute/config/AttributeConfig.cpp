@@ -42,6 +42,7 @@ struct AttributeConfig::Impl {
     indexlib::IndexStatus status = indexlib::is_normal;
     bool updatable = true; // need initialize by FieldConfig
     int64_t sliceCount = 1;
+    uint32_t zoneMapBlockSize = 0; // 0 means no zone map
     // not jsonize, no sliceIdx means no slice
     int64_t sliceIdx = -1;
 };
@@ -81,6 +82,7 @@ Status AttributeConfig::Init(const std::shared_ptr<config::FieldConfig>& fieldCo
 
 int64_t AttributeConfig::GetSliceCount() const { return _impl->sliceCount; }
 int64_t AttributeConfig::GetSliceIdx() const { return _impl->sliceIdx; }
+uint32_t AttributeConfig::GetZoneMapBlockSize() const { return _impl->zoneMapBlockSize; }
 
 void AttributeConfig::Deserialize(const autil::legacy::Any& any, size_t idxInJsonArray,
                                   const config::IndexConfigDeserializeResource& resource)
@@ -128,6 +130,8 @@ void AttributeConfig::Deserialize(const autil::legacy::Any& any, size_t idxInJso
     json.Jsonize(index::ATTRIBUTE_UPDATABLE, _impl->updatable, _impl->updatable);
     // slice_count
     json.Jsonize(index::ATTRIBUTE_SLICE_COUNT, _impl->sliceCount, _impl->sliceCount);
+    // zone_map_block_size
+    json.Jsonize(index::ATTRIBUTE_ZONE_MAP_BLOCK_SIZE, _impl->zoneMapBlockSize, _impl->zoneMapBlockSize);
 }
 
 void AttributeConfig::Serialize(autil::legacy::Jsonizable::JsonWrapper& json) const
@@ -162,6 +166,10 @@ void AttributeConfig::Serialize(autil::legacy::Jsonizable::JsonWrapper& json) co
     if (_impl->sliceCount > 1) {
         json.Jsonize(index::ATTRIBUTE_SLICE_COUNT, _impl->sliceCount);
     }
+    // zone_map_block_size
+    if (_impl->zoneMapBlockSize > 0) {
+        json.Jsonize(index::ATTRIBUTE_ZONE_MAP_BLOCK_SIZE, _impl->zoneMapBlockSize);
+    }
 }
 
 const std::string& AttributeConfig::GetIndexType() const { return ATTRIBUTE_INDEX_TYPE_STR; }
@@ -199,6 +207,7 @@ void AttributeConfig::Check() const
     CheckUniqEncode();
     CheckEquivalentCompress();
     CheckBlockFpEncode();
+    CheckZoneMap();
     // not support
     // CheckFp16Encode();
     // CheckFloatInt8Encode();
@@ -223,6 +232,14 @@ void AttributeConfig::CheckFieldType() const
     }
 }
 
+void AttributeConfig::CheckZoneMap() const
+{
+    if (_impl->zoneMapBlockSize > 0 && IsMultiValue()) {
+        INDEXLIB_FATAL_ERROR(Schema, "zone map only supports single value attribute, fieldName[%s]",
+                             GetIndexName().c_str());
+    }
+}
+
 void AttributeConfig::CheckEquivalentCompress() const
 {
     // only not equal type allows to use compress
@@ -392,6 +409,7 @@ Status AttributeConfig::SetCompressType(const std::string& compressStr)
 void AttributeConfig::SetAttrId(attrid_t id) { _impl->attrId = id; }
 
 void AttributeConfig::SetDefragSlicePercent(uint64_t percent) { _impl->defragSlicePercent = percent; }
+void AttributeConfig::SetZoneMapBlockSize(uint32_t blockSize) { _impl->zoneMapBlockSize = blockSize; }
 
 void AttributeConfig::SetFileCompressConfig(
     const std::shared_ptr<indexlib::config::FileCompressConfig>& fileCompressConfig)
@@ -462,6 +480,7 @@ std::shared_ptr<AttributeConfig> AttributeConfig::Clone()
     attrConfig->_impl->status = _impl->status;
     attrConfig->_impl->updatable = _impl->updatable;
     attrConfig->_impl->sliceCount = _impl->sliceCount;
+    attrConfig->_impl->zoneMapBlockSize = _impl->zoneMapBlockSize;
     return attrConfig;
 }
 
@@ -25,6 +25,7 @@
 #include "indexlib/file_system/IDirectory.h"
 #include "indexlib/file_system/file/CompressFileWriter.h"
 #include "indexlib/index/DocMapDumpParams.h"
+#include "indexlib/index/attribute/SingleValueAttributeZoneMap.h"
 #include "indexlib/index/attribute/config/AttributeConfig.h"
 #include "indexlib/index/attribute/format/SingleEncodedNullValue.h"
 #include "indexlib/index/common/FileCompressParamHelper.h"
@@ -74,6 +75,7 @@ private:
                     autil::mem_pool::PoolBase* dumpPool, const std::shared_ptr<framework::DumpParams>& dumpParams);
     Status DumpUncompressedFile(const std::shared_ptr<indexlib::file_system::FileWriter>& dataFile,
                                 std::vector<docid_t>* new2old);
+    Status DumpZoneMap(const std::shared_ptr<indexlib::file_system::Directory>& dir, std::vector<docid_t>* new2old);
     template <bool SupportNull, bool IsSortDump>
     Status DumpUncompressedFileImpl(const std::shared_ptr<indexlib::file_system::FileWriter>& dataFile,
                                     std::vector<docid_t>* new2old);
@@ -224,6 +226,31 @@ Status SingleValueAttributeMemFormatter<T>::DumpFile(const std::shared_ptr<index
     }
     status = fileWriter->Close().Status();
     AUTIL_LOG(DEBUG, "Finish dumping attribute to data file : %s", fileWriter->DebugString().c_str());
+    if (!status.IsOK()) {
+        return status;
+    }
+    return DumpZoneMap(dir, new2old);
+}
+
+template <typename T>
+Status SingleValueAttributeMemFormatter<T>::DumpZoneMap(const std::shared_ptr<indexlib::file_system::Directory>& dir,
+                                                        std::vector<docid_t>* new2old)
+{
+    if (!SingleValueAttributeZoneMap<T>::IsSupported(_attrConfig)) {
+        return Status::OK();
+    }
+    SingleValueAttributeZoneMap<T> zoneMap(_attrConfig->GetZoneMapBlockSize());
+    for (size_t i = 0; i < _data->Size(); ++i) {
+        docid_t docId = new2old ? new2old->at(i) : (docid_t)i;
+        T value {};
+        bool isNull = false;
+        Read(docId, value, isNull);
+        zoneMap.Append(value, isNull);
+    }
+    auto status = zoneMap.Store(dir->GetIDirectory());
+    if (!status.IsOK()) {
+        AUTIL_LOG(ERROR, "fail to dump zone map, ErrorInfo: [%s]", status.ToString().c_str());
+    }
     return status;
 }
 
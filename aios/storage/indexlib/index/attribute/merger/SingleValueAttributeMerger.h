@@ -27,6 +27,7 @@
 #include "indexlib/index/attribute/SingleValueAttributeDiskIndexer.h"
 #include "indexlib/index/attribute/SliceInfo.h"
 #include "indexlib/index/attribute/format/SingleValueAttributeFormatter.h"
+#include "indexlib/index/attribute/SingleValueAttributeZoneMap.h"
 #include "indexlib/index/attribute/format/SingleValueDataAppender.h"
 #include "indexlib/index/attribute/merger/AttributeMerger.h"
 #include "indexlib/index/attribute/merger/AttributeMergerCreator.h"
@@ -71,6 +72,8 @@ private:
         size_t outputIdx = 0;
         std::shared_ptr<AttributeFormatter> formatter;
         std::shared_ptr<SingleValueDataAppender> dataAppender;
+        std::shared_ptr<SingleValueAttributeZoneMap<T>> zoneMap;
+        std::shared_ptr<indexlib::file_system::IDirectory> attributeDir;
 
         OutputData() = default;
 
@@ -82,6 +85,9 @@ private:
             assert(dataAppender);
             assert(dataAppender->GetTotalCount() == (uint32_t)(globalDocId));
             dataAppender->Append(value, isNull);
+            if (zoneMap) {
+                zoneMap->Append(value, isNull);
+            }
         }
 
         bool BufferFull() const
@@ -111,6 +117,7 @@ private:
                               const std::vector<std::shared_ptr<framework::SegmentMeta>>& targetSegmentMetas);
     void DestroyBuffers();
     void CloseFiles();
+    Status DumpZoneMaps();
 
     Status MergePatches(const SegmentMergeInfos segmentMergeInfos);
     Status CreateDiskIndexers(const SegmentMergeInfos& segMergeInfos,
@@ -199,6 +206,8 @@ Status SingleValueAttributeMerger<T>::DoMerge(const SegmentMergeInfos& segMergeI
     }
 
     CloseFiles();
+    status = DumpZoneMaps();
+    RETURN_IF_STATUS_ERROR(status, "dump zone map failed.");
     DestroyBuffers();
 
     status = MergePatches(segMergeInfos);
@@ -282,6 +291,11 @@ Status SingleValueAttributeMerger<T>::PrepareOutputDatas(
             return Status::InternalError();
         }
         output.dataAppender->Init(DEFAULT_RECORD_COUNT, fileWriter);
+        if (SingleValueAttributeZoneMap<T>::IsSupported(_attributeConfig)) {
+            output.zoneMap =
+                std::make_shared<SingleValueAttributeZoneMap<T>>(_attributeConfig->GetZoneMapBlockSize());
+            output.attributeDir = attrDir;
+        }
 
         AUTIL_LOG(INFO, "create output data for dir [%s]", attrDir->DebugString().c_str());
         return status;
@@ -406,4 +420,20 @@ void SingleValueAttributeMerger<T>::CloseFiles()
     }
 }
 
+template <typename T>
+Status SingleValueAttributeMerger<T>::DumpZoneMaps()
+{
+    std::string attrPath = _attributeConfig->GetAttrName() + "/" + _attributeConfig->GetSliceDir();
+    for (auto& outputData : _segOutputMapper.GetOutputs()) {
+        if (!outputData.zoneMap) {
+            continue;
+        }
+        auto [status, directory] = outputData.attributeDir->GetDirectory(attrPath).StatusWith();
+        RETURN_IF_STATUS_ERROR(status, "get attribute [%s] directory failed", attrPath.c_str());
+        status = outputData.zoneMap->Store(directory);
+        RETURN_IF_STATUS_ERROR(status, "store zone map for attribute [%s] failed", attrPath.c_str());
+    }
+    return Status::OK();
+}
+
 } // namespace indexlibv2::index
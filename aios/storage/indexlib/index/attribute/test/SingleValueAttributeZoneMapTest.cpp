@@ -0,0 +1,125 @@
+#include "indexlib/index/attribute/SingleValueAttributeZoneMap.h"
+
+#include <limits>
+
+#include "indexlib/file_system/IDirectory.h"
+#include "indexlib/index/attribute/test/AttributeTestUtil.h"
+#include "unittest/unittest.h"
+
+namespace indexlibv2::index {
+
+class SingleValueAttributeZoneMapTest : public TESTBASE
+{
+public:
+    SingleValueAttributeZoneMapTest() = default;
+    ~SingleValueAttributeZoneMapTest() = default;
+    void setUp() override {}
+    void tearDown() override {}
+
+private:
+    // block i holds values [i * 100, i * 100 + 3]
+    void PrepareZoneMap(SingleValueAttributeZoneMap<int32_t>& zoneMap, uint32_t docCount)
+    {
+        for (uint32_t i = 0; i < docCount; ++i) {
+            zoneMap.Append((int32_t)(i / 4 * 100 + i % 4), false);
+        }
+    }
+};
+
+TEST_F(SingleValueAttributeZoneMapTest, TestIsSupported)
+{
+    auto attrConfig = AttributeTestUtil::CreateAttrConfig<int32_t>(/*isMultiValue*/ false, std::nullopt);
+    ASSERT_FALSE(SingleValueAttributeZoneMap<int32_t>::IsSupported(attrConfig));
+    attrConfig->SetZoneMapBlockSize(128);
+    ASSERT_TRUE(SingleValueAttributeZoneMap<int32_t>::IsSupported(attrConfig));
+    ASSERT_FALSE(SingleValueAttributeZoneMap<int64_t>::IsSupported(attrConfig));
+    ASSERT_FALSE(SingleValueAttributeZoneMap<int32_t>::IsSupported(nullptr));
+}
+
+TEST_F(SingleValueAttributeZoneMapTest, TestFindDocIdRanges)
+{
+    SingleValueAttributeZoneMap<int32_t> zoneMap(4);
+    PrepareZoneMap(zoneMap, 14);
+    ASSERT_EQ(4u, zoneMap.GetBlocks().size());
+    ASSERT_EQ(14u, zoneMap.GetDocCount());
+
+    DocIdRangeVector ranges;
+    zoneMap.FindDocIdRanges(100, 200, {0, 14}, ranges);
+    ASSERT_EQ(DocIdRangeVector({{4, 12}}), ranges);
+
+    ranges.clear();
+    zoneMap.FindDocIdRanges(50, 60, {0, 14}, ranges);
+    ASSERT_TRUE(ranges.empty());
+
+    ranges.clear();
+    zoneMap.FindDocIdRanges(0, 300, {6, 13}, ranges);
+    ASSERT_EQ(DocIdRangeVector({{6, 13}}), ranges);
+
+    // docs beyond the zone map are always kept
+    ranges.clear();
+    zoneMap.FindDocIdRanges(300, 300, {10, 20}, ranges);
+    ASSERT_EQ(DocIdRangeVector({{12, 20}}), ranges);
+}
+
+TEST_F(SingleValueAttributeZoneMapTest, TestNullAndUpdate)
+{
+    SingleValueAttributeZoneMap<int32_t> zoneMap(2);
+    zoneMap.Append(0, true);
+    zoneMap.Append(0, true);
+    zoneMap.Append(10, false);
+    zoneMap.Append(11, false);
+
+    DocIdRangeVector ranges;
+    zoneMap.FindDocIdRanges(0, 100, {0, 4}, ranges);
+    ASSERT_EQ(DocIdRangeVector({{2, 4}}), ranges);
+
+    // nulls are read back as the encoded null value
+    ranges.clear();
+    zoneMap.FindDocIdRanges(std::numeric_limits<int32_t>::min(), -1, {0, 4}, ranges);
+    ASSERT_EQ(DocIdRangeVector({{0, 2}}), ranges);
+
+    zoneMap.Update(1, 50, false);
+    zoneMap.Update(3, 0, true);
+    ranges.clear();
+    zoneMap.FindDocIdRanges(40, 60, {0, 4}, ranges);
+    ASSERT_EQ(DocIdRangeVector({{0, 2}}), ranges);
+    ASSERT_EQ(2u, zoneMap.GetBlocks()[0].nullCount);
+    ASSERT_EQ(1u, zoneMap.GetBlocks()[1].nullCount);
+    ranges.clear();
+    zoneMap.FindDocIdRanges(std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::min(), {0, 4}, ranges);
+    ASSERT_EQ(DocIdRangeVector({{0, 4}}), ranges);
+
+    // out of range update is ignored
+    zoneMap.Update(4, 1000, false);
+    ASSERT_EQ(2u, zoneMap.GetBlocks().size());
+}
+
+TEST_F(SingleValueAttributeZoneMapTest, TestStoreAndLoad)
+{
+    auto dir = indexlib::file_system::IDirectory::GetPhysicalDirectory(GET_TEMP_DATA_PATH());
+    SingleValueAttributeZoneMap<int32_t> zoneMap(4);
+    PrepareZoneMap(zoneMap, 14);
+    ASSERT_TRUE(zoneMap.Store(dir).IsOK());
+
+    SingleValueAttributeZoneMap<int32_t> loaded;
+    bool isExist = false;
+    ASSERT_TRUE(loaded.Load(dir, 14, isExist).IsOK());
+    ASSERT_TRUE(isExist);
+    ASSERT_EQ(4u, loaded.GetBlockSize());
+    ASSERT_EQ(zoneMap.GetBlocks().size(), loaded.GetBlocks().size());
+    for (size_t i = 0; i < loaded.GetBlocks().size(); ++i) {
+        ASSERT_EQ(zoneMap.GetBlocks()[i].minValue, loaded.GetBlocks()[i].minValue);
+        ASSERT_EQ(zoneMap.GetBlocks()[i].maxValue, loaded.GetBlocks()[i].maxValue);
+        ASSERT_TRUE(loaded.GetBlocks()[i].hasValue);
+    }
+
+    SingleValueAttributeZoneMap<int32_t> mismatch;
+    ASSERT_TRUE(mismatch.Load(dir, 15, isExist).IsCorruption());
+
+    auto emptyDir = dir->MakeDirectory("empty", indexlib::file_system::DirectoryOption()).GetOrThrow();
+    SingleValueAttributeZoneMap<int32_t> notExist;
+    ASSERT_TRUE(notExist.Load(emptyDir, 14, isExist).IsOK());
+    ASSERT_FALSE(isExist);
+}
+
+} // namespace indexlibv2::index
@@ -40,6 +40,10 @@ public:
     inline future_lite::coro::Lazy<indexlib::index::Result<bool>>
     GetValueInBlockAsync(const Key& key, uint64_t blockId, uint64_t keyCountInBlock,
                          indexlib::file_system::ReadOption option, Value* value) const noexcept override;
+    // the block is fetched from cache once for all keys
+    indexlib::index::ErrorCode GetValuesInBlock(const Key* keys, size_t keyCount, uint64_t blockId,
+                                                uint64_t keyCountInBlock, indexlib::file_system::ReadOption option,
+                                                Value* values, bool* found) const noexcept override;
     AccessMode GetMode() const override { return AccessMode::CACHE; }
 
 private:
@@ -113,4 +117,49 @@ BlockArrayCacheDataAccessor<Key, Value>::GetValueInBlockAsync(const Key& key, ui
     KVItem* dataEnd = dataStart + keyCountInBlock;
     co_return this->LocateItem(dataStart, dataEnd, key, value);
 }
+
+template <typename Key, typename Value>
+indexlib::index::ErrorCode BlockArrayCacheDataAccessor<Key, Value>::GetValuesInBlock(
+    const Key* keys, size_t keyCount, uint64_t blockId, uint64_t keyCountInBlock,
+    indexlib::file_system::ReadOption option, Value* values, bool* found) const noexcept
+{
+    if (keyCount == 1) {
+        auto ret = this->GetValueInBlock(keys[0], blockId, keyCountInBlock, option, values);
+        found[0] = ret.Ok() && ret.Value();
+        return ret.GetErrorCode();
+    }
+    indexlib::file_system::BlockFileAccessor* accessor = _blockFileNode->GetAccessor();
+    assert(accessor);
+
+    uint64_t dataBlockOffset = this->_dataBlockSize * blockId;
+    uint64_t realDataLength = keyCountInBlock * sizeof(KVItem);
+    uint64_t blockCount = accessor->GetBlockCount(dataBlockOffset, realDataLength);
+    if (blockCount == 1) {
+        std::vector<size_t> blockIdxs(1, accessor->GetBlockIdx(dataBlockOffset));
+        auto getHandlesRet = future_lite::coro::syncAwait(accessor->GetBlockHandles(blockIdxs, option));
+        assert(getHandlesRet.size() == 1);
+        if (!getHandlesRet[0].OK()) {
+            AUTIL_LOG(ERROR, "read data from [%s] fail, offset[%zu], len[%zu]",
+                      this->_fileReader->DebugString().c_str(), dataBlockOffset, realDataLength);
+            return indexlib::index::ConvertFSErrorCode(getHandlesRet[0].ec);
+        }
+        auto blockHandle = std::move(getHandlesRet[0].result);
+        KVItem* dataStart = (KVItem*)(blockHandle.GetData() + accessor->GetInBlockOffset(dataBlockOffset));
+        this->LocateItems(dataStart, dataStart + keyCountInBlock, keys, keyCount, values, found);
+        return indexlib::index::ErrorCode::OK;
+    }
+    std::vector<char> dataBuf(this->_dataBlockSize);
+    indexlib::file_system::BatchIO batchIO;
+    batchIO.emplace_back(dataBuf.data(), realDataLength, dataBlockOffset);
+    auto readResult = future_lite::coro::syncAwait(this->_fileReader->BatchRead(batchIO, option));
+    assert(readResult.size() == 1);
+    if (!readResult[0].OK()) {
+        AUTIL_LOG(ERROR, "read data from [%s] fail, offset[%zu], len[%zu]", this->_fileReader->DebugString().c_str(),
+                  dataBlockOffset, realDataLength);
+        return indexlib::index::ConvertFSErrorCode(readResult[0].ec);
+    }
+    KVItem* dataStart = (KVItem*)dataBuf.data();
+    this->LocateItems(dataStart, dataStart + keyCountInBlock, keys, keyCount, values, found);
+    return indexlib::index::ErrorCode::OK;
+}
 }} // namespace indexlibv2::index
@@ -48,10 +48,27 @@ public:
     virtual future_lite::coro::Lazy<indexlib::index::Result<bool>>
     GetValueInBlockAsync(const Key& key, uint64_t blockId, uint64_t keyCountInBlock,
                          indexlib::file_system::ReadOption option, Value* value) const noexcept = 0;
+    // keys are sorted and all located in @blockId, found[i] tells whether values[i] is filled
+    virtual indexlib::index::ErrorCode GetValuesInBlock(const Key* keys, size_t keyCount, uint64_t blockId,
+                                                        uint64_t keyCountInBlock,
+                                                        indexlib::file_system::ReadOption option, Value* values,
+                                                        bool* found) const noexcept
+    {
+        for (size_t i = 0; i < keyCount; ++i) {
+            auto ret = GetValueInBlock(keys[i], blockId, keyCountInBlock, option, &values[i]);
+            if (!ret.Ok()) {
+                return ret.GetErrorCode();
+            }
+            found[i] = ret.Value();
+        }
+        return indexlib::index::ErrorCode::OK;
+    }
     virtual AccessMode GetMode() const = 0;
 
 protected:
     inline bool LocateItem(KVItem* dataStart, KVItem* dataEnd, const Key& key, Value* value) const noexcept;
+    inline void LocateItems(KVItem* dataStart, KVItem* dataEnd, const Key* keys, size_t keyCount, Value* values,
+                            bool* found) const noexcept;
 
 protected:
     indexlib::file_system::FileReaderPtr _fileReader;
@@ -69,4 +86,18 @@ inline bool BlockArrayDataAccessor<Key, Value>::LocateItem(KVItem* dataStart, KV
     *value = kvItem->value;
     return true;
 }
+
+template <typename Key, typename Value>
+inline void BlockArrayDataAccessor<Key, Value>::LocateItems(KVItem* dataStart, KVItem* dataEnd, const Key* keys,
+                                                            size_t keyCount, Value* values, bool* found) const noexcept
+{
+    KVItem* kvItem = dataStart;
+    for (size_t i = 0; i < keyCount; ++i) {
+        kvItem = std::lower_bound(kvItem, dataEnd, keys[i]);
+        found[i] = kvItem != dataEnd && kvItem->key == keys[i];
+        if (found[i]) {
+            values[i] = kvItem->value;
+        }
+    }
+}
 }} // namespace indexlibv2::index
@@ -43,6 +43,14 @@ public:
     inline future_lite::coro::Lazy<indexlib::index::Result<bool>>
     GetValueInBlockAsync(const Key& key, uint64_t blockId, uint64_t keyCountInBlock,
                          indexlib::file_system::ReadOption option, Value* value) const noexcept override;
+    indexlib::index::ErrorCode GetValuesInBlock(const Key* keys, size_t keyCount, uint64_t blockId,
+                                                uint64_t keyCountInBlock, indexlib::file_system::ReadOption option,
+                                                Value* values, bool* found) const noexcept override
+    {
+        KVItem* dataStart = (KVItem*)((char*)_data + this->_dataBlockSize * blockId);
+        this->LocateItems(dataStart, dataStart + keyCountInBlock, keys, keyCount, values, found);
+        return indexlib::index::ErrorCode::OK;
+    }
     AccessMode GetMode() const override { return AccessMode::MEMORY; }
 
 private:
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #pragma once
+#include <algorithm>
 #include <memory>
 
 #include "autil/EnvUtil.h"
@@ -73,6 +74,10 @@ public:
     inline future_lite::coro::Lazy<indexlib::index::Result<bool>>
     FindAsync(const Key& key, indexlib::file_system::ReadOption option, Value* value) noexcept;
 
+    // Find for sorted keys, keys falling into the same data block share one block read
+    indexlib::index::ErrorCode BatchFind(const Key* keys, size_t keyCount, indexlib::file_system::ReadOption option,
+                                         Value* values, bool* found) noexcept;
+
     inline uint64_t GetItemCount() const;
 
     // Create Iterator, you should call method @Init before
@@ -192,6 +197,38 @@ BlockArrayReader<Key, Value>::FindAsync(const Key& key, indexlib::file_system::R
     co_return co_await _accessor->GetValueInBlockAsync(key, blockId, keyCountInBlock, option, value);
 }
 
+template <typename Key, typename Value>
+indexlib::index::ErrorCode BlockArrayReader<Key, Value>::BatchFind(const Key* keys, size_t keyCount,
+                                                                   indexlib::file_system::ReadOption option,
+                                                                   Value* values, bool* found) noexcept
+{
+    size_t begin = 0;
+    while (begin < keyCount) {
+        assert(begin == 0 || !(keys[begin] < keys[begin - 1]));
+        uint64_t blockId = 0;
+        if (!GetBlockId(keys[begin], &blockId)) {
+            // keys are sorted, all following keys are beyond the last block too
+            std::fill(found + begin, found + keyCount, false);
+            break;
+        }
+        // bottom level meta key of a block is its last key, following keys up to it share the block
+        const Key& blockLastKey = _metaKeyBaseAddress[_leftBound.back() + blockId];
+        size_t end = begin + 1;
+        while (end < keyCount && !(blockLastKey < keys[end])) {
+            ++end;
+        }
+        uint64_t keyCountInBlock =
+            blockId + 1 == _blockCount ? _itemCount - _itemCountPerBlock * blockId : _itemCountPerBlock;
+        auto ec = _accessor->GetValuesInBlock(keys + begin, end - begin, blockId, keyCountInBlock, option,
+                                              values + begin, found + begin);
+        if (ec != indexlib::index::ErrorCode::OK) {
+            return ec;
+        }
+        begin = end;
+    }
+    return indexlib::index::ErrorCode::OK;
+}
+
 template <typename Key, typename Value>
 inline uint64_t BlockArrayReader<Key, Value>::GetItemCount() const
 {
@@ -59,6 +59,9 @@ static constexpr const char* TRUNCATE_OPTION_CONFIG = "truncate_option_config";
 static constexpr const char* TRUNCATE_META_STRATEGY_TYPE = "truncate_meta";
 static constexpr const char* SEGMENT_MERGE_PLAN_INDEX = "segment_merge_plan_index";
 static constexpr const char* SOURCE_VERSION_TIMESTAMP = "source_version_timestamp"; // second
+static constexpr const char* MERGE_METRIC_PROVIDER = "merge_metric_provider";
+// merge config option, worker threads merging disjoint term ranges of one inverted index
+static constexpr const char* TERM_MERGE_THREAD_COUNT = "inverted_index_term_merge_thread_count";
 
 static constexpr const char* DOC_PAYLOAD_FIELD_NAME = "DOC_PAYLOAD";
 static constexpr const char* DOC_PAYLOAD_FACTOR_FIELD_NAME = "DOC_PAYLOAD_FACTOR";
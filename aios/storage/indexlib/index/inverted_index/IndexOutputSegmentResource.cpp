@@ -61,6 +61,13 @@ void IndexOutputSegmentResource::Init(
     CreateBitmapIndexDataWriter(ioConfig, simplePool, needCreateBitmapIndex);
 }
 
+void IndexOutputSegmentResource::Init(const std::shared_ptr<IndexDataWriter>& normalIndexDataWriter,
+                                      const std::shared_ptr<IndexDataWriter>& bitmapIndexDataWriter)
+{
+    _normalIndexDataWriter = normalIndexDataWriter;
+    _bitmapIndexDataWriter = bitmapIndexDataWriter;
+}
+
 void IndexOutputSegmentResource::CreateNormalIndexDataWriter(
     const std::shared_ptr<indexlibv2::config::InvertedIndexConfig>& indexConfig, const file_system::IOConfig& IOConfig,
     util::SimplePool* simplePool)
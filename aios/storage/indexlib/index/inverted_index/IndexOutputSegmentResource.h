@@ -50,6 +50,9 @@ public:
               const std::shared_ptr<indexlibv2::framework::SegmentStatistics>& segmentstatistics,
               util::SimplePool* simplePool, bool hasAdaptiveBitMap);
 
+    // write into the given writers, e.g. in memory writers of a term range merge fragment
+    void Init(const std::shared_ptr<IndexDataWriter>& normalIndexDataWriter,
+              const std::shared_ptr<IndexDataWriter>& bitmapIndexDataWriter);
     void Reset();
     std::shared_ptr<IndexDataWriter>& GetIndexDataWriter(SegmentTermInfo::TermIndexMode mode);
 
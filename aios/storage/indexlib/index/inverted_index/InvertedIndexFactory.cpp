@@ -333,6 +333,16 @@ __attribute__((constructor)) static void RegisterHooks()
                 std::any_cast<std::vector<indexlibv2::config::TruncateStrategy>&>(hookOptions[TRUNCATE_STRATEGY]);
             json.Jsonize(TRUNCATE_STRATEGY, truncateStrategyVec, truncateStrategyVec);
         });
+    indexlibv2::config::MergeConfig::RegisterOptionHook(
+        TERM_MERGE_THREAD_COUNT,
+        [](std::map<std::string, std::any>& hookOptions) {
+            hookOptions.emplace(TERM_MERGE_THREAD_COUNT, (uint32_t)1);
+        },
+        [](autil::legacy::Jsonizable::JsonWrapper& json, std::map<std::string, std::any>& hookOptions) {
+            assert(hookOptions.count(TERM_MERGE_THREAD_COUNT) > 0);
+            auto& threadCount = std::any_cast<uint32_t&>(hookOptions[TERM_MERGE_THREAD_COUNT]);
+            json.Jsonize(TERM_MERGE_THREAD_COUNT, threadCount, threadCount);
+        });
 }
 
 } // namespace indexlib::index
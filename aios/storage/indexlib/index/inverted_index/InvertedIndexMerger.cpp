@@ -15,6 +15,8 @@
  */
 #include "indexlib/index/inverted_index/InvertedIndexMerger.h"
 
+#include "autil/ThreadPool.h"
+#include "autil/TimeUtility.h"
 #include "indexlib/config/ITabletSchema.h"
 #include "indexlib/file_system/file/CompressFileInfo.h"
 #include "indexlib/file_system/relocatable/RelocatableFolder.h"
@@ -29,6 +31,7 @@
 #include "indexlib/index/inverted_index/PostingMergerImpl.h"
 #include "indexlib/index/inverted_index/PostingWriter.h"
 #include "indexlib/index/inverted_index/SegmentTermInfoQueue.h"
+#include "indexlib/index/inverted_index/TermRangeMergeFragment.h"
 #include "indexlib/index/inverted_index/builtin_index/adaptive_bitmap/AdaptiveBitmapIndexWriterCreator.h"
 #include "indexlib/index/inverted_index/builtin_index/adaptive_bitmap/MultiAdaptiveBitmapIndexWriter.h"
 #include "indexlib/index/inverted_index/builtin_index/bitmap/BitmapPostingMerger.h"
@@ -36,6 +39,7 @@
 #include "indexlib/index/inverted_index/config/TruncateOptionConfig.h"
 #include "indexlib/index/inverted_index/format/dictionary/DictionaryCreator.h"
 #include "indexlib/index/inverted_index/format/dictionary/DictionaryIterator.h"
+#include "indexlib/index/inverted_index/format/PostingDecoder.h"
 #include "indexlib/index/inverted_index/format/dictionary/DictionaryReader.h"
 #include "indexlib/index/inverted_index/patch/InvertedIndexDedupPatchFileMerger.h"
 #include "indexlib/index/inverted_index/truncate/BucketMap.h"
@@ -44,6 +48,7 @@
 #include "indexlib/index/inverted_index/truncate/TruncateIndexWriterCreator.h"
 #include "indexlib/util/MMapAllocator.h"
 #include "indexlib/util/Status2Exception.h"
+#include "indexlib/util/metrics/MetricProvider.h"
 
 namespace indexlib::index {
 namespace {
@@ -55,10 +60,29 @@ using indexlibv2::framework::SegmentMeta;
 using indexlibv2::framework::SegmentStatistics;
 using indexlibv2::index::DocMapper;
 using indexlibv2::index::IIndexMerger;
+
+// a term range ends after this many terms or source postings, every worker cuts the term stream the same way
+constexpr size_t MAX_TERM_RANGE_TERM_COUNT = 4096;
+constexpr int64_t MAX_TERM_RANGE_TERM_FREQ = 4 * 1024 * 1024;
 } // namespace
 
 AUTIL_LOG_SETUP(indexlib.index, InvertedIndexMerger);
 
+struct InvertedIndexMerger::TermMergeWorker {
+    std::unique_ptr<SegmentTermInfoQueue> termInfoQueue;
+    std::unique_ptr<autil::mem_pool::ChunkAllocatorBase> allocator;
+    std::unique_ptr<autil::mem_pool::Pool> byteSlicePool;
+    std::unique_ptr<autil::mem_pool::RecyclePool> bufferPool;
+    util::SimplePool simplePool;
+    std::shared_ptr<PostingWriterResource> postingWriterResource;
+    std::unique_ptr<TermRangeMergeFragment> fragment;
+    bool hasFragment = false;
+    Status status;
+    size_t mergedTermCount = 0;
+    size_t mergedPostingLength = 0;
+    int64_t mergeTimeUs = 0;
+};
+
 InvertedIndexMerger::~InvertedIndexMerger()
 {
     _byteSlicePool.reset();
@@ -82,6 +106,18 @@ Status InvertedIndexMerger::Init(const std::shared_ptr<IIndexConfig>& indexConfi
         !autil::StringUtil::fromString(std::any_cast<std::string>(iter->second), _isOptimizeMerge)) {
         _isOptimizeMerge = false;
     }
+    iter = params.find(TERM_MERGE_THREAD_COUNT);
+    if (iter != params.end()) {
+        if (auto threadCount = std::any_cast<uint32_t>(&iter->second)) {
+            _termMergeThreadCount = std::max(*threadCount, 1u);
+        }
+    }
+    iter = params.find(MERGE_METRIC_PROVIDER);
+    if (iter != params.end()) {
+        if (auto metricProvider = std::any_cast<std::shared_ptr<util::MetricProvider>>(&iter->second)) {
+            _metricProvider = *metricProvider;
+        }
+    }
     _params = params;
     return Status::OK();
 }
@@ -155,19 +191,26 @@ Status InvertedIndexMerger::DoMerge(const SegmentMergeInfos& segMergeInfos,
         _termExtender->Init(segMergeInfos.targetSegments, _indexOutputSegmentResources);
     }
 
-    // Init term queue
-    auto onDiskIndexIterCreator = CreateOnDiskIndexIteratorCreator();
-    SegmentTermInfoQueue termInfoQueue(_indexConfig, onDiskIndexIterCreator);
-    status = termInfoQueue.Init(segMergeInfos.srcSegments, _patchInfos);
-    RETURN_IF_STATUS_ERROR(status, "init term info queue for index [%s] failed", _indexConfig->GetIndexName().c_str());
+    if (_termMergeThreadCount > 1 && !_termExtender) {
+        // truncate and adaptive bitmap writers see terms one by one, they stay on the sequential path
+        status = ParallelMergeTerms(segMergeInfos, docMapper);
+        RETURN_IF_STATUS_ERROR(status, "parallel merge terms for index [%s] failed", _indexName.c_str());
+    } else {
+        // Init term queue
+        auto onDiskIndexIterCreator = CreateOnDiskIndexIteratorCreator();
+        SegmentTermInfoQueue termInfoQueue(_indexConfig, onDiskIndexIterCreator);
+        status = termInfoQueue.Init(segMergeInfos.srcSegments, _patchInfos);
+        RETURN_IF_STATUS_ERROR(status, "init term info queue for index [%s] failed",
+                               _indexConfig->GetIndexName().c_str());
 
-    DictKeyInfo key;
-    while (!termInfoQueue.Empty()) {
-        SegmentTermInfo::TermIndexMode termMode;
-        const auto& segTermInfos = termInfoQueue.CurrentTermInfos(key, termMode);
-        status = MergeTerm(key, segTermInfos, termMode, docMapper, segMergeInfos.targetSegments);
-        RETURN_IF_STATUS_ERROR(status, "merge term failed.");
-        termInfoQueue.MoveToNextTerm();
+        DictKeyInfo key;
+        while (!termInfoQueue.Empty()) {
+            SegmentTermInfo::TermIndexMode termMode;
+            const auto& segTermInfos = termInfoQueue.CurrentTermInfos(key, termMode);
+            status = MergeTerm(key, segTermInfos, termMode, docMapper, segMergeInfos.targetSegments);
+            RETURN_IF_STATUS_ERROR(status, "merge term failed.");
+            termInfoQueue.MoveToNextTerm();
+        }
     }
     if (_termExtender) {
         _termExtender->Destroy();
@@ -179,20 +222,28 @@ Status InvertedIndexMerger::DoMerge(const SegmentMergeInfos& segMergeInfos,
     return Status::OK();
 }
 
-Status InvertedIndexMerger::MergeTerm(DictKeyInfo key, const SegmentTermInfos& segTermInfos,
-                                      SegmentTermInfo::TermIndexMode mode, const std::shared_ptr<DocMapper>& docMapper,
-                                      const std::vector<std::shared_ptr<SegmentMeta>>& targetSegments)
+bool InvertedIndexMerger::NeedMergeTerm(DictKeyInfo key, SegmentTermInfo::TermIndexMode mode) const
 {
     if (mode == SegmentTermInfo::TM_BITMAP) {
         // no high frequency term in repartition case, drop bitmap posting
         auto vol = _indexConfig->GetHighFreqVocabulary();
         if (!vol) {
-            return Status::OK();
+            return false;
         }
         if (!vol->Lookup(key)) {
-            return Status::OK();
+            return false;
         }
     }
+    return true;
+}
+
+Status InvertedIndexMerger::MergeTerm(DictKeyInfo key, const SegmentTermInfos& segTermInfos,
+                                      SegmentTermInfo::TermIndexMode mode, const std::shared_ptr<DocMapper>& docMapper,
+                                      const std::vector<std::shared_ptr<SegmentMeta>>& targetSegments)
+{
+    if (!NeedMergeTerm(key, mode)) {
+        return Status::OK();
+    }
 
     std::shared_ptr<PostingMerger> postingMerger = MergeTermPosting(segTermInfos, mode, docMapper, targetSegments);
     df_t df = postingMerger->GetDocFreq();
@@ -221,14 +272,185 @@ InvertedIndexMerger::MergeTermPosting(const SegmentTermInfos& segTermInfos, Segm
 {
     std::shared_ptr<PostingMerger> postingMerger;
     if (mode == SegmentTermInfo::TM_BITMAP) {
-        postingMerger.reset(CreateBitmapPostingMerger(targetSegments));
+        postingMerger.reset(CreateBitmapPostingMerger(_byteSlicePool.get(), targetSegments));
     } else {
-        postingMerger.reset(CreatePostingMerger(targetSegments));
+        postingMerger.reset(CreatePostingMerger(_postingWriterResource.get(), targetSegments));
     }
     postingMerger->Merge(segTermInfos, docMapper);
     return postingMerger;
 }
 
+int64_t InvertedIndexMerger::GetTermFreq(const SegmentTermInfos& segTermInfos)
+{
+    int64_t termFreq = 0;
+    for (const auto* segTermInfo : segTermInfos) {
+        auto [postingDecoder, patchIter] = segTermInfo->GetPosting();
+        const TermMeta* termMeta = postingDecoder ? postingDecoder->GetTermMeta() : nullptr;
+        termFreq += termMeta ? std::max<int64_t>(termMeta->GetDocFreq(), termMeta->GetTotalTermFreq()) : 1;
+    }
+    return termFreq;
+}
+
+bool InvertedIndexMerger::IsTermRangeEnd(size_t termCount, int64_t rangeTermFreq)
+{
+    return termCount >= MAX_TERM_RANGE_TERM_COUNT || rangeTermFreq >= MAX_TERM_RANGE_TERM_FREQ;
+}
+
+size_t InvertedIndexMerger::SkipTermRange(SegmentTermInfoQueue* termInfoQueue)
+{
+    DictKeyInfo key;
+    SegmentTermInfo::TermIndexMode termMode;
+    size_t termCount = 0;
+    int64_t rangeTermFreq = 0;
+    while (!termInfoQueue->Empty() && !IsTermRangeEnd(termCount, rangeTermFreq)) {
+        const auto& segTermInfos = termInfoQueue->CurrentTermInfos(key, termMode);
+        rangeTermFreq += GetTermFreq(segTermInfos);
+        ++termCount;
+        termInfoQueue->MoveToNextTerm();
+    }
+    return termCount;
+}
+
+Status InvertedIndexMerger::MergeTermRange(TermMergeWorker* worker, size_t skipRangeCount,
+                                           const std::shared_ptr<DocMapper>& docMapper,
+                                           const std::vector<std::shared_ptr<SegmentMeta>>& targetSegments)
+{
+    worker->hasFragment = false;
+    worker->fragment->Reset();
+    // ranges of other workers are only walked through, their postings are not decoded
+    auto termInfoQueue = worker->termInfoQueue.get();
+    for (size_t i = 0; i < skipRangeCount && !termInfoQueue->Empty(); ++i) {
+        SkipTermRange(termInfoQueue);
+    }
+
+    autil::ScopedTime2 timer;
+    DictKeyInfo key;
+    SegmentTermInfo::TermIndexMode termMode;
+    size_t termCount = 0;
+    int64_t rangeTermFreq = 0;
+    while (!termInfoQueue->Empty() && !IsTermRangeEnd(termCount, rangeTermFreq)) {
+        const auto& segTermInfos = termInfoQueue->CurrentTermInfos(key, termMode);
+        rangeTermFreq += GetTermFreq(segTermInfos);
+        ++termCount;
+        if (NeedMergeTerm(key, termMode)) {
+            std::shared_ptr<PostingMerger> postingMerger;
+            if (termMode == SegmentTermInfo::TM_BITMAP) {
+                postingMerger.reset(CreateBitmapPostingMerger(worker->byteSlicePool.get(), targetSegments));
+            } else {
+                postingMerger.reset(CreatePostingMerger(worker->postingWriterResource.get(), targetSegments));
+            }
+            postingMerger->Merge(segTermInfos, docMapper);
+            if (postingMerger->GetDocFreq() > 0) {
+                postingMerger->Dump(key, worker->fragment->GetIndexOutputSegmentResources());
+            }
+            postingMerger.reset();
+            worker->byteSlicePool->reset();
+            worker->bufferPool->reset();
+        }
+        termInfoQueue->MoveToNextTerm();
+    }
+    worker->hasFragment = termCount > 0;
+    worker->mergedTermCount += termCount;
+    worker->mergedPostingLength += worker->fragment->GetPostingLength();
+    worker->mergeTimeUs += timer.done_us();
+    return Status::OK();
+}
+
+Status InvertedIndexMerger::ParallelMergeTerms(const SegmentMergeInfos& segMergeInfos,
+                                               const std::shared_ptr<DocMapper>& docMapper)
+{
+    assert(!_indexOutputSegmentResources.empty());
+    bool needCreateBitmapIndex =
+        _indexOutputSegmentResources[0]->GetIndexDataWriter(SegmentTermInfo::TM_BITMAP) != nullptr;
+    const auto& targetSegments = segMergeInfos.targetSegments;
+    std::vector<std::unique_ptr<TermMergeWorker>> workers;
+    for (uint32_t i = 0; i < _termMergeThreadCount; ++i) {
+        auto worker = std::make_unique<TermMergeWorker>();
+        worker->termInfoQueue = std::make_unique<SegmentTermInfoQueue>(_indexConfig, CreateOnDiskIndexIteratorCreator());
+        auto status = worker->termInfoQueue->Init(segMergeInfos.srcSegments, _patchInfos);
+        RETURN_IF_STATUS_ERROR(status, "init term info queue for index [%s] failed", _indexName.c_str());
+        worker->allocator = std::make_unique<util::MMapAllocator>();
+        worker->byteSlicePool =
+            std::make_unique<autil::mem_pool::Pool>(worker->allocator.get(), DEFAULT_CHUNK_SIZE * 1024 * 1024);
+        worker->bufferPool =
+            std::make_unique<autil::mem_pool::RecyclePool>(worker->allocator.get(), DEFAULT_CHUNK_SIZE * 1024 * 1024);
+        worker->postingWriterResource =
+            std::make_shared<PostingWriterResource>(&worker->simplePool, worker->byteSlicePool.get(),
+                                                    worker->bufferPool.get(), _indexFormatOption.GetPostingFormatOption());
+        worker->fragment = std::make_unique<TermRangeMergeFragment>(targetSegments.size(), needCreateBitmapIndex);
+        workers.push_back(std::move(worker));
+    }
+
+    AUTIL_LOG(INFO, "merge index [%s] with [%u] term merge threads", _indexName.c_str(), _termMergeThreadCount);
+    autil::ThreadPool threadPool(_termMergeThreadCount, autil::ThreadPoolBase::DEFAULT_QUEUESIZE,
+                                 /*stopIfException*/ true);
+    threadPool.start("InvTermMerge");
+    bool finished = false;
+    for (size_t round = 0; !finished; ++round) {
+        for (size_t i = 0; i < workers.size(); ++i) {
+            // worker i merges ranges i, i + threadCount, i + 2 * threadCount ...
+            size_t skipRangeCount = (round == 0) ? i : workers.size() - 1;
+            auto worker = workers[i].get();
+            auto task = [this, worker, skipRangeCount, &docMapper, &targetSegments]() {
+                try {
+                    worker->status = MergeTermRange(worker, skipRangeCount, docMapper, targetSegments);
+                } catch (const std::exception& e) {
+                    worker->status = Status::IOError("merge term range failed, exception [%s]", e.what());
+                } catch (...) {
+                    worker->status = Status::IOError("merge term range failed, unknown exception");
+                }
+            };
+            if (threadPool.pushTask(std::move(task)) != autil::ThreadPool::ERROR_NONE) {
+                threadPool.stop();
+                AUTIL_LOG(ERROR, "push term merge task for index [%s] failed", _indexName.c_str());
+                return Status::InternalError("push term merge task failed");
+            }
+        }
+        threadPool.waitFinish();
+        for (const auto& worker : workers) {
+            if (!worker->status.IsOK()) {
+                threadPool.stop();
+                AUTIL_LOG(ERROR, "merge term range of index [%s] failed, error [%s]", _indexName.c_str(),
+                          worker->status.ToString().c_str());
+                return worker->status;
+            }
+            if (!worker->hasFragment) {
+                // term stream exhausted, following workers have nothing either
+                finished = true;
+                break;
+            }
+            worker->fragment->StitchTo(_indexOutputSegmentResources);
+        }
+    }
+    threadPool.stop();
+    ReportTermMergeThroughput(workers);
+    return Status::OK();
+}
+
+void InvertedIndexMerger::ReportTermMergeThroughput(const std::vector<std::unique_ptr<TermMergeWorker>>& workers) const
+{
+    std::shared_ptr<util::Metric> throughputMetric;
+    if (_metricProvider) {
+        throughputMetric = _metricProvider->DeclareMetric("index_task/termMergeThroughput", kmonitor::GAUGE);
+    }
+    for (size_t i = 0; i < workers.size(); ++i) {
+        const auto& worker = workers[i];
+        double seconds = std::max(worker->mergeTimeUs, (int64_t)1) / 1000000.0;
+        double termsPerSecond = worker->mergedTermCount / seconds;
+        AUTIL_LOG(INFO,
+                  "index [%s] term merge thread [%lu] merged [%lu] terms [%lu] posting bytes in [%.3f]s, "
+                  "throughput [%.1f] terms/s [%.1f] KB/s",
+                  _indexName.c_str(), i, worker->mergedTermCount, worker->mergedPostingLength, seconds, termsPerSecond,
+                  worker->mergedPostingLength / 1024.0 / seconds);
+        if (throughputMetric) {
+            kmonitor::MetricsTags tags;
+            tags.AddTag("index", _indexName);
+            tags.AddTag("thread", std::to_string(i));
+            throughputMetric->Report(&tags, termsPerSecond);
+        }
+    }
+}
+
 void InvertedIndexMerger::EndMerge()
 {
     for (auto& indexOutputSegmentResource : _indexOutputSegmentResources) {
@@ -445,16 +667,18 @@ int64_t InvertedIndexMerger::GetHashDictMaxMemoryUse(const std::vector<IIndexMer
 }
 
 PostingMerger*
-InvertedIndexMerger::CreateBitmapPostingMerger(const std::vector<std::shared_ptr<SegmentMeta>>& targetSegments)
+InvertedIndexMerger::CreateBitmapPostingMerger(autil::mem_pool::Pool* byteSlicePool,
+                                               const std::vector<std::shared_ptr<SegmentMeta>>& targetSegments)
 {
     BitmapPostingMerger* bitmapPostingMerger =
-        new BitmapPostingMerger(_byteSlicePool.get(), targetSegments, _indexConfig->GetOptionFlag());
+        new BitmapPostingMerger(byteSlicePool, targetSegments, _indexConfig->GetOptionFlag());
     return bitmapPostingMerger;
 }
 
-PostingMerger* InvertedIndexMerger::CreatePostingMerger(const std::vector<std::shared_ptr<SegmentMeta>>& targetSegments)
+PostingMerger* InvertedIndexMerger::CreatePostingMerger(PostingWriterResource* postingWriterResource,
+                                                        const std::vector<std::shared_ptr<SegmentMeta>>& targetSegments)
 {
-    PostingMergerImpl* postingMergerImpl = new PostingMergerImpl(_postingWriterResource.get(), targetSegments);
+    PostingMergerImpl* postingMergerImpl = new PostingMergerImpl(postingWriterResource, targetSegments);
     return postingMergerImpl;
 }
 
@@ -36,6 +36,10 @@ namespace indexlib::file_system {
 class RelocatableFolder;
 }
 
+namespace indexlib::util {
+class MetricProvider;
+}
+
 namespace indexlibv2::framework {
 class SegmentInfo;
 struct SegmentMeta;
@@ -66,6 +70,7 @@ class IndexOutputSegmentResource;
 class IndexTermExtender;
 class OnDiskIndexIteratorCreator;
 class PostingMerger;
+class SegmentTermInfoQueue;
 class MultiAdaptiveBitmapIndexWriter;
 struct PostingWriterResource;
 
@@ -85,10 +90,13 @@ public:
 
 protected:
     virtual std::shared_ptr<OnDiskIndexIteratorCreator> CreateOnDiskIndexIteratorCreator() = 0;
+    // also called concurrently by term merge workers, each with its own pool and writer resource
     virtual PostingMerger*
-    CreatePostingMerger(const std::vector<std::shared_ptr<indexlibv2::framework::SegmentMeta>>& targetSegments);
+    CreatePostingMerger(PostingWriterResource* postingWriterResource,
+                        const std::vector<std::shared_ptr<indexlibv2::framework::SegmentMeta>>& targetSegments);
     virtual PostingMerger*
-    CreateBitmapPostingMerger(const std::vector<std::shared_ptr<indexlibv2::framework::SegmentMeta>>& targetSegments);
+    CreateBitmapPostingMerger(autil::mem_pool::Pool* byteSlicePool,
+                              const std::vector<std::shared_ptr<indexlibv2::framework::SegmentMeta>>& targetSegments);
     virtual void PrepareIndexOutputSegmentResource(
         const std::vector<SourceSegment>& srcSegments,
         const std::vector<std::shared_ptr<indexlibv2::framework::SegmentMeta>>& targetSegments);
@@ -120,6 +128,20 @@ private:
     Status MergeTerm(DictKeyInfo key, const SegmentTermInfos& segTermInfos, SegmentTermInfo::TermIndexMode mode,
                      const std::shared_ptr<indexlibv2::index::DocMapper>& docMapper,
                      const std::vector<std::shared_ptr<indexlibv2::framework::SegmentMeta>>& targetSegments);
+    bool NeedMergeTerm(DictKeyInfo key, SegmentTermInfo::TermIndexMode mode) const;
+
+    // term range parallel merge, each worker walks the whole term stream with its own iterators and merges every
+    // threadCount-th range into an in memory fragment, fragments are stitched into output files in term order
+    struct TermMergeWorker;
+    Status ParallelMergeTerms(const SegmentMergeInfos& segMergeInfos,
+                              const std::shared_ptr<indexlibv2::index::DocMapper>& docMapper);
+    Status MergeTermRange(TermMergeWorker* worker, size_t skipRangeCount,
+                          const std::shared_ptr<indexlibv2::index::DocMapper>& docMapper,
+                          const std::vector<std::shared_ptr<indexlibv2::framework::SegmentMeta>>& targetSegments);
+    static size_t SkipTermRange(SegmentTermInfoQueue* termInfoQueue);
+    static bool IsTermRangeEnd(size_t termCount, int64_t rangeTermFreq);
+    static int64_t GetTermFreq(const SegmentTermInfos& segTermInfos);
+    void ReportTermMergeThroughput(const std::vector<std::unique_ptr<TermMergeWorker>>& workers) const;
 
     std::shared_ptr<PostingMerger>
     MergeTermPosting(const SegmentTermInfos& segTermInfos, SegmentTermInfo::TermIndexMode mode,
@@ -154,6 +176,8 @@ private:
     indexlibv2::index::PatchInfos _patchInfos;
 
     bool _isOptimizeMerge = false;
+    uint32_t _termMergeThreadCount = 1;
+    std::shared_ptr<util::MetricProvider> _metricProvider;
 
     std::map<std::string, std::any> _params;
     std::map<std::string, std::shared_ptr<BucketMap>> _bucketMaps;
@@ -0,0 +1,164 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "indexlib/index/inverted_index/TermRangeMergeFragment.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "indexlib/file_system/file/InterimFileWriter.h"
+#include "indexlib/index/inverted_index/format/ShortListOptimizeUtil.h"
+#include "indexlib/index/inverted_index/format/dictionary/DictionaryWriter.h"
+
+namespace indexlib::index {
+namespace {
+
+// records dictionary items in merge order, they are re-added to the real dictionary writer when stitching
+class FragmentDictionaryWriter : public DictionaryWriter
+{
+public:
+    void Open(const std::shared_ptr<file_system::Directory>& directory, const std::string& fileName) override {}
+    void Open(const std::shared_ptr<file_system::Directory>& directory, const std::string& fileName,
+              size_t itemCount) override
+    {
+    }
+    void AddItem(index::DictKeyInfo key, dictvalue_t value) override
+    {
+        _items.emplace_back(key, value);
+        ++_itemCount;
+    }
+    void Close() override {}
+
+    const std::vector<std::pair<index::DictKeyInfo, dictvalue_t>>& GetItems() const { return _items; }
+    void Clear()
+    {
+        _items.clear();
+        _itemCount = 0;
+    }
+
+private:
+    std::vector<std::pair<index::DictKeyInfo, dictvalue_t>> _items;
+};
+
+constexpr uint64_t FRAGMENT_POSTING_INIT_LENGTH = 64 * 1024;
+
+} // namespace
+
+AUTIL_LOG_SETUP(indexlib.index, TermRangeMergeFragment);
+
+TermRangeMergeFragment::TermRangeMergeFragment(size_t targetSegmentCount, bool needCreateBitmapIndex)
+    : _needCreateBitmapIndex(needCreateBitmapIndex)
+{
+    for (size_t i = 0; i < targetSegmentCount; ++i) {
+        auto resource = std::make_shared<IndexOutputSegmentResource>();
+        resource->Init(CreateIndexDataWriter(), needCreateBitmapIndex ? CreateIndexDataWriter() : nullptr);
+        _indexOutputSegmentResources.push_back(resource);
+    }
+}
+
+TermRangeMergeFragment::~TermRangeMergeFragment() {}
+
+std::shared_ptr<IndexDataWriter> TermRangeMergeFragment::CreateIndexDataWriter()
+{
+    auto writer = std::make_shared<IndexDataWriter>();
+    writer->dictWriter = std::make_shared<FragmentDictionaryWriter>();
+    auto postingWriter = std::make_shared<file_system::InterimFileWriter>();
+    postingWriter->Init(FRAGMENT_POSTING_INIT_LENGTH);
+    writer->postingWriter = postingWriter;
+    return writer;
+}
+
+void TermRangeMergeFragment::Reset()
+{
+    for (auto& resource : _indexOutputSegmentResources) {
+        for (auto mode : {SegmentTermInfo::TM_NORMAL, SegmentTermInfo::TM_BITMAP}) {
+            auto& writer = resource->GetIndexDataWriter(mode);
+            if (writer) {
+                static_cast<FragmentDictionaryWriter*>(writer->dictWriter.get())->Clear();
+                // start from the size used by the previous range instead of growing again
+                static_cast<file_system::InterimFileWriter*>(writer->postingWriter.get())
+                    ->Init(std::max(FRAGMENT_POSTING_INIT_LENGTH, (uint64_t)writer->postingWriter->GetLength()));
+            }
+        }
+    }
+}
+
+size_t TermRangeMergeFragment::GetPostingLength() const
+{
+    size_t length = 0;
+    for (const auto& resource : _indexOutputSegmentResources) {
+        for (auto mode : {SegmentTermInfo::TM_NORMAL, SegmentTermInfo::TM_BITMAP}) {
+            const auto& writer = resource->GetIndexDataWriter(mode);
+            if (writer) {
+                length += writer->postingWriter->GetLength();
+            }
+        }
+    }
+    return length;
+}
+
+dictvalue_t TermRangeMergeFragment::ShiftDictValue(dictvalue_t dictValue, SegmentTermInfo::TermIndexMode mode,
+                                                   int64_t baseOffset)
+{
+    if (mode == SegmentTermInfo::TM_BITMAP) {
+        // bitmap dictionary stores plain posting offsets
+        return dictValue + baseOffset;
+    }
+    int64_t offset = 0;
+    if (!ShortListOptimizeUtil::GetOffset(dictValue, offset)) {
+        // posting inlined in dictionary value
+        return dictValue;
+    }
+    return ShortListOptimizeUtil::CreateDictValue(ShortListOptimizeUtil::GetCompressMode(dictValue),
+                                                  offset + baseOffset);
+}
+
+void TermRangeMergeFragment::StitchIndexDataWriter(const std::shared_ptr<IndexDataWriter>& fragmentWriter,
+                                                   const std::shared_ptr<IndexDataWriter>& outputWriter,
+                                                   SegmentTermInfo::TermIndexMode mode)
+{
+    auto fragmentDictWriter = static_cast<FragmentDictionaryWriter*>(fragmentWriter->dictWriter.get());
+    if (fragmentDictWriter->GetItems().empty()) {
+        return;
+    }
+    assert(outputWriter && outputWriter->IsValid());
+    int64_t baseOffset = outputWriter->postingWriter->GetLogicLength();
+    auto fragmentPostingWriter = static_cast<file_system::InterimFileWriter*>(fragmentWriter->postingWriter.get());
+    size_t length = fragmentPostingWriter->GetLength();
+    if (length > 0) {
+        outputWriter->postingWriter->Write(fragmentPostingWriter->GetBaseAddress(), length).GetOrThrow();
+    }
+    for (const auto& [key, value] : fragmentDictWriter->GetItems()) {
+        outputWriter->dictWriter->AddItem(key, ShiftDictValue(value, mode, baseOffset));
+    }
+}
+
+void TermRangeMergeFragment::StitchTo(
+    const std::vector<std::shared_ptr<IndexOutputSegmentResource>>& indexOutputSegmentResources) const
+{
+    assert(indexOutputSegmentResources.size() == _indexOutputSegmentResources.size());
+    for (size_t i = 0; i < _indexOutputSegmentResources.size(); ++i) {
+        StitchIndexDataWriter(_indexOutputSegmentResources[i]->GetIndexDataWriter(SegmentTermInfo::TM_NORMAL),
+                              indexOutputSegmentResources[i]->GetIndexDataWriter(SegmentTermInfo::TM_NORMAL),
+                              SegmentTermInfo::TM_NORMAL);
+        if (_needCreateBitmapIndex) {
+            StitchIndexDataWriter(_indexOutputSegmentResources[i]->GetIndexDataWriter(SegmentTermInfo::TM_BITMAP),
+                                  indexOutputSegmentResources[i]->GetIndexDataWriter(SegmentTermInfo::TM_BITMAP),
+                                  SegmentTermInfo::TM_BITMAP);
+        }
+    }
+}
+
+} // namespace indexlib::index
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "autil/Log.h"
+#include "indexlib/index/inverted_index/IndexOutputSegmentResource.h"
+
+namespace indexlib::index {
+
+// Postings and dictionary items of one contiguous range of terms, merged by a worker thread into memory and
+// later appended to the output segments in term order. Posting data is copied as is, only the offsets kept in
+// dictionary values are shifted by the length of the output posting file at stitch time.
+class TermRangeMergeFragment
+{
+public:
+    TermRangeMergeFragment(size_t targetSegmentCount, bool needCreateBitmapIndex);
+    ~TermRangeMergeFragment();
+
+public:
+    const std::vector<std::shared_ptr<IndexOutputSegmentResource>>& GetIndexOutputSegmentResources() const
+    {
+        return _indexOutputSegmentResources;
+    }
+    void StitchTo(const std::vector<std::shared_ptr<IndexOutputSegmentResource>>& indexOutputSegmentResources) const;
+    size_t GetPostingLength() const;
+    void Reset();
+
+public:
+    static dictvalue_t ShiftDictValue(dictvalue_t dictValue, SegmentTermInfo::TermIndexMode mode, int64_t baseOffset);
+
+private:
+    static std::shared_ptr<IndexDataWriter> CreateIndexDataWriter();
+    static void StitchIndexDataWriter(const std::shared_ptr<IndexDataWriter>& fragmentWriter,
+                                      const std::shared_ptr<IndexDataWriter>& outputWriter,
+                                      SegmentTermInfo::TermIndexMode mode);
+
+private:
+    std::vector<std::shared_ptr<IndexOutputSegmentResource>> _indexOutputSegmentResources;
+    bool _needCreateBitmapIndex;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+} // namespace indexlib::index
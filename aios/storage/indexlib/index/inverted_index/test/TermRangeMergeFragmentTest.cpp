@@ -0,0 +1,56 @@
+#include "indexlib/index/inverted_index/TermRangeMergeFragment.h"
+
+#include "indexlib/index/inverted_index/format/ShortListOptimizeUtil.h"
+#include "unittest/unittest.h"
+
+namespace indexlib::index {
+
+class TermRangeMergeFragmentTest : public TESTBASE
+{
+public:
+    TermRangeMergeFragmentTest() = default;
+    ~TermRangeMergeFragmentTest() = default;
+
+    void setUp() override {}
+    void tearDown() override {}
+};
+
+TEST_F(TermRangeMergeFragmentTest, testShiftDictValue)
+{
+    dictvalue_t dictValue = ShortListOptimizeUtil::CreateDictValue(/*compressMode*/ 5, /*offset*/ 100);
+    dictvalue_t shifted = TermRangeMergeFragment::ShiftDictValue(dictValue, SegmentTermInfo::TM_NORMAL, 50);
+    ASSERT_EQ(ShortListOptimizeUtil::CreateDictValue(5, 150), shifted);
+    ASSERT_EQ(5, ShortListOptimizeUtil::GetCompressMode(shifted));
+
+    dictvalue_t inlineValue = ShortListOptimizeUtil::CreateDictInlineValue(7, /*isDocList*/ true, /*dfFirst*/ true);
+    ASSERT_EQ(inlineValue, TermRangeMergeFragment::ShiftDictValue(inlineValue, SegmentTermInfo::TM_NORMAL, 50));
+
+    ASSERT_EQ(150, TermRangeMergeFragment::ShiftDictValue(100, SegmentTermInfo::TM_BITMAP, 50));
+}
+
+TEST_F(TermRangeMergeFragmentTest, testStitch)
+{
+    TermRangeMergeFragment output(/*targetSegmentCount*/ 2, /*needCreateBitmapIndex*/ true);
+    auto& outputWriter = output.GetIndexOutputSegmentResources()[1]->GetIndexDataWriter(SegmentTermInfo::TM_NORMAL);
+    outputWriter->postingWriter->Write("xyz", 3).GetOrThrow();
+
+    TermRangeMergeFragment fragment(/*targetSegmentCount*/ 2, /*needCreateBitmapIndex*/ true);
+    auto& normalWriter = fragment.GetIndexOutputSegmentResources()[1]->GetIndexDataWriter(SegmentTermInfo::TM_NORMAL);
+    normalWriter->dictWriter->AddItem(index::DictKeyInfo(1), ShortListOptimizeUtil::CreateDictValue(0, 0));
+    normalWriter->postingWriter->Write("abcd", 4).GetOrThrow();
+    auto& bitmapWriter = fragment.GetIndexOutputSegmentResources()[0]->GetIndexDataWriter(SegmentTermInfo::TM_BITMAP);
+    bitmapWriter->dictWriter->AddItem(index::DictKeyInfo(2), 0);
+    bitmapWriter->postingWriter->Write("ef", 2).GetOrThrow();
+    ASSERT_EQ(6, fragment.GetPostingLength());
+
+    fragment.StitchTo(output.GetIndexOutputSegmentResources());
+    ASSERT_EQ(9, output.GetPostingLength());
+    ASSERT_EQ(7, outputWriter->postingWriter->GetLength());
+    ASSERT_EQ(0, memcmp("xyzabcd", outputWriter->postingWriter->GetBaseAddress(), 7));
+    ASSERT_EQ(1, outputWriter->dictWriter->GetItemCount());
+
+    fragment.Reset();
+    ASSERT_EQ(0, fragment.GetPostingLength());
+}
+
+} // namespace indexlib::index
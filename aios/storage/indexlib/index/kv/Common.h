@@ -23,12 +23,15 @@ inline const std::string DROP_DELETE_KEY = "drop_delete_key";
 inline const std::string KV_RAW_KEY_INDEX_NAME = "raw_key";
 inline const std::string CURRENT_TIME_IN_SECOND = "current_time_in_sec";
 inline const std::string NEED_STORE_PK_VALUE = "need_store_pk_value";
+// memory quota of external sort merge, 0 means merge by inserting records into hash table directly
+inline const std::string KV_EXTERNAL_SORT_MERGE_MEMORY_QUOTA_MB = "kv_external_sort_merge_memory_quota_mb";
 } // namespace indexlib::index
 
 //////////////////////////////////////////////////////////////////////
 namespace indexlibv2::index {
 using indexlib::index::CURRENT_TIME_IN_SECOND;
 using indexlib::index::DROP_DELETE_KEY;
+using indexlib::index::KV_EXTERNAL_SORT_MERGE_MEMORY_QUOTA_MB;
 using indexlib::index::KV_INDEX_PATH;
 using indexlib::index::KV_INDEX_TYPE_STR;
 using indexlib::index::KV_RAW_KEY_INDEX_NAME;
@@ -16,11 +16,13 @@
 #include "indexlib/index/kv/KVIndexFactory.h"
 
 #include "autil/Log.h"
+#include "indexlib/config/MergeConfig.h"
 #include "indexlib/framework/SegmentInfo.h"
 #include "indexlib/framework/SegmentMetrics.h"
 #include "indexlib/index/IndexerParameter.h"
 #include "indexlib/index/kv/FixedLenKVMemIndexer.h"
 #include "indexlib/index/kv/FixedLenKVMerger.h"
+#include "indexlib/index/kv/Common.h"
 #include "indexlib/index/kv/KVCommonDefine.h"
 #include "indexlib/index/kv/KVDiskIndexer.h"
 #include "indexlib/index/kv/KVIndexFieldsParser.h"
@@ -141,4 +143,18 @@ int64_t KVIndexFactory::GetMaxBuildMemoryUse(const IndexerParameter& indexerPara
 }
 
 REGISTER_INDEX_FACTORY(kv, KVIndexFactory);
+
+__attribute__((constructor)) static void RegisterHooks()
+{
+    config::MergeConfig::RegisterOptionHook(
+        KV_EXTERNAL_SORT_MERGE_MEMORY_QUOTA_MB,
+        [](std::map<std::string, std::any>& hookOptions) {
+            hookOptions.emplace(KV_EXTERNAL_SORT_MERGE_MEMORY_QUOTA_MB, (int64_t)0);
+        },
+        [](autil::legacy::Jsonizable::JsonWrapper& json, std::map<std::string, std::any>& hookOptions) {
+            assert(hookOptions.count(KV_EXTERNAL_SORT_MERGE_MEMORY_QUOTA_MB) > 0);
+            auto& memoryQuota = std::any_cast<int64_t&>(hookOptions[KV_EXTERNAL_SORT_MERGE_MEMORY_QUOTA_MB]);
+            json.Jsonize(KV_EXTERNAL_SORT_MERGE_MEMORY_QUOTA_MB, memoryQuota, memoryQuota);
+        });
+}
 } // namespace indexlibv2::index
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "indexlib/index/kv/KVLookupCoalescer.h"
+
+#include <cassert>
+
+namespace indexlibv2::index {
+AUTIL_LOG_SETUP(indexlib.index, KVLookupCoalescer);
+
+KVLookupCoalescer::Ticket::Ticket(KVLookupCoalescer* coalescer, keytype_t key, std::shared_ptr<Flight> flight,
+                                  bool leader)
+    : _coalescer(coalescer)
+    , _key(key)
+    , _flight(std::move(flight))
+    , _leader(leader)
+{
+}
+
+KVLookupCoalescer::Ticket::Ticket(Ticket&& other)
+    : _coalescer(other._coalescer)
+    , _key(other._key)
+    , _flight(std::move(other._flight))
+    , _future(std::move(other._future))
+    , _leader(other._leader)
+    , _completed(other._completed)
+{
+    other._coalescer = nullptr;
+    other._leader = false;
+}
+
+KVLookupCoalescer::Ticket::~Ticket()
+{
+    if (_leader && !_completed && _coalescer) {
+        // leader abandoned (e.g. coroutine destroyed), never leave waiters hanging
+        _coalescer->Finish(_key, _flight, KVResultStatus::FAIL, autil::StringView(), 0);
+    }
+}
+
+future_lite::Future<future_lite::Unit> KVLookupCoalescer::Ticket::GetFuture()
+{
+    assert(!_leader && _future);
+    auto future = std::move(*_future);
+    _future.reset();
+    return future;
+}
+
+void KVLookupCoalescer::Ticket::Complete(KVResultStatus status, const autil::StringView& value, uint64_t valueTs)
+{
+    assert(_leader && !_completed);
+    _completed = true;
+    _coalescer->Finish(_key, _flight, status, value, valueTs);
+}
+
+KVLookupCoalescer::KVLookupCoalescer() : _lookupCount(0), _coalescedCount(0) {}
+
+KVLookupCoalescer::Ticket KVLookupCoalescer::Join(keytype_t key)
+{
+    _lookupCount.fetch_add(1, std::memory_order_relaxed);
+    auto& shard = GetShard(key);
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    auto iter = shard.flights.find(key);
+    if (iter == shard.flights.end()) {
+        auto flight = std::make_shared<Flight>();
+        shard.flights.emplace(key, flight);
+        return Ticket(this, key, std::move(flight), true);
+    }
+    auto flight = iter->second;
+    flight->waiters.emplace_back();
+    auto future = std::make_unique<future_lite::Future<future_lite::Unit>>(flight->waiters.back().getFuture());
+    lock.unlock();
+    _coalescedCount.fetch_add(1, std::memory_order_relaxed);
+    Ticket ticket(this, key, std::move(flight), false);
+    ticket._future = std::move(future);
+    return ticket;
+}
+
+void KVLookupCoalescer::Finish(keytype_t key, const std::shared_ptr<Flight>& flight, KVResultStatus status,
+                               const autil::StringView& value, uint64_t valueTs)
+{
+    std::vector<future_lite::Promise<future_lite::Unit>> waiters;
+    {
+        auto& shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto iter = shard.flights.find(key);
+        if (iter != shard.flights.end() && iter->second == flight) {
+            shard.flights.erase(iter);
+        }
+        waiters.swap(flight->waiters);
+    }
+    if (waiters.empty()) {
+        return;
+    }
+    // no waiter can join after erase, flight is read-only from now on
+    flight->status = status;
+    flight->valueTs = valueTs;
+    flight->value.assign(value.data(), value.size());
+    for (auto& waiter : waiters) {
+        waiter.setValue(future_lite::Unit());
+    }
+}
+
+} // namespace indexlibv2::index
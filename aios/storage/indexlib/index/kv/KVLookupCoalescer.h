@@ -0,0 +1,107 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "autil/ConstString.h"
+#include "autil/Log.h"
+#include "future_lite/Future.h"
+#include "future_lite/Promise.h"
+#include "future_lite/Unit.h"
+#include "indexlib/index/kv/KVIndexReader.h"
+
+namespace indexlibv2::index {
+
+// Coalesces identical in-flight lookups (same hashed key) of one reader: the first caller (leader) performs the
+// real lookup, concurrent callers (waiters) park on a future and copy the leader's result into their own pool.
+class KVLookupCoalescer
+{
+public:
+    struct Flight {
+        KVResultStatus status = KVResultStatus::FAIL;
+        uint64_t valueTs = 0;
+        std::string value;
+        std::vector<future_lite::Promise<future_lite::Unit>> waiters;
+    };
+
+    class Ticket
+    {
+    public:
+        Ticket() = default;
+        Ticket(KVLookupCoalescer* coalescer, keytype_t key, std::shared_ptr<Flight> flight, bool leader);
+        ~Ticket();
+
+        Ticket(const Ticket&) = delete;
+        Ticket& operator=(const Ticket&) = delete;
+        Ticket(Ticket&& other);
+        Ticket& operator=(Ticket&& other) = delete;
+
+    public:
+        bool IsLeader() const { return _leader; }
+        const std::shared_ptr<Flight>& GetFlight() const { return _flight; }
+        // waiter only, must be called once
+        future_lite::Future<future_lite::Unit> GetFuture();
+        // leader only, publish result to all waiters
+        void Complete(KVResultStatus status, const autil::StringView& value, uint64_t valueTs);
+
+    private:
+        KVLookupCoalescer* _coalescer = nullptr;
+        keytype_t _key = 0;
+        std::shared_ptr<Flight> _flight;
+        std::unique_ptr<future_lite::Future<future_lite::Unit>> _future;
+        bool _leader = false;
+        bool _completed = false;
+
+        friend class KVLookupCoalescer;
+    };
+
+public:
+    KVLookupCoalescer();
+    ~KVLookupCoalescer() = default;
+
+public:
+    Ticket Join(keytype_t key);
+
+    int64_t GetLookupCount() const { return _lookupCount.load(std::memory_order_relaxed); }
+    int64_t GetCoalescedCount() const { return _coalescedCount.load(std::memory_order_relaxed); }
+
+private:
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<keytype_t, std::shared_ptr<Flight>> flights;
+    };
+    static constexpr size_t SHARD_COUNT = 64;
+
+    Shard& GetShard(keytype_t key) { return _shards[key % SHARD_COUNT]; }
+    void Finish(keytype_t key, const std::shared_ptr<Flight>& flight, KVResultStatus status,
+                const autil::StringView& value, uint64_t valueTs);
+
+private:
+    Shard _shards[SHARD_COUNT];
+    std::atomic<int64_t> _lookupCount;
+    std::atomic<int64_t> _coalescedCount;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+} // namespace indexlibv2::index
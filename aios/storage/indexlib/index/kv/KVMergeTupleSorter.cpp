@@ -0,0 +1,200 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "indexlib/index/kv/KVMergeTupleSorter.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "autil/StringUtil.h"
+#include "indexlib/file_system/IDirectory.h"
+#include "indexlib/file_system/RemoveOption.h"
+#include "indexlib/file_system/WriterOption.h"
+#include "indexlib/file_system/file/FileReader.h"
+#include "indexlib/file_system/file/FileWriter.h"
+
+namespace indexlibv2::index {
+AUTIL_LOG_SETUP(indexlib.index, KVMergeTupleSorter);
+
+KVMergeTupleSorter::KVMergeTupleSorter(const std::shared_ptr<indexlib::file_system::IDirectory>& tempDir,
+                                       const std::string& runFilePrefix, size_t memoryQuota, Comparator comparator)
+    : _tempDir(tempDir)
+    , _runFilePrefix(runFilePrefix)
+    , _bufferCapacity(std::max(memoryQuota / sizeof(KVMergeTuple), MIN_BUFFER_TUPLE_COUNT))
+    , _comparator(comparator)
+{
+    assert(_comparator);
+}
+
+KVMergeTupleSorter::~KVMergeTupleSorter() {}
+
+bool KVMergeTupleSorter::KeyOrder(const KVMergeTuple& lhs, const KVMergeTuple& rhs)
+{
+    if (lhs.key != rhs.key) {
+        return lhs.key < rhs.key;
+    }
+    return lhs.segmentIdx < rhs.segmentIdx;
+}
+
+bool KVMergeTupleSorter::SegmentOrder(const KVMergeTuple& lhs, const KVMergeTuple& rhs)
+{
+    if (lhs.segmentIdx != rhs.segmentIdx) {
+        return lhs.segmentIdx < rhs.segmentIdx;
+    }
+    return lhs.ordinal < rhs.ordinal;
+}
+
+Status KVMergeTupleSorter::Add(const KVMergeTuple& tuple)
+{
+    assert(!_finished);
+    if (_buffer.size() >= _bufferCapacity) {
+        RETURN_STATUS_DIRECTLY_IF_ERROR(SpillRun());
+    }
+    if (_buffer.capacity() == 0) {
+        _buffer.reserve(_bufferCapacity);
+    }
+    _buffer.push_back(tuple);
+    ++_tupleCount;
+    return Status::OK();
+}
+
+Status KVMergeTupleSorter::SpillRun()
+{
+    std::sort(_buffer.begin(), _buffer.end(), _comparator);
+    Run run;
+    run.fileName = _runFilePrefix + "_" + autil::StringUtil::toString(_runs.size());
+    auto [status, writer] =
+        _tempDir->CreateFileWriter(run.fileName, indexlib::file_system::WriterOption::Buffer()).StatusWith();
+    RETURN_IF_STATUS_ERROR(status, "create run file [%s] failed", run.fileName.c_str());
+    status = writer->Write(_buffer.data(), _buffer.size() * sizeof(KVMergeTuple)).Status();
+    RETURN_IF_STATUS_ERROR(status, "write run file [%s] failed", run.fileName.c_str());
+    status = writer->Close().Status();
+    RETURN_IF_STATUS_ERROR(status, "close run file [%s] failed", run.fileName.c_str());
+    AUTIL_LOG(INFO, "spill [%lu] tuples to run file [%s]", _buffer.size(), run.fileName.c_str());
+    _runs.push_back(std::move(run));
+    _buffer.clear();
+    return Status::OK();
+}
+
+Status KVMergeTupleSorter::Finish()
+{
+    assert(!_finished);
+    _finished = true;
+    if (_runs.empty()) {
+        std::sort(_buffer.begin(), _buffer.end(), _comparator);
+        _cursor = 0;
+        return Status::OK();
+    }
+    if (!_buffer.empty()) {
+        RETURN_STATUS_DIRECTLY_IF_ERROR(SpillRun());
+    }
+    // hand the sort buffer over to the run read buffers
+    std::vector<KVMergeTuple>().swap(_buffer);
+    size_t runBufferCapacity = std::max(_bufferCapacity / _runs.size(), MIN_BUFFER_TUPLE_COUNT);
+    for (size_t i = 0; i < _runs.size(); ++i) {
+        auto& run = _runs[i];
+        auto [status, reader] =
+            _tempDir->CreateFileReader(run.fileName, indexlib::file_system::FSOT_BUFFERED).StatusWith();
+        RETURN_IF_STATUS_ERROR(status, "open run file [%s] failed", run.fileName.c_str());
+        run.reader = reader;
+        run.buffer.reserve(runBufferCapacity);
+        RETURN_STATUS_DIRECTLY_IF_ERROR(FillRun(run));
+        if (run.cursor < run.buffer.size()) {
+            _heap.push_back(i);
+        }
+    }
+    auto greater = [this](size_t lhs, size_t rhs) { return RunGreater(lhs, rhs); };
+    std::make_heap(_heap.begin(), _heap.end(), greater);
+    AUTIL_LOG(INFO, "merge [%lu] tuples from [%lu] runs", _tupleCount, _runs.size());
+    return Status::OK();
+}
+
+Status KVMergeTupleSorter::FillRun(Run& run)
+{
+    size_t fileLength = run.reader->GetLength();
+    size_t tupleCount = std::min(run.buffer.capacity(), (fileLength - run.readOffset) / sizeof(KVMergeTuple));
+    run.buffer.resize(tupleCount);
+    run.cursor = 0;
+    if (tupleCount == 0) {
+        return Status::OK();
+    }
+    size_t length = tupleCount * sizeof(KVMergeTuple);
+    auto [status, readSize] = run.reader->Read(run.buffer.data(), length, run.readOffset).StatusWith();
+    RETURN_IF_STATUS_ERROR(status, "read run file [%s] failed", run.fileName.c_str());
+    if (readSize != length) {
+        return Status::IOError("read run file [%s] failed, expect [%lu] bytes, actual [%lu] bytes",
+                               run.fileName.c_str(), length, readSize);
+    }
+    run.readOffset += length;
+    return Status::OK();
+}
+
+bool KVMergeTupleSorter::RunGreater(size_t lhs, size_t rhs) const
+{
+    const auto& left = _runs[lhs].buffer[_runs[lhs].cursor];
+    const auto& right = _runs[rhs].buffer[_runs[rhs].cursor];
+    return _comparator(right, left);
+}
+
+bool KVMergeTupleSorter::HasNext() const
+{
+    assert(_finished);
+    if (_runs.empty()) {
+        return _cursor < _buffer.size();
+    }
+    return !_heap.empty();
+}
+
+Status KVMergeTupleSorter::Next(KVMergeTuple& tuple)
+{
+    assert(HasNext());
+    if (_runs.empty()) {
+        tuple = _buffer[_cursor++];
+        return Status::OK();
+    }
+    auto greater = [this](size_t lhs, size_t rhs) { return RunGreater(lhs, rhs); };
+    std::pop_heap(_heap.begin(), _heap.end(), greater);
+    size_t runIdx = _heap.back();
+    auto& run = _runs[runIdx];
+    tuple = run.buffer[run.cursor++];
+    if (run.cursor == run.buffer.size()) {
+        RETURN_STATUS_DIRECTLY_IF_ERROR(FillRun(run));
+    }
+    if (run.cursor < run.buffer.size()) {
+        std::push_heap(_heap.begin(), _heap.end(), greater);
+    } else {
+        _heap.pop_back();
+    }
+    return Status::OK();
+}
+
+Status KVMergeTupleSorter::Close()
+{
+    std::vector<KVMergeTuple>().swap(_buffer);
+    _heap.clear();
+    for (auto& run : _runs) {
+        if (run.reader) {
+            auto status = run.reader->Close().Status();
+            RETURN_IF_STATUS_ERROR(status, "close run file [%s] failed", run.fileName.c_str());
+            run.reader.reset();
+        }
+        auto status = _tempDir->RemoveFile(run.fileName, indexlib::file_system::RemoveOption::MayNonExist()).Status();
+        RETURN_IF_STATUS_ERROR(status, "remove run file [%s] failed", run.fileName.c_str());
+    }
+    _runs.clear();
+    return Status::OK();
+}
+
+} // namespace indexlibv2::index
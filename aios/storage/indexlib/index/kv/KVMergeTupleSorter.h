@@ -0,0 +1,104 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "autil/Log.h"
+#include "indexlib/base/Status.h"
+#include "indexlib/index/kv/Types.h"
+
+namespace indexlib::file_system {
+class IDirectory;
+class FileReader;
+} // namespace indexlib::file_system
+
+namespace indexlibv2::index {
+
+// Locates one record of a merge source segment: segmentIdx follows MultiSegmentKVIterator order (smaller is
+// newer), ordinal is the position of the record in the iteration order of its segment.
+struct KVMergeTuple {
+    keytype_t key = 0;
+    uint64_t ordinal = 0;
+    uint32_t timestamp = 0;
+    uint16_t segmentIdx = 0;
+    bool deleted = false;
+};
+
+// Sorts merge tuples within a fixed memory quota: a full buffer is sorted and spilled as a run file into the
+// temp directory, runs are k-way merged when tuples are read back. Nothing is spilled if all tuples fit.
+class KVMergeTupleSorter
+{
+public:
+    typedef bool (*Comparator)(const KVMergeTuple& lhs, const KVMergeTuple& rhs);
+
+public:
+    KVMergeTupleSorter(const std::shared_ptr<indexlib::file_system::IDirectory>& tempDir,
+                       const std::string& runFilePrefix, size_t memoryQuota, Comparator comparator);
+    ~KVMergeTupleSorter();
+
+public:
+    Status Add(const KVMergeTuple& tuple);
+    // no Add after Finish
+    Status Finish();
+    bool HasNext() const;
+    Status Next(KVMergeTuple& tuple);
+    // remove spilled run files
+    Status Close();
+
+    size_t GetTupleCount() const { return _tupleCount; }
+    size_t GetRunCount() const { return _runs.size(); }
+
+public:
+    // by key, newest segment first
+    static bool KeyOrder(const KVMergeTuple& lhs, const KVMergeTuple& rhs);
+    // by segment, then iteration order inside segment
+    static bool SegmentOrder(const KVMergeTuple& lhs, const KVMergeTuple& rhs);
+
+private:
+    struct Run {
+        std::string fileName;
+        std::shared_ptr<indexlib::file_system::FileReader> reader;
+        size_t readOffset = 0;
+        std::vector<KVMergeTuple> buffer;
+        size_t cursor = 0;
+    };
+
+    Status SpillRun();
+    Status FillRun(Run& run);
+    bool RunGreater(size_t lhs, size_t rhs) const;
+
+private:
+    static constexpr size_t MIN_BUFFER_TUPLE_COUNT = 1024;
+
+    std::shared_ptr<indexlib::file_system::IDirectory> _tempDir;
+    std::string _runFilePrefix;
+    size_t _bufferCapacity = 0;
+    Comparator _comparator = nullptr;
+    std::vector<KVMergeTuple> _buffer;
+    size_t _cursor = 0;
+    std::vector<Run> _runs;
+    std::vector<size_t> _heap;
+    size_t _tupleCount = 0;
+    bool _finished = false;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+} // namespace indexlibv2::index
@@ -16,6 +16,7 @@
 #include "indexlib/index/kv/KVMerger.h"
 
 #include <algorithm>
+#include <limits>
 
 #include "autil/Log.h"
 #include "autil/StringUtil.h"
@@ -35,6 +36,7 @@
 #include "indexlib/index/kv/KVCommonDefine.h"
 #include "indexlib/index/kv/KVDiskIndexer.h"
 #include "indexlib/index/kv/KVFormatOptions.h"
+#include "indexlib/index/kv/KVMergeTupleSorter.h"
 #include "indexlib/index/kv/KVSegmentReaderCreator.h"
 #include "indexlib/index/kv/KVTypeId.h"
 #include "indexlib/index/kv/KeyMergeWriter.h"
@@ -74,6 +76,17 @@ Status KVMerger::Init(const std::shared_ptr<config::IIndexConfig>& indexConfig,
         return Status::InvalidArgs("drop_delete_key in params not bool");
     }
 
+    it = params.find(KV_EXTERNAL_SORT_MERGE_MEMORY_QUOTA_MB);
+    if (it != params.end()) {
+        int64_t memoryQuotaInMB = 0;
+        std::string memoryQuotaStr = std::any_cast<std::string>(it->second);
+        if (!autil::StringUtil::fromString(memoryQuotaStr, memoryQuotaInMB) || memoryQuotaInMB < 0) {
+            return Status::InvalidArgs("invalid %s: %s", KV_EXTERNAL_SORT_MERGE_MEMORY_QUOTA_MB.c_str(),
+                                       memoryQuotaStr.c_str());
+        }
+        _externalSortMemoryQuota = memoryQuotaInMB * 1024 * 1024;
+    }
+
     std::string currentTimeStr;
     it = params.find(CURRENT_TIME_IN_SECOND);
     if (it != params.end()) {
@@ -140,7 +153,11 @@ Status KVMerger::PrepareMerge(const SegmentMergeInfos& segMergeInfos)
 
 Status KVMerger::DoMerge(const SegmentMergeInfos& segMergeInfos)
 {
-    RETURN_STATUS_DIRECTLY_IF_ERROR(MergeMultiSegments(segMergeInfos));
+    if (UseExternalSortMerge()) {
+        RETURN_STATUS_DIRECTLY_IF_ERROR(MergeMultiSegmentsByExternalSort(segMergeInfos));
+    } else {
+        RETURN_STATUS_DIRECTLY_IF_ERROR(MergeMultiSegments(segMergeInfos));
+    }
 
     RETURN_STATUS_DIRECTLY_IF_ERROR(Dump());
 
@@ -255,6 +272,163 @@ Status KVMerger::MergeMultiSegments(const SegmentMergeInfos& segMergeInfos)
     return Status::OK();
 }
 
+bool KVMerger::UseExternalSortMerge() const
+{
+    // sort merge writes var len values in sort field order, which external sort merge does not keep
+    return _externalSortMemoryQuota > 0 && !(_sortDescriptions && _typeId.isVarLen);
+}
+
+Status KVMerger::CreateSegmentIterator(const std::shared_ptr<framework::Segment>& segment,
+                                       std::unique_ptr<IKVIterator>& iterator, IKVIterator*& keyIterator) const
+{
+    auto [s, iter] =
+        KVSegmentReaderCreator::CreateIterator(segment, _indexConfig, _schemaId, _ignoreFieldCalculator, false);
+    if (!s.IsOK()) {
+        return s;
+    }
+    if (!iter) {
+        return Status::InternalError("create iterator for segment %d failed", segment->GetSegmentId());
+    }
+    // key iterator shares position with its owner, advancing it skips the record without reading value
+    keyIterator = const_cast<IKVIterator*>(iter->GetKeyIterator());
+    if (!keyIterator) {
+        keyIterator = iter.get();
+    }
+    iterator = std::move(iter);
+    return Status::OK();
+}
+
+Status KVMerger::MergeMultiSegmentsByExternalSort(const SegmentMergeInfos& segMergeInfos)
+{
+    std::vector<std::shared_ptr<framework::Segment>> segments;
+    for (auto it = segMergeInfos.srcSegments.rbegin(); it != segMergeInfos.srcSegments.rend(); ++it) {
+        segments.push_back(it->segment);
+    }
+    if (segments.size() > std::numeric_limits<uint16_t>::max()) {
+        return Status::Unimplement("external sort merge supports at most %u source segments",
+                                   std::numeric_limits<uint16_t>::max());
+    }
+    const std::string tempDirName = "external_sort_merge";
+    auto [status, tempDir] =
+        _targetDir->GetIDirectory()->MakeDirectory(tempDirName, indexlib::file_system::DirectoryOption()).StatusWith();
+    RETURN_IF_STATUS_ERROR(status, "make external sort temp directory failed");
+    AUTIL_LOG(INFO, "external sort merge [%lu] segments for %s, memory quota [%ld]", segments.size(),
+              _indexConfig->GetIndexName().c_str(), _externalSortMemoryQuota);
+
+    // both sorters hold buffers during dedup
+    size_t sorterMemoryQuota = _externalSortMemoryQuota / 2;
+    KVMergeTupleSorter keySorter(tempDir, "key_order", sorterMemoryQuota, &KVMergeTupleSorter::KeyOrder);
+    RETURN_STATUS_DIRECTLY_IF_ERROR(CollectMergeTuples(segments, &keySorter));
+    RETURN_STATUS_DIRECTLY_IF_ERROR(keySorter.Finish());
+
+    KVMergeTupleSorter segmentSorter(tempDir, "segment_order", sorterMemoryQuota, &KVMergeTupleSorter::SegmentOrder);
+    RETURN_STATUS_DIRECTLY_IF_ERROR(DedupMergeTuples(&keySorter, &segmentSorter));
+    RETURN_STATUS_DIRECTLY_IF_ERROR(keySorter.Close());
+    RETURN_STATUS_DIRECTLY_IF_ERROR(segmentSorter.Finish());
+    AUTIL_LOG(INFO, "[%lu] of [%lu] records survive dedup, key order runs [%lu], segment order runs [%lu]",
+              segmentSorter.GetTupleCount(), keySorter.GetTupleCount(), keySorter.GetRunCount(),
+              segmentSorter.GetRunCount());
+
+    RETURN_STATUS_DIRECTLY_IF_ERROR(FetchMergeRecords(segments, &segmentSorter));
+    RETURN_STATUS_DIRECTLY_IF_ERROR(segmentSorter.Close());
+    return _targetDir->GetIDirectory()->RemoveDirectory(tempDirName, indexlib::file_system::RemoveOption()).Status();
+}
+
+Status KVMerger::CollectMergeTuples(const std::vector<std::shared_ptr<framework::Segment>>& segments,
+                                    KVMergeTupleSorter* keySorter) const
+{
+    autil::mem_pool::UnsafePool pool;
+    for (size_t segmentIdx = 0; segmentIdx < segments.size(); ++segmentIdx) {
+        std::unique_ptr<IKVIterator> iterator;
+        IKVIterator* keyIterator = nullptr;
+        RETURN_STATUS_DIRECTLY_IF_ERROR(CreateSegmentIterator(segments[segmentIdx], iterator, keyIterator));
+        uint64_t ordinal = 0;
+        while (keyIterator->HasNext()) {
+            Record record;
+            pool.reset();
+            RETURN_STATUS_DIRECTLY_IF_ERROR(keyIterator->Next(&pool, record));
+            uint64_t recordOrdinal = ordinal++;
+            if (!_recordFilter->IsPassed(record)) {
+                continue;
+            }
+            KVMergeTuple tuple;
+            tuple.key = record.key;
+            tuple.ordinal = recordOrdinal;
+            tuple.timestamp = record.timestamp;
+            tuple.segmentIdx = segmentIdx;
+            tuple.deleted = record.deleted;
+            RETURN_STATUS_DIRECTLY_IF_ERROR(keySorter->Add(tuple));
+        }
+    }
+    return Status::OK();
+}
+
+Status KVMerger::DedupMergeTuples(KVMergeTupleSorter* keySorter, KVMergeTupleSorter* segmentSorter)
+{
+    bool hasLastKey = false;
+    keytype_t lastKey = 0;
+    while (keySorter->HasNext()) {
+        KVMergeTuple tuple;
+        RETURN_STATUS_DIRECTLY_IF_ERROR(keySorter->Next(tuple));
+        if (hasLastKey && tuple.key == lastKey) {
+            // shadowed by the same key in a newer segment
+            continue;
+        }
+        hasLastKey = true;
+        lastKey = tuple.key;
+        if (!tuple.deleted) {
+            RETURN_STATUS_DIRECTLY_IF_ERROR(segmentSorter->Add(tuple));
+            continue;
+        }
+        if (!_dropDeleteKey) {
+            Record record;
+            record.key = tuple.key;
+            record.timestamp = tuple.timestamp;
+            record.deleted = true;
+            RETURN_STATUS_DIRECTLY_IF_ERROR(DeleteRecord(record));
+        }
+    }
+    return Status::OK();
+}
+
+Status KVMerger::FetchMergeRecords(const std::vector<std::shared_ptr<framework::Segment>>& segments,
+                                   KVMergeTupleSorter* segmentSorter)
+{
+    autil::mem_pool::UnsafePool pool;
+    std::unique_ptr<IKVIterator> iterator;
+    IKVIterator* keyIterator = nullptr;
+    int32_t currentSegmentIdx = -1;
+    uint64_t ordinal = 0;
+    while (segmentSorter->HasNext()) {
+        KVMergeTuple tuple;
+        RETURN_STATUS_DIRECTLY_IF_ERROR(segmentSorter->Next(tuple));
+        if (tuple.segmentIdx != currentSegmentIdx) {
+            RETURN_STATUS_DIRECTLY_IF_ERROR(CreateSegmentIterator(segments[tuple.segmentIdx], iterator, keyIterator));
+            currentSegmentIdx = tuple.segmentIdx;
+            ordinal = 0;
+        }
+        Record record;
+        for (; ordinal < tuple.ordinal && keyIterator->HasNext(); ++ordinal) {
+            pool.reset();
+            RETURN_STATUS_DIRECTLY_IF_ERROR(keyIterator->Next(&pool, record));
+        }
+        if (!iterator->HasNext()) {
+            return Status::Corruption("record [%lu] of segment [%d] not found", tuple.ordinal,
+                                      segments[tuple.segmentIdx]->GetSegmentId());
+        }
+        pool.reset();
+        RETURN_STATUS_DIRECTLY_IF_ERROR(iterator->Next(&pool, record));
+        ++ordinal;
+        if (record.key != tuple.key) {
+            return Status::Corruption("record [%lu] of segment [%d] mismatch, expect key [%lu], actual [%lu]",
+                                      tuple.ordinal, segments[tuple.segmentIdx]->GetSegmentId(), tuple.key,
+                                      record.key);
+        }
+        RETURN_STATUS_DIRECTLY_IF_ERROR(AddRecord(record));
+    }
+    return Status::OK();
+}
+
 Status KVMerger::LoadSegmentStatistics(const SegmentMergeInfos& segMergeInfos,
                                        std::vector<SegmentStatistics>& statVec) const
 {
@@ -306,6 +480,8 @@ std::pair<int64_t, int64_t> KVMerger::EstimateMemoryUsage(const std::vector<Segm
     memoryUsage += indexlib::file_system::ReaderOption::DEFAULT_BUFFER_SIZE * 2;
     // key is compress ?
     memoryUsage += indexlib::file_system::WriterOption::DEFAULT_BUFFER_SIZE; // key
+    // tuple sorters of external sort merge
+    memoryUsage += _externalSortMemoryQuota;
 
     return {keyMemoryUsage, memoryUsage};
 }
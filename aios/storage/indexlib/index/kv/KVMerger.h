@@ -52,6 +52,8 @@ class SegmentMetrics;
 namespace indexlibv2::index {
 
 struct Record;
+class IKVIterator;
+class KVMergeTupleSorter;
 class RecordFilter;
 class KeyWriter;
 class AdapterIgnoreFieldCalculator;
@@ -89,14 +91,27 @@ private:
     Status DoMerge(const SegmentMergeInfos& segMergeInfos);
     Status MergeMultiSegments(const SegmentMergeInfos& segMergeInfos);
     Status DeleteRecord(const Record& record);
+    bool UseExternalSortMerge() const;
+    // sort based merge: sort (key, segment, ordinal) tuples of all source records, dedup them in key order, then
+    // read surviving records segment by segment in iteration order
+    Status MergeMultiSegmentsByExternalSort(const SegmentMergeInfos& segMergeInfos);
+    Status CollectMergeTuples(const std::vector<std::shared_ptr<framework::Segment>>& segments,
+                              KVMergeTupleSorter* keySorter) const;
+    Status DedupMergeTuples(KVMergeTupleSorter* keySorter, KVMergeTupleSorter* segmentSorter);
+    Status FetchMergeRecords(const std::vector<std::shared_ptr<framework::Segment>>& segments,
+                             KVMergeTupleSorter* segmentSorter);
+    Status CreateSegmentIterator(const std::shared_ptr<framework::Segment>& segment,
+                                 std::unique_ptr<IKVIterator>& iterator, IKVIterator*& keyIterator) const;
 
 public:
     bool TEST_GetDropDeleteKey() const { return _dropDeleteKey; }
     RecordFilter* TEST_GetRecordFilter() { return _recordFilter.get(); }
+    int64_t TEST_GetExternalSortMemoryQuota() const { return _externalSortMemoryQuota; }
 
 protected:
     KVTypeId _typeId;
     bool _dropDeleteKey = false;
+    int64_t _externalSortMemoryQuota = 0;
     autil::mem_pool::UnsafePool _pool;
     std::unique_ptr<KeyWriter> _keyWriter;
     std::unique_ptr<RecordFilter> _recordFilter;
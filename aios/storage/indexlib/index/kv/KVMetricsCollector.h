@@ -44,6 +44,8 @@ public:
     int64_t GetMemTableCount() const { return _memTableCount; }
     int64_t GetSSTableCount() const { return _sstTableCount; }
     int64_t GetSearchCacheResultCount() const { return _searchCacheResultCount; }
+    // lookups served by an identical in-flight lookup instead of reading segments
+    int64_t GetCoalescedCount() const { return _coalescedCount; }
 
     // IO
     int64_t GetBlockCacheIOCount() const { return _blockCounter.blockCacheIOCount; }
@@ -63,6 +65,7 @@ public:
         _memTableCount = 0;
         _sstTableCount = 0;
         _searchCacheResultCount = 0;
+        _coalescedCount = 0;
         _skeyDataSizeInBlocks = 0;
         _valueDataSizeInBlocks = 0;
         _skeyChunkCountInBlocks = 0;
@@ -131,6 +134,7 @@ public:
     }
 
     void IncSearchCacheResultCount(int64_t count) { _searchCacheResultCount += count; }
+    void IncCoalescedCount() { ++_coalescedCount; }
 
     void IncResultCount(int64_t count)
     {
@@ -175,6 +179,7 @@ public:
         _memTableCount += other._memTableCount;
         _sstTableCount += other._sstTableCount;
         _searchCacheResultCount += other._searchCacheResultCount;
+        _coalescedCount += other._coalescedCount;
 
         _skeyDataSizeInBlocks += other._skeyDataSizeInBlocks;
         _valueChunkCountInBlocks += other._valueChunkCountInBlocks;
@@ -197,6 +202,7 @@ private:
     int64_t _memTableCount = 0;
     int64_t _sstTableCount = 0; // including cache
     int64_t _searchCacheResultCount = 0;
+    int64_t _coalescedCount = 0;
 
     // block cache IO
     int64_t _skeyDataSizeInBlocks = 0;
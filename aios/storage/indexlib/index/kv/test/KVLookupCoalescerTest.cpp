@@ -0,0 +1,53 @@
+#include "indexlib/index/kv/KVLookupCoalescer.h"
+
+#include <optional>
+
+#include "unittest/unittest.h"
+
+namespace indexlibv2::index {
+
+class KVLookupCoalescerTest : public TESTBASE
+{
+};
+
+TEST_F(KVLookupCoalescerTest, testLeaderAndWaiter)
+{
+    KVLookupCoalescer coalescer;
+    auto leader = coalescer.Join(1);
+    ASSERT_TRUE(leader.IsLeader());
+    auto waiter = coalescer.Join(1);
+    ASSERT_FALSE(waiter.IsLeader());
+    auto other = coalescer.Join(2);
+    ASSERT_TRUE(other.IsLeader());
+
+    auto future = waiter.GetFuture();
+    ASSERT_FALSE(future.hasResult());
+    std::string value = "abc";
+    leader.Complete(KVResultStatus::FOUND, autil::StringView(value), 10);
+    ASSERT_TRUE(future.hasResult());
+    value = "xyz";
+    const auto& flight = waiter.GetFlight();
+    EXPECT_EQ(KVResultStatus::FOUND, flight->status);
+    EXPECT_EQ(10, flight->valueTs);
+    EXPECT_EQ("abc", flight->value);
+
+    // finished flight is not joined again
+    auto next = coalescer.Join(1);
+    EXPECT_TRUE(next.IsLeader());
+    EXPECT_EQ(4, coalescer.GetLookupCount());
+    EXPECT_EQ(1, coalescer.GetCoalescedCount());
+}
+
+TEST_F(KVLookupCoalescerTest, testAbandonedLeader)
+{
+    KVLookupCoalescer coalescer;
+    std::optional<KVLookupCoalescer::Ticket> leader(coalescer.Join(1));
+    auto waiter = coalescer.Join(1);
+    auto future = waiter.GetFuture();
+    leader.reset();
+    ASSERT_TRUE(future.hasResult());
+    EXPECT_EQ(KVResultStatus::FAIL, waiter.GetFlight()->status);
+    EXPECT_TRUE(coalescer.Join(1).IsLeader());
+}
+
+} // namespace indexlibv2::index
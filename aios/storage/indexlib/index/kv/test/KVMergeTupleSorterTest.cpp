@@ -0,0 +1,94 @@
+#include "indexlib/index/kv/KVMergeTupleSorter.h"
+
+#include <algorithm>
+#include <random>
+
+#include "indexlib/file_system/Directory.h"
+#include "indexlib/file_system/FileSystemCreator.h"
+#include "indexlib/file_system/IDirectory.h"
+#include "unittest/unittest.h"
+
+namespace indexlibv2::index {
+
+class KVMergeTupleSorterTest : public TESTBASE
+{
+public:
+    void setUp() override
+    {
+        auto [s, fs] =
+            indexlib::file_system::FileSystemCreator::CreateForWrite("ut", GET_TEMP_DATA_PATH()).StatusWith();
+        ASSERT_TRUE(s.IsOK()) << s.ToString();
+        _dir = indexlib::file_system::Directory::Get(fs)->GetIDirectory();
+    }
+
+protected:
+    std::vector<KVMergeTuple> MakeTuples(size_t keyCount, uint16_t segmentCount) const
+    {
+        std::vector<KVMergeTuple> tuples;
+        for (uint16_t segmentIdx = 0; segmentIdx < segmentCount; ++segmentIdx) {
+            for (size_t i = 0; i < keyCount; ++i) {
+                KVMergeTuple tuple;
+                tuple.key = (i * 7919) % keyCount;
+                tuple.ordinal = i;
+                tuple.segmentIdx = segmentIdx;
+                tuples.push_back(tuple);
+            }
+        }
+        std::shuffle(tuples.begin(), tuples.end(), std::mt19937(1));
+        return tuples;
+    }
+
+    void CheckSorted(const std::vector<KVMergeTuple>& tuples, KVMergeTupleSorter::Comparator comparator,
+                     size_t memoryQuota, bool expectSpill)
+    {
+        KVMergeTupleSorter sorter(_dir, "run", memoryQuota, comparator);
+        for (const auto& tuple : tuples) {
+            ASSERT_TRUE(sorter.Add(tuple).IsOK());
+        }
+        ASSERT_TRUE(sorter.Finish().IsOK());
+        ASSERT_EQ(tuples.size(), sorter.GetTupleCount());
+        ASSERT_EQ(expectSpill, sorter.GetRunCount() > 0);
+
+        std::vector<KVMergeTuple> expected = tuples;
+        std::stable_sort(expected.begin(), expected.end(), comparator);
+        for (const auto& expect : expected) {
+            ASSERT_TRUE(sorter.HasNext());
+            KVMergeTuple tuple;
+            ASSERT_TRUE(sorter.Next(tuple).IsOK());
+            ASSERT_EQ(expect.key, tuple.key);
+            ASSERT_EQ(expect.segmentIdx, tuple.segmentIdx);
+            ASSERT_EQ(expect.ordinal, tuple.ordinal);
+        }
+        ASSERT_FALSE(sorter.HasNext());
+        ASSERT_TRUE(sorter.Close().IsOK());
+        ASSERT_FALSE(_dir->IsExist("run_0").GetOrThrow());
+    }
+
+protected:
+    std::shared_ptr<indexlib::file_system::IDirectory> _dir;
+};
+
+TEST_F(KVMergeTupleSorterTest, testInMemory)
+{
+    auto tuples = MakeTuples(100, 3);
+    CheckSorted(tuples, &KVMergeTupleSorter::KeyOrder, 1024 * 1024, false);
+    CheckSorted(tuples, &KVMergeTupleSorter::SegmentOrder, 1024 * 1024, false);
+}
+
+TEST_F(KVMergeTupleSorterTest, testSpillRuns)
+{
+    // quota is below the minimum buffer, each run holds 1024 tuples
+    auto tuples = MakeTuples(2000, 3);
+    CheckSorted(tuples, &KVMergeTupleSorter::KeyOrder, 0, true);
+    CheckSorted(tuples, &KVMergeTupleSorter::SegmentOrder, 0, true);
+}
+
+TEST_F(KVMergeTupleSorterTest, testEmpty)
+{
+    KVMergeTupleSorter sorter(_dir, "run", 0, &KVMergeTupleSorter::KeyOrder);
+    ASSERT_TRUE(sorter.Finish().IsOK());
+    ASSERT_FALSE(sorter.HasNext());
+    ASSERT_TRUE(sorter.Close().IsOK());
+}
+
+} // namespace indexlibv2::index
@@ -88,6 +88,20 @@ TEST_F(KVMergerTest, TestInit)
         ASSERT_TRUE(s.IsOK());
         ASSERT_TRUE(varLenKVMerger.TEST_GetDropDeleteKey());
         ASSERT_TRUE(dynamic_cast<TTLFilter*>(varLenKVMerger.TEST_GetRecordFilter()));
+        ASSERT_EQ(0, varLenKVMerger.TEST_GetExternalSortMemoryQuota());
+    }
+    {
+        std::string field = "key:string;value1:int32;value2:int64;";
+        auto tabletSchema = table::KVTabletSchemaMaker::Make(field, "key", "value1;value2");
+        map<string, any> params = {{DROP_DELETE_KEY, std::string("true")},
+                                   {KV_EXTERNAL_SORT_MERGE_MEMORY_QUOTA_MB, std::string("64")}};
+        VarLenKVMerger varLenKVMerger;
+        ASSERT_TRUE(varLenKVMerger.Init(tabletSchema->GetIndexConfig("kv", "key"), params).IsOK());
+        ASSERT_EQ(64 * 1024 * 1024, varLenKVMerger.TEST_GetExternalSortMemoryQuota());
+
+        params[KV_EXTERNAL_SORT_MERGE_MEMORY_QUOTA_MB] = std::string("-1");
+        VarLenKVMerger invalidMerger;
+        ASSERT_FALSE(invalidMerger.Init(tabletSchema->GetIndexConfig("kv", "key"), params).IsOK());
     }
 }
 
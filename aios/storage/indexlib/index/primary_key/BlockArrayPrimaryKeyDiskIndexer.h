@@ -73,6 +73,38 @@ public:
         }
     }
 
+    // hashKeys must be sorted, keys in the same data block are served by one block read
+    indexlib::index::ErrorCode BatchLookup(const Key* hashKeys, size_t count, docid_t* docIds) noexcept
+    {
+        std::vector<Key> probeKeys;
+        std::vector<size_t> probePos;
+        const Key* keys = hashKeys;
+        if (_bloomFilter) {
+            probeKeys.reserve(count);
+            probePos.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                docIds[i] = INVALID_DOCID;
+                if (_bloomFilter->Contains(hashKeys[i])) {
+                    probeKeys.push_back(hashKeys[i]);
+                    probePos.push_back(i);
+                }
+            }
+            keys = probeKeys.data();
+            count = probeKeys.size();
+        }
+        std::vector<docid_t> values(count, INVALID_DOCID);
+        std::unique_ptr<bool[]> found(new bool[count]);
+        indexlib::file_system::ReadOption readOption;
+        auto ec = _blockArrayReader.BatchFind(keys, count, readOption, values.data(), found.get());
+        if (ec != indexlib::index::ErrorCode::OK) {
+            return ec;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            docIds[_bloomFilter ? probePos[i] : i] = found[i] ? values[i] : INVALID_DOCID;
+        }
+        return indexlib::index::ErrorCode::OK;
+    }
+
     size_t EvaluateCurrentMemUsed() const override
     {
         size_t bloomFilterSize = 0;
@@ -21,10 +21,12 @@ namespace indexlib::index {
 static constexpr const char* PRIMARY_KEY_DATA_SLICE_FILE_NAME = "slice_data";
 static constexpr const char* PRIMARY_KEY_DATA_FILE_NAME = "data";
 static constexpr const char* PRIMARY_KEY_ATTRIBUTE_PREFIX = "attribute";
+static constexpr const char* PRIMARY_KEY_MEMBERSHIP_FILTER_FILE_NAME = "membership_filter";
 
 } // namespace indexlib::index
 
 namespace indexlibv2::index {
 using indexlib::index::PRIMARY_KEY_DATA_FILE_NAME;
 using indexlib::index::PRIMARY_KEY_DATA_SLICE_FILE_NAME;
+using indexlib::index::PRIMARY_KEY_MEMBERSHIP_FILTER_FILE_NAME;
 } // namespace indexlibv2::index
@@ -35,6 +35,10 @@ public:
     {
         return _pkHashTable.Find(hashKey);
     }
+    void BatchLookup(const Key* hashKeys, size_t count, docid_t* docIds) noexcept
+    {
+        _pkHashTable.BatchFind(hashKeys, count, docIds);
+    }
 
 private:
     void* _data;
@@ -23,6 +23,7 @@
 #include "indexlib/index/primary_key/BlockArrayPrimaryKeyDiskIndexer.h"
 #include "indexlib/index/primary_key/Constant.h"
 #include "indexlib/index/primary_key/HashTablePrimaryKeyDiskIndexer.h"
+#include "indexlib/index/primary_key/PrimaryKeyMembershipFilter.h"
 #include "indexlib/index/primary_key/SortArrayPrimaryKeyDiskIndexer.h"
 #include "indexlib/util/Status2Exception.h"
 
@@ -71,7 +72,9 @@ public:
             AUTIL_LOG(ERROR, "open disk indexer failed");
             return Status::IOError("open disk indexer failed");
         }
-
+        auto [status, membershipFilter] = PrimaryKeyMembershipFilter::Load(indexDirectory);
+        RETURN_IF_STATUS_ERROR(status, "load pk membership filter failed");
+        _membershipFilter = std::move(membershipFilter);
         return Status::OK();
     }
 
@@ -159,6 +162,9 @@ public:
     future_lite::coro::Lazy<indexlib::index::Result<docid_t>>
     LookupAsync(const Key& hashKey, future_lite::Executor* executor) const noexcept
     {
+        if (_membershipFilter && !_membershipFilter->MayContain(hashKey)) {
+            co_return INVALID_DOCID;
+        }
         switch (_pkIndexType) {
         case pk_hash_table: {
             co_return _hashTablePrimaryKeyDiskIndexer->Lookup(hashKey);
@@ -178,6 +184,9 @@ public:
 
     indexlib::index::Result<docid_t> Lookup(const Key& hashKey) const noexcept __ALWAYS_INLINE
     {
+        if (_membershipFilter && !_membershipFilter->MayContain(hashKey)) {
+            return INVALID_DOCID;
+        }
         switch (_pkIndexType) {
         case pk_hash_table: {
             return _hashTablePrimaryKeyDiskIndexer->Lookup(hashKey);
@@ -195,6 +204,59 @@ public:
         }
     }
 
+    // hashKeys must be sorted, docIds are segment local, INVALID_DOCID for absent keys
+    indexlib::index::ErrorCode BatchLookup(const Key* hashKeys, size_t count, docid_t* docIds) const noexcept
+    {
+        std::vector<Key> probeKeys;
+        std::vector<size_t> probePos;
+        const Key* keys = hashKeys;
+        if (_membershipFilter) {
+            for (size_t i = 0; i < count; ++i) {
+                docIds[i] = INVALID_DOCID;
+                if (_membershipFilter->MayContain(hashKeys[i])) {
+                    probeKeys.push_back(hashKeys[i]);
+                    probePos.push_back(i);
+                }
+            }
+            if (probeKeys.empty()) {
+                return indexlib::index::ErrorCode::OK;
+            }
+            keys = probeKeys.data();
+        }
+        size_t probeCount = _membershipFilter ? probeKeys.size() : count;
+        std::vector<docid_t> probeDocIds;
+        docid_t* results = docIds;
+        if (_membershipFilter) {
+            probeDocIds.resize(probeCount, INVALID_DOCID);
+            results = probeDocIds.data();
+        }
+        auto ec = indexlib::index::ErrorCode::OK;
+        switch (_pkIndexType) {
+        case pk_hash_table: {
+            _hashTablePrimaryKeyDiskIndexer->BatchLookup(keys, probeCount, results);
+            break;
+        }
+        case pk_sort_array: {
+            _sortArrayPrimaryKeyDiskIndexer->BatchLookup(keys, probeCount, results);
+            break;
+        }
+        case pk_block_array: {
+            ec = _blockArrayPrimaryKeyDiskIndexer->BatchLookup(keys, probeCount, results);
+            break;
+        }
+        default: {
+            AUTIL_LOG(ERROR, "unsupport pk index type!");
+            std::fill(results, results + probeCount, INVALID_DOCID);
+        }
+        }
+        if (ec == indexlib::index::ErrorCode::OK && _membershipFilter) {
+            for (size_t i = 0; i < probeCount; ++i) {
+                docIds[probePos[i]] = probeDocIds[i];
+            }
+        }
+        return ec;
+    }
+
     static size_t CalculateLoadSize(const std::shared_ptr<indexlibv2::index::PrimaryKeyIndexConfig>& indexConfig,
                                     const std::shared_ptr<indexlib::file_system::IDirectory>& dir,
                                     const std::string& fileName)
@@ -292,6 +354,9 @@ public:
         } else if (_blockArrayPrimaryKeyDiskIndexer) {
             totalMemUse += _blockArrayPrimaryKeyDiskIndexer->EvaluateCurrentMemUsed();
         }
+        if (_membershipFilter) {
+            totalMemUse += _membershipFilter->GetMemoryUse();
+        }
         if (_pkAttrDiskIndexer) {
             totalMemUse += _pkAttrDiskIndexer->EvaluateCurrentMemUsed();
         }
@@ -326,6 +391,8 @@ private:
     std::unique_ptr<BlockArrayPrimaryKeyDiskIndexer<Key>> _blockArrayPrimaryKeyDiskIndexer;
     IndexerParameter _indexerParam;
     std::shared_ptr<AttributeDiskIndexer> _pkAttrDiskIndexer;
+    // only set for segments dumped with pk_membership_filter_bits_per_key, not for combined slice segments
+    std::unique_ptr<PrimaryKeyMembershipFilter> _membershipFilter;
 
 private:
     AUTIL_LOG_DECLARE();
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 
@@ -105,6 +106,40 @@ public:
         return INVALID_DOCID;
     }
 
+    // Find for many keys, buckets and chain heads of a window of keys are prefetched before any chain is walked
+    void BatchFind(const Key* keys, size_t count, docid_t* docIds) const
+    {
+        indexlib::util::KeyHash<Key> hashFun;
+        uint64_t bucketIdxs[BATCH_FIND_WINDOW];
+        docid_t heads[BATCH_FIND_WINDOW];
+        for (size_t i = 0; i < count; i += BATCH_FIND_WINDOW) {
+            size_t windowSize = std::min(count - i, BATCH_FIND_WINDOW);
+            for (size_t j = 0; j < windowSize; ++j) {
+                bucketIdxs[j] = hashFun(keys[i + j]) % _bucketCount;
+                __builtin_prefetch(&_bucketPtr[bucketIdxs[j]]);
+            }
+            for (size_t j = 0; j < windowSize; ++j) {
+                heads[j] = _bucketPtr[bucketIdxs[j]];
+                if (heads[j] != INVALID_DOCID) {
+                    __builtin_prefetch(&_pkPairPtr[heads[j]]);
+                }
+            }
+            for (size_t j = 0; j < windowSize; ++j) {
+                const Key& key = keys[i + j];
+                docid_t next = heads[j];
+                docIds[i + j] = INVALID_DOCID;
+                while (next != INVALID_DOCID) {
+                    const PKPairTyped& pkPair = _pkPairPtr[next];
+                    if (likely(pkPair.key == key)) {
+                        docIds[i + j] = next;
+                        break;
+                    }
+                    next = pkPair.docid;
+                }
+            }
+        }
+    }
+
 public:
     static bool SeekToPkPair(const indexlib::file_system::FileReaderPtr& fileReader, uint64_t& pkCount)
     {
@@ -153,6 +188,7 @@ private:
     }
 
 private:
+    static constexpr size_t BATCH_FIND_WINDOW = 16;
     static docid_t NON_EXIST_DOCID;
     static PKPairTyped INVALID_PK_PAIR;
     static double BUCKET_COUNT_FACTOR;
@@ -68,6 +68,15 @@ public:
                                      future_lite::Executor* executor = nullptr) const = 0;
     virtual bool LookupWithPKHash(const autil::uint128_t& pkHash, segmentid_t specifySegment, docid_t* docid) const = 0;
 
+    // same result as Lookup(pkStrs[i]) for every key, readers may probe all keys segment by segment
+    virtual void BatchLookup(const std::vector<std::string>& pkStrs, std::vector<docid_t>* docIds) const
+    {
+        docIds->resize(pkStrs.size());
+        for (size_t i = 0; i < pkStrs.size(); ++i) {
+            (*docIds)[i] = Lookup(pkStrs[i]);
+        }
+    }
+
     virtual std::shared_ptr<indexlibv2::index::AttributeReader> GetPKAttributeReader() const = 0;
 
     virtual docid_t LookupWithDocRange(const autil::uint128_t& pkHash, std::pair<docid_t, docid_t> docRange,
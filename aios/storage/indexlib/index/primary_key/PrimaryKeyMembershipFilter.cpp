@@ -0,0 +1,98 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "indexlib/index/primary_key/PrimaryKeyMembershipFilter.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "indexlib/file_system/ReaderOption.h"
+#include "indexlib/file_system/WriterOption.h"
+#include "indexlib/file_system/file/FileReader.h"
+#include "indexlib/file_system/file/FileWriter.h"
+#include "indexlib/index/primary_key/Constant.h"
+
+namespace indexlibv2::index {
+AUTIL_LOG_SETUP(indexlib.index, PrimaryKeyMembershipFilter);
+
+void PrimaryKeyMembershipFilter::Init(size_t keyCount, uint32_t bitsPerKey)
+{
+    assert(bitsPerKey > 0);
+    // optimal k for a plain bloom filter is bitsPerKey * ln2, blocked filters do best slightly below it
+    _hashFuncNum = std::clamp((uint32_t)std::lround(bitsPerKey * 0.69), 1u, 16u);
+    uint64_t totalBits = std::max<uint64_t>(keyCount, 1) * bitsPerKey;
+    _blockCount = std::max<uint64_t>((totalBits + WORDS_PER_BLOCK * 64 - 1) / (WORDS_PER_BLOCK * 64), 1);
+    _words.assign(_blockCount * WORDS_PER_BLOCK, 0);
+}
+
+Status PrimaryKeyMembershipFilter::Store(const std::shared_ptr<indexlib::file_system::IDirectory>& directory) const
+{
+    auto [status, fileWriter] =
+        directory->CreateFileWriter(PRIMARY_KEY_MEMBERSHIP_FILTER_FILE_NAME, indexlib::file_system::WriterOption())
+            .StatusWith();
+    RETURN_IF_STATUS_ERROR(status, "create pk membership filter file failed");
+    FileHeader header {FILE_MAGIC, _hashFuncNum, _blockCount};
+    status = fileWriter->Write(&header, sizeof(header)).Status();
+    RETURN_IF_STATUS_ERROR(status, "write pk membership filter header failed");
+    status = fileWriter->Write(_words.data(), GetMemoryUse()).Status();
+    RETURN_IF_STATUS_ERROR(status, "write pk membership filter data failed");
+    return fileWriter->Close().Status();
+}
+
+std::pair<Status, std::unique_ptr<PrimaryKeyMembershipFilter>>
+PrimaryKeyMembershipFilter::Load(const std::shared_ptr<indexlib::file_system::IDirectory>& directory)
+{
+    auto [existStatus, exist] = directory->IsExist(PRIMARY_KEY_MEMBERSHIP_FILTER_FILE_NAME).StatusWith();
+    if (!existStatus.IsOK()) {
+        return {existStatus, nullptr};
+    }
+    if (!exist) {
+        return {Status::OK(), nullptr};
+    }
+    auto [status, fileReader] =
+        directory
+            ->CreateFileReader(PRIMARY_KEY_MEMBERSHIP_FILTER_FILE_NAME,
+                               indexlib::file_system::ReaderOption::NoCache(indexlib::file_system::FSOT_BUFFERED))
+            .StatusWith();
+    if (!status.IsOK()) {
+        return {status, nullptr};
+    }
+    FileHeader header;
+    auto [headerStatus, headerLen] = fileReader->Read(&header, sizeof(header), 0).StatusWith();
+    if (!headerStatus.IsOK() || headerLen != sizeof(header) || header.magic != FILE_MAGIC || header.blockCount == 0 ||
+        header.hashFuncNum == 0 ||
+        fileReader->GetLength() != sizeof(header) + header.blockCount * WORDS_PER_BLOCK * sizeof(uint64_t)) {
+        AUTIL_LOG(ERROR, "invalid pk membership filter file [%s]", fileReader->DebugString().c_str());
+        return {Status::Corruption("invalid pk membership filter file"), nullptr};
+    }
+    auto filter = std::make_unique<PrimaryKeyMembershipFilter>();
+    filter->_hashFuncNum = header.hashFuncNum;
+    filter->_blockCount = header.blockCount;
+    filter->_words.resize(header.blockCount * WORDS_PER_BLOCK);
+    auto [dataStatus, dataLen] =
+        fileReader->Read(filter->_words.data(), filter->GetMemoryUse(), sizeof(header)).StatusWith();
+    if (!dataStatus.IsOK() || dataLen != filter->GetMemoryUse()) {
+        AUTIL_LOG(ERROR, "read pk membership filter file [%s] failed", fileReader->DebugString().c_str());
+        return {Status::IOError("read pk membership filter failed"), nullptr};
+    }
+    status = fileReader->Close().Status();
+    if (!status.IsOK()) {
+        return {status, nullptr};
+    }
+    return {Status::OK(), std::move(filter)};
+}
+
+} // namespace indexlibv2::index
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "autil/Log.h"
+#include "autil/LongHashValue.h"
+#include "autil/NoCopyable.h"
+#include "indexlib/base/Status.h"
+#include "indexlib/file_system/IDirectory.h"
+
+namespace indexlibv2::index {
+
+// Blocked bloom filter over the pk hashes of one segment, built at dump/merge time and loaded into memory by the
+// disk indexer. All probes of a key fall into one 64-byte block, so a negative answer costs one cache miss instead
+// of a probe into the segment's pk data (which may live in block cache).
+class PrimaryKeyMembershipFilter : public autil::NoCopyable
+{
+public:
+    PrimaryKeyMembershipFilter() = default;
+    ~PrimaryKeyMembershipFilter() = default;
+
+public:
+    void Init(size_t keyCount, uint32_t bitsPerKey);
+
+    template <typename Key>
+    void Insert(const Key& key)
+    {
+        uint64_t hash = HashKey(key);
+        uint64_t* block = GetBlock(hash);
+        uint64_t probe = Mix(hash ^ PROBE_SEED);
+        for (uint32_t i = 0; i < _hashFuncNum; ++i) {
+            uint32_t bit = GetProbeBit(probe, i);
+            block[bit >> 6] |= (1ULL << (bit & 63));
+        }
+    }
+
+    template <typename Key>
+    bool MayContain(const Key& key) const __ALWAYS_INLINE
+    {
+        uint64_t hash = HashKey(key);
+        const uint64_t* block = GetBlock(hash);
+        uint64_t probe = Mix(hash ^ PROBE_SEED);
+        for (uint32_t i = 0; i < _hashFuncNum; ++i) {
+            uint32_t bit = GetProbeBit(probe, i);
+            if ((block[bit >> 6] & (1ULL << (bit & 63))) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    Status Store(const std::shared_ptr<indexlib::file_system::IDirectory>& directory) const;
+    // filter is nullptr if the segment was dumped without one
+    static std::pair<Status, std::unique_ptr<PrimaryKeyMembershipFilter>>
+    Load(const std::shared_ptr<indexlib::file_system::IDirectory>& directory);
+
+    size_t GetMemoryUse() const { return _words.size() * sizeof(uint64_t); }
+    uint32_t GetHashFuncNum() const { return _hashFuncNum; }
+    uint64_t GetBlockCount() const { return _blockCount; }
+
+private:
+    struct FileHeader {
+        uint32_t magic;
+        uint32_t hashFuncNum;
+        uint64_t blockCount;
+    };
+
+    static constexpr uint32_t FILE_MAGIC = 0x504b4d46; // "PKMF"
+    static constexpr size_t WORDS_PER_BLOCK = 8;
+    static constexpr uint64_t PROBE_SEED = 0x9e3779b97f4a7c15ULL;
+
+    static uint64_t Mix(uint64_t value)
+    {
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33;
+        value *= 0xc4ceb9fe1a85ec53ULL;
+        value ^= value >> 33;
+        return value;
+    }
+    static uint64_t HashKey(uint64_t key) { return Mix(key); }
+    static uint64_t HashKey(const autil::uint128_t& key) { return Mix(key.value[0] ^ Mix(key.value[1])); }
+
+    static uint32_t GetProbeBit(uint64_t probe, uint32_t i)
+    {
+        uint32_t h1 = (uint32_t)probe;
+        uint32_t h2 = (uint32_t)(probe >> 32) | 1;
+        return (h1 + i * h2) & (WORDS_PER_BLOCK * 64 - 1);
+    }
+    uint64_t* GetBlock(uint64_t hash) { return _words.data() + GetBlockIdx(hash) * WORDS_PER_BLOCK; }
+    const uint64_t* GetBlock(uint64_t hash) const { return _words.data() + GetBlockIdx(hash) * WORDS_PER_BLOCK; }
+    uint64_t GetBlockIdx(uint64_t hash) const { return ((hash >> 32) * _blockCount) >> 32; }
+
+private:
+    uint32_t _hashFuncNum = 0;
+    uint64_t _blockCount = 0;
+    std::vector<uint64_t> _words;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+} // namespace indexlibv2::index
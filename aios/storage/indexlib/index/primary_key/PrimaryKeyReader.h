@@ -114,6 +114,7 @@ public:
     bool LookupAll(const std::string& pkStr, std::vector<std::pair<docid_t, bool>>& docidPairVec) const override;
 
     docid_t Lookup(const std::string& strKey) const override { return Lookup(strKey, nullptr); }
+    void BatchLookup(const std::vector<std::string>& pkStrs, std::vector<docid_t>* docIds) const override;
 
     bool CheckDuplication() const override;
 
@@ -121,6 +122,9 @@ public:
     docid_t Lookup(const Key& key, future_lite::Executor* executor = nullptr) const __ALWAYS_INLINE;
     docid_t Lookup(const Key& key, docid_t& lastDocId) const;
     docid_t Lookup(const std::string& pkStr, docid_t& lastDocId) const;
+    // same result as Lookup(hashKeys[i]) for every key, disk segments are probed once per segment with all keys
+    // still unresolved, sorted so that sort/block array segments can share searches and block reads
+    void BatchLookup(const std::vector<Key>& hashKeys, std::vector<docid_t>* docIds) const;
 
 public:
     static std::string Identifier()
@@ -634,6 +638,85 @@ docid_t PrimaryKeyReader<Key, DerivedType>::Lookup(const std::string& strKey, fu
     return Lookup(hashKey, executor);
 }
 
+template <typename Key, typename DerivedType>
+void PrimaryKeyReader<Key, DerivedType>::BatchLookup(const std::vector<std::string>& pkStrs,
+                                                     std::vector<docid_t>* docIds) const
+{
+    std::vector<Key> hashKeys;
+    std::vector<size_t> hashedPos;
+    hashKeys.reserve(pkStrs.size());
+    hashedPos.reserve(pkStrs.size());
+    for (size_t i = 0; i < pkStrs.size(); ++i) {
+        Key hashKey;
+        if (Hash(pkStrs[i], hashKey)) {
+            hashKeys.push_back(hashKey);
+            hashedPos.push_back(i);
+        }
+    }
+    std::vector<docid_t> hashedDocIds;
+    BatchLookup(hashKeys, &hashedDocIds);
+    docIds->assign(pkStrs.size(), INVALID_DOCID);
+    for (size_t i = 0; i < hashedPos.size(); ++i) {
+        (*docIds)[hashedPos[i]] = hashedDocIds[i];
+    }
+}
+
+template <typename Key, typename DerivedType>
+void PrimaryKeyReader<Key, DerivedType>::BatchLookup(const std::vector<Key>& hashKeys,
+                                                     std::vector<docid_t>* docIds) const
+{
+    docIds->assign(hashKeys.size(), INVALID_DOCID);
+    std::vector<size_t> pendingPos;
+    pendingPos.reserve(hashKeys.size());
+    for (size_t i = 0; i < hashKeys.size(); ++i) {
+        if (_needLookupReverse) {
+            docid_t docId = LookupInMemorySegment(hashKeys[i]);
+            if (IsDocIdValid(docId)) {
+                (*docIds)[i] = docId;
+                continue;
+            }
+        }
+        pendingPos.push_back(i);
+    }
+    std::sort(pendingPos.begin(), pendingPos.end(),
+              [&hashKeys](size_t lhs, size_t rhs) { return hashKeys[lhs] < hashKeys[rhs]; });
+
+    std::vector<Key> pendingKeys;
+    std::vector<docid_t> localDocIds;
+    for (const auto& readerInfo : _segmentReaderList) {
+        if (pendingPos.empty()) {
+            break;
+        }
+        pendingKeys.resize(pendingPos.size());
+        for (size_t i = 0; i < pendingPos.size(); ++i) {
+            pendingKeys[i] = hashKeys[pendingPos[i]];
+        }
+        localDocIds.resize(pendingPos.size());
+        const auto& [baseDocId, segReader] = readerInfo._segmentPair;
+        auto ec = segReader->BatchLookup(pendingKeys.data(), pendingKeys.size(), localDocIds.data());
+        indexlib::index::ThrowIfError(ec);
+        size_t stillPending = 0;
+        for (size_t i = 0; i < pendingPos.size(); ++i) {
+            if (localDocIds[i] != INVALID_DOCID && IsDocIdValid(baseDocId + localDocIds[i])) {
+                (*docIds)[pendingPos[i]] = baseDocId + localDocIds[i];
+                continue;
+            }
+            // for inc cover rt, rt doc deleted use inc doc
+            pendingPos[stillPending++] = pendingPos[i];
+        }
+        pendingPos.resize(stillPending);
+    }
+
+    if (!_needLookupReverse) {
+        for (size_t pos : pendingPos) {
+            docid_t docId = LookupInMemorySegment(hashKeys[pos]);
+            if (IsDocIdValid(docId)) {
+                (*docIds)[pos] = docId;
+            }
+        }
+    }
+}
+
 template <typename Key, typename DerivedType>
 docid_t PrimaryKeyReader<Key, DerivedType>::Lookup(const Key& hashKey, docid_t& lastDocId) const
 {
@@ -41,6 +41,7 @@
 #include "indexlib/index/primary_key/Constant.h"
 #include "indexlib/index/primary_key/PrimaryKeyFileWriter.h"
 #include "indexlib/index/primary_key/PrimaryKeyFileWriterCreator.h"
+#include "indexlib/index/primary_key/PrimaryKeyMembershipFilter.h"
 #include "indexlib/util/Exception.h"
 #include "indexlib/util/HashMap.h"
 #include "indexlib/util/memory_control/BuildResourceMetrics.h"
@@ -100,6 +101,8 @@ private:
     Status DumpHashMap(const indexlib::file_system::FileWriterPtr& fileWriter,
                        const std::shared_ptr<HashMapTyped>& hashMap, autil::mem_pool::PoolBase* dumpPool,
                        const std::shared_ptr<framework::DumpParams>& dumpParams);
+    Status DumpMembershipFilter(const indexlib::file_system::DirectoryPtr& indexDirectory,
+                                const std::shared_ptr<HashMapTyped>& hashMap);
     uint32_t GetDistinctTermCount() const;
     bool CheckPrimaryKeyStr(const std::string& str) const;
 
@@ -157,6 +160,8 @@ Status PrimaryKeyWriter<Key>::Dump(autil::mem_pool::PoolBase* dumpPool,
     if (!status.IsOK()) {
         return status;
     }
+    status = DumpMembershipFilter(indexDirectory, _hashMap);
+    RETURN_IF_STATUS_ERROR(status, "dump pk membership filter failed");
 
     if (_pkAttributeWriter) {
         auto status = _pkAttributeWriter->Dump(dumpPool, indexDirectory, dumpParams);
@@ -236,6 +241,25 @@ Status PrimaryKeyWriter<Key>::DumpHashMap(const indexlib::file_system::FileWrite
     return _primaryKeyFileWriter->Close();
 }
 
+template <typename Key>
+Status PrimaryKeyWriter<Key>::DumpMembershipFilter(const indexlib::file_system::DirectoryPtr& indexDirectory,
+                                                   const std::shared_ptr<HashMapTyped>& hashMap)
+{
+    auto pkIndexConfig = std::dynamic_pointer_cast<indexlibv2::index::PrimaryKeyIndexConfig>(_indexConfig);
+    assert(pkIndexConfig);
+    uint32_t bitsPerKey = pkIndexConfig->GetMembershipFilterBitsPerKey();
+    if (bitsPerKey == 0) {
+        return Status::OK();
+    }
+    PrimaryKeyMembershipFilter filter;
+    filter.Init(hashMap->Size(), bitsPerKey);
+    auto it = hashMap->CreateIterator();
+    while (it.HasNext()) {
+        filter.Insert(it.Next().first);
+    }
+    return filter.Store(indexDirectory->GetIDirectory());
+}
+
 template <typename Key>
 void PrimaryKeyWriter<Key>::UpdateMemUse(BuildingIndexMemoryUseUpdater* memUpdater)
 {
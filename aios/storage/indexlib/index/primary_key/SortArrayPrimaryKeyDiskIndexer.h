@@ -47,6 +47,31 @@ public:
         return INVALID_DOCID;
     }
 
+    // hashKeys must be sorted, each search starts where the previous key was found
+    void BatchLookup(const Key* hashKeys, size_t count, docid_t* docIds) noexcept
+    {
+        PKPairTyped* iter = (PKPairTyped*)_data;
+        PKPairTyped* end = iter + _itemCount;
+        for (size_t i = 0; i < count; ++i) {
+            const Key& hashKey = hashKeys[i];
+            docIds[i] = INVALID_DOCID;
+            if (_bloomFilter && !_bloomFilter->Contains(hashKey)) {
+                continue;
+            }
+            assert(i == 0 || !(hashKey < hashKeys[i - 1]));
+            iter = std::lower_bound(iter, end, hashKey);
+            if (iter == end) {
+                for (size_t j = i + 1; j < count; ++j) {
+                    docIds[j] = INVALID_DOCID;
+                }
+                return;
+            }
+            if (iter->key == hashKey) {
+                docIds[i] = iter->docid;
+            }
+        }
+    }
+
     size_t EvaluateCurrentMemUsed() const override
     {
         size_t bloomFilterSize = 0;
@@ -43,6 +43,8 @@ struct PrimaryKeyIndexConfig::Impl {
     /*inByte*/ /*used for block array type, should be 2^n, such as 4096*/
     uint32_t bloomFilterMultipleNum = 0;
     bool paralllelLookupOnBuild = false;
+    // 0 means no membership filter is dumped with segments
+    uint32_t membershipFilterBitsPerKey = 0;
 };
 
 PrimaryKeyIndexConfig::PrimaryKeyIndexConfig(const std::string& indexName, InvertedIndexType indexType)
@@ -84,6 +86,9 @@ void PrimaryKeyIndexConfig::Serialize(autil::legacy::Jsonizable::JsonWrapper& js
     string pkHashTypeStr = PkHashTypeToString(_impl->pkHashType);
     json.Jsonize("pk_hash_type", pkHashTypeStr);
     json.Jsonize("has_primary_key_attribute", _impl->hasPKAttribute);
+    if (_impl->membershipFilterBitsPerKey > 0) {
+        json.Jsonize("pk_membership_filter_bits_per_key", _impl->membershipFilterBitsPerKey);
+    }
 }
 
 Status PrimaryKeyIndexConfig::CheckEqual(const InvertedIndexConfig& other) const
@@ -178,6 +183,12 @@ void PrimaryKeyIndexConfig::EnableParallelLookupOnBuild() { _impl->paralllelLook
 
 int32_t PrimaryKeyIndexConfig::GetPrimaryKeyDataBlockSize() const { return _impl->pkDataBlockSize; }
 
+uint32_t PrimaryKeyIndexConfig::GetMembershipFilterBitsPerKey() const { return _impl->membershipFilterBitsPerKey; }
+void PrimaryKeyIndexConfig::SetMembershipFilterBitsPerKey(uint32_t bitsPerKey)
+{
+    _impl->membershipFilterBitsPerKey = bitsPerKey;
+}
+
 bool PrimaryKeyIndexConfig::IsPrimaryKeyIndex() const
 {
     return GetInvertedIndexType() == it_primarykey64 || GetInvertedIndexType() == it_primarykey128;
@@ -284,6 +295,8 @@ void PrimaryKeyIndexConfig::DoDeserialize(const autil::legacy::Any& any,
     bool useNumberPkHash = false;
     jsonWrapper.Jsonize(config::USE_NUMBER_PK_HASH, useNumberPkHash, false);
     jsonWrapper.Jsonize("has_primary_key_attribute", _impl->hasPKAttribute, _impl->hasPKAttribute);
+    jsonWrapper.Jsonize("pk_membership_filter_bits_per_key", _impl->membershipFilterBitsPerKey,
+                        _impl->membershipFilterBitsPerKey);
     if (useNumberPkHash) {
         _impl->pkHashType = pk_number_hash;
     }
@@ -54,6 +54,9 @@ public:
     PrimaryKeyHashType GetPrimaryKeyHashType() const;
     void SetPrimaryKeyDataBlockSize(int32_t pkDataBlockSize);
     int32_t GetPrimaryKeyDataBlockSize() const;
+    // bits per key of the membership filter dumped with each segment, 0 means disabled
+    uint32_t GetMembershipFilterBitsPerKey() const;
+    void SetMembershipFilterBitsPerKey(uint32_t bitsPerKey);
 
     bool GetBloomFilterParamForPkReader(uint32_t& multipleNum, uint32_t& hashFuncNum) const;
     void EnableBloomFilterForPkReader(uint32_t multipleNum);
@@ -27,6 +27,7 @@
 #include "indexlib/index/IndexFactoryCreator.h"
 #include "indexlib/index/primary_key/PrimaryKeyFileWriterCreator.h"
 #include "indexlib/index/primary_key/PrimaryKeyIterator.h"
+#include "indexlib/index/primary_key/PrimaryKeyMembershipFilter.h"
 #include "indexlib/index/primary_key/config/PrimaryKeyIndexConfig.h"
 #include "indexlib/index/primary_key/merger/OnDiskHashPrimaryKeyIterator.h"
 #include "indexlib/index/primary_key/merger/OnDiskOrderedPrimaryKeyIterator.h"
@@ -143,6 +144,11 @@ Status PrimaryKeyMerger<Key>::MergePkData(const std::shared_ptr<DocMapper>& docM
         return Status::Corruption("create pk iterator failed.");
     }
     std::map<segmentid_t, std::shared_ptr<PrimaryKeyFileWriter<Key>>> segIdToWriter;
+    // filled only when pk_membership_filter_bits_per_key is configured
+    std::map<segmentid_t, std::pair<std::shared_ptr<indexlib::file_system::IDirectory>,
+                                    std::unique_ptr<PrimaryKeyMembershipFilter>>>
+        segIdToFilter;
+    uint32_t filterBitsPerKey = pkConfig->GetMembershipFilterBitsPerKey();
 
     auto indexFactoryCreator = index::IndexFactoryCreator::GetInstance();
     const std::string& indexType = _indexConfig->GetIndexType();
@@ -202,6 +208,11 @@ Status PrimaryKeyMerger<Key>::MergePkData(const std::shared_ptr<DocMapper>& docM
         segMeta->segmentMetrics->SetKeyCount(docCount);
         primaryKeyFileWriter->Init(docCount, docCount, fileWriter, &_pool);
         segIdToWriter[segMeta->segmentId] = primaryKeyFileWriter;
+        if (filterBitsPerKey > 0) {
+            auto filter = std::make_unique<PrimaryKeyMembershipFilter>();
+            filter->Init(docCount, filterBitsPerKey);
+            segIdToFilter[segMeta->segmentId] = std::make_pair(pkDirectory, std::move(filter));
+        }
     }
 
     typename PrimaryKeyIterator<Key>::PKPairTyped pkPair;
@@ -226,6 +237,9 @@ Status PrimaryKeyMerger<Key>::MergePkData(const std::shared_ptr<DocMapper>& docM
         if (!status.IsOK()) {
             return status;
         }
+        if (filterBitsPerKey > 0) {
+            segIdToFilter[localInfo.first].second->Insert(pkPair.key);
+        }
     }
     for (const auto& iter : segIdToWriter) {
         auto status = iter.second->Close();
@@ -233,6 +247,10 @@ Status PrimaryKeyMerger<Key>::MergePkData(const std::shared_ptr<DocMapper>& docM
             return status;
         }
     }
+    for (const auto& [segId, dirAndFilter] : segIdToFilter) {
+        auto status = dirAndFilter.second->Store(dirAndFilter.first);
+        RETURN_IF_STATUS_ERROR(status, "store pk membership filter for segment [%d] failed", segId);
+    }
     AUTIL_LOG(INFO, "merge primary key data end");
     return Status::OK();
 }
@@ -0,0 +1,94 @@
+#include "indexlib/index/primary_key/PrimaryKeyMembershipFilter.h"
+
+#include "indexlib/file_system/Directory.h"
+#include "indexlib/file_system/FileSystemCreator.h"
+#include "indexlib/file_system/FileSystemOptions.h"
+#include "indexlib/file_system/IFileSystem.h"
+#include "unittest/unittest.h"
+
+namespace indexlibv2::index {
+
+class PrimaryKeyMembershipFilterTest : public TESTBASE
+{
+public:
+    PrimaryKeyMembershipFilterTest() = default;
+    ~PrimaryKeyMembershipFilterTest() = default;
+
+public:
+    void setUp() override
+    {
+        indexlib::file_system::FileSystemOptions fsOptions;
+        auto fs = indexlib::file_system::FileSystemCreator::Create("PrimaryKeyMembershipFilterTest",
+                                                                   GET_TEMP_DATA_PATH(), fsOptions)
+                      .GetOrThrow();
+        _directory = indexlib::file_system::Directory::Get(fs)->GetIDirectory();
+    }
+    void tearDown() override {}
+
+private:
+    std::shared_ptr<indexlib::file_system::IDirectory> _directory;
+};
+
+TEST_F(PrimaryKeyMembershipFilterTest, TestNoFalseNegative)
+{
+    PrimaryKeyMembershipFilter filter;
+    filter.Init(10000, 10);
+    for (uint64_t key = 0; key < 10000; ++key) {
+        filter.Insert(key * 7);
+    }
+    for (uint64_t key = 0; key < 10000; ++key) {
+        ASSERT_TRUE(filter.MayContain(key * 7)) << key;
+    }
+    // 10 bits per key gives ~1% false positive rate, leave room for the blocked layout
+    size_t falsePositive = 0;
+    for (uint64_t key = 0; key < 10000; ++key) {
+        if (filter.MayContain(key * 7 + 1)) {
+            ++falsePositive;
+        }
+    }
+    ASSERT_LT(falsePositive, 300);
+}
+
+TEST_F(PrimaryKeyMembershipFilterTest, TestUint128Key)
+{
+    PrimaryKeyMembershipFilter filter;
+    filter.Init(1000, 16);
+    for (uint64_t i = 0; i < 1000; ++i) {
+        autil::uint128_t key;
+        key.value[0] = i;
+        key.value[1] = i * 31;
+        filter.Insert(key);
+    }
+    for (uint64_t i = 0; i < 1000; ++i) {
+        autil::uint128_t key;
+        key.value[0] = i;
+        key.value[1] = i * 31;
+        ASSERT_TRUE(filter.MayContain(key));
+    }
+}
+
+TEST_F(PrimaryKeyMembershipFilterTest, TestStoreAndLoad)
+{
+    auto [status, emptyFilter] = PrimaryKeyMembershipFilter::Load(_directory);
+    ASSERT_TRUE(status.IsOK());
+    ASSERT_FALSE(emptyFilter);
+
+    PrimaryKeyMembershipFilter filter;
+    filter.Init(100, 10);
+    for (uint64_t key = 0; key < 100; ++key) {
+        filter.Insert(key);
+    }
+    ASSERT_TRUE(filter.Store(_directory).IsOK());
+
+    auto [loadStatus, loadedFilter] = PrimaryKeyMembershipFilter::Load(_directory);
+    ASSERT_TRUE(loadStatus.IsOK());
+    ASSERT_TRUE(loadedFilter);
+    ASSERT_EQ(filter.GetHashFuncNum(), loadedFilter->GetHashFuncNum());
+    ASSERT_EQ(filter.GetBlockCount(), loadedFilter->GetBlockCount());
+    ASSERT_EQ(filter.GetMemoryUse(), loadedFilter->GetMemoryUse());
+    for (uint64_t key = 0; key < 1000; ++key) {
+        ASSERT_EQ(filter.MayContain(key), loadedFilter->MayContain(key));
+    }
+}
+
+} // namespace indexlibv2::index
@@ -147,6 +147,11 @@ void PrimaryKeyWriterTest::TestInternal(PrimaryKeyIndexType indexType)
         ss << "pkstr" << i;
         ASSERT_EQ(answer[i], reader.Lookup(ss.str(), nullptr));
     }
+
+    std::vector<std::string> pkStrs {"pkstr8", "pkstr0", "not_exist", "pkstr4", "pkstr8"};
+    std::vector<docid_t> docIds;
+    reader.BatchLookup(pkStrs, &docIds);
+    ASSERT_EQ((std::vector<docid_t> {8, 0, INVALID_DOCID, 4, 8}), docIds);
 }
 
 std::shared_ptr<indexlibv2::index::PrimaryKeyIndexConfig>
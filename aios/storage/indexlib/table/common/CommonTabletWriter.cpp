@@ -276,7 +276,8 @@ std::unique_ptr<SegmentDumper> CommonTabletWriter::CreateSegmentDumper()
     _buildingSegment->Seal();
     return std::make_unique<SegmentDumper>(_tabletData->GetTabletName(), _buildingSegment,
                                            GetBuildingSegmentDumpExpandSize(),
-                                           _buildResource.metricsManager->GetMetricsReporter());
+                                           _buildResource.metricsManager->GetMetricsReporter(),
+                                           _options->GetBuildConfig().GetDumpThreadCount());
 }
 
 void CommonTabletWriter::RegisterTableSepecificMetrics() {}
@@ -51,7 +51,15 @@ Status KVReaderImpl::DoOpen(const std::shared_ptr<indexlibv2::config::KVIndexCon
         _kvReportMetrics = false;
     }
     _hasTTL = kvIndexConfig->TTLEnabled();
-    return LoadSegmentReader(kvIndexConfig, tabletData);
+    auto status = LoadSegmentReader(kvIndexConfig, tabletData);
+    if (!status.IsOK()) {
+        return status;
+    }
+    if (!_diskShardReaders.empty() && autil::EnvUtil::getEnv<bool>("INDEXLIB_KV_COALESCE_LOOKUP", false)) {
+        AUTIL_LOG(INFO, "enable lookup coalescing for kv index [%s]", kvIndexConfig->GetIndexName().c_str());
+        _lookupCoalescer = std::make_unique<index::KVLookupCoalescer>();
+    }
+    return status;
 }
 
 Status KVReaderImpl::LoadSegmentReader(const std::shared_ptr<indexlibv2::config::KVIndexConfig>& kvIndexConfig,
@@ -24,6 +24,7 @@
 #include "indexlib/framework/TabletData.h"
 #include "indexlib/index/kv/IKVSegmentReader.h"
 #include "indexlib/index/kv/KVIndexReader.h"
+#include "indexlib/index/kv/KVLookupCoalescer.h"
 #include "indexlib/index/kv/KVMetricsCollector.h"
 #include "indexlib/util/ShardUtil.h"
 #include "indexlib/util/Status.h"
@@ -61,6 +62,10 @@ protected:
         DoGet(const index::KVReadOptions* readOptions, index::keytype_t key, autil::StringView& value,
               uint64_t& valueTs, index::KVMetricsCollector* metricsCollector = NULL) const noexcept;
 
+    FL_LAZY(index::KVResultStatus)
+    CoalescedGet(const index::KVReadOptions* readOptions, index::keytype_t key, autil::StringView& value,
+                 uint64_t& valueTs, index::KVMetricsCollector* metricsCollector) const noexcept;
+
     FL_LAZY(index::KVResultStatus)
     GetFromMemSegment(index::keytype_t key, autil::StringView& value, uint64_t& valueTs, size_t shardId,
                       autil::mem_pool::Pool* pool, index::KVMetricsCollector* metricsCollector,
@@ -106,6 +111,8 @@ protected:
     SegmentShardReaderVector _memoryShardReaders;
     SegmentShardReaderVector _diskShardReaders;
     std::shared_ptr<index::AdapterIgnoreFieldCalculator> _ignoreFieldCalculator;
+    // enabled by env INDEXLIB_KV_COALESCE_LOOKUP, only useful when lookups may block on disk io
+    std::unique_ptr<index::KVLookupCoalescer> _lookupCoalescer;
 
 private:
     AUTIL_LOG_DECLARE();
@@ -131,7 +138,12 @@ inline FL_LAZY(index::KVResultStatus) KVReaderImpl::InnerGet(const index::KVRead
     if (currentTimeInSecond > _ttl) {
         minimumTsInSecond = currentTimeInSecond - _ttl;
     }
-    auto status = FL_COAWAIT DoGet(readOptions, key, value, valueTs, metricsCollector);
+    index::KVResultStatus status;
+    if (_lookupCoalescer && readOptions->pool) {
+        status = FL_COAWAIT CoalescedGet(readOptions, key, value, valueTs, metricsCollector);
+    } else {
+        status = FL_COAWAIT DoGet(readOptions, key, value, valueTs, metricsCollector);
+    }
     if (status == index::KVResultStatus::FOUND && _hasTTL) {
         status = valueTs >= minimumTsInSecond ? index::KVResultStatus::FOUND : index::KVResultStatus::NOT_FOUND;
     }
@@ -164,6 +176,41 @@ inline FL_LAZY(index::KVResultStatus) KVReaderImpl::DoGet(const index::KVReadOpt
                                                timeoutTerminator);
 }
 
+inline FL_LAZY(index::KVResultStatus) KVReaderImpl::CoalescedGet(const index::KVReadOptions* readOptions,
+                                                                 index::keytype_t key, autil::StringView& value,
+                                                                 uint64_t& valueTs,
+                                                                 index::KVMetricsCollector* metricsCollector) const noexcept
+{
+    auto ticket = _lookupCoalescer->Join(key);
+    if (ticket.IsLeader()) {
+        auto status = FL_COAWAIT DoGet(readOptions, key, value, valueTs, metricsCollector);
+        ticket.Complete(status, status == index::KVResultStatus::FOUND ? value : autil::StringView(), valueTs);
+        FL_CORETURN status;
+    }
+#ifdef FUTURE_LITE_USE_COROUTINES
+    co_await ticket.GetFuture().toAwaiter();
+#else
+    ticket.GetFuture().get();
+#endif
+    const auto& flight = ticket.GetFlight();
+    if (flight->status == index::KVResultStatus::FAIL || flight->status == index::KVResultStatus::TIMEOUT) {
+        // leader's failure may come from its own deadline, retry with ours
+        FL_CORETURN FL_COAWAIT DoGet(readOptions, key, value, valueTs, metricsCollector);
+    }
+    if (_kvReportMetrics && metricsCollector) {
+        metricsCollector->IncCoalescedCount();
+    }
+    valueTs = flight->valueTs;
+    if (flight->status == index::KVResultStatus::FOUND) {
+        // leader's value lives in leader's pool, copy it to ours
+        size_t size = flight->value.size();
+        char* buffer = (char*)readOptions->pool->allocate(size);
+        memcpy(buffer, flight->value.data(), size);
+        value = autil::StringView(buffer, size);
+    }
+    FL_CORETURN flight->status;
+}
+
 inline FL_LAZY(index::KVResultStatus) KVReaderImpl::GetFromMemSegment(
     index::keytype_t key, autil::StringView& value, uint64_t& valueTs, size_t shardId, autil::mem_pool::Pool* pool,
     index::KVMetricsCollector* metricsCollector, autil::TimeoutTerminator* timeoutTerminator) const noexcept
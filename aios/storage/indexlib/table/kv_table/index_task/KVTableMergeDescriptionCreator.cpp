@@ -22,8 +22,10 @@ using namespace std;
 namespace indexlibv2::table {
 AUTIL_LOG_SETUP(indexlib.table, KVTableMergeDescriptionCreator);
 
-KVTableMergeDescriptionCreator::KVTableMergeDescriptionCreator(const std::shared_ptr<config::ITabletSchema>& schema)
+KVTableMergeDescriptionCreator::KVTableMergeDescriptionCreator(const std::shared_ptr<config::ITabletSchema>& schema,
+                                                               int64_t externalSortMemoryQuotaInMB)
     : CommonMergeDescriptionCreator(schema)
+    , _externalSortMemoryQuotaInMB(externalSortMemoryQuotaInMB)
 {
 }
 
@@ -68,6 +70,10 @@ KVTableMergeDescriptionCreator::CreateIndexMergeOperationDescription(
         _currentTimestamp = autil::TimeUtility::currentTimeInSeconds();
     }
     opDesc.AddParameter(index::CURRENT_TIME_IN_SECOND, autil::StringUtil::toString(_currentTimestamp));
+    if (_externalSortMemoryQuotaInMB > 0) {
+        opDesc.AddParameter(index::KV_EXTERNAL_SORT_MERGE_MEMORY_QUOTA_MB,
+                            autil::StringUtil::toString(_externalSortMemoryQuotaInMB));
+    }
     return std::make_pair(Status::OK(), opDesc);
 }
 
@@ -23,7 +23,8 @@ namespace indexlibv2::table {
 class KVTableMergeDescriptionCreator : public CommonMergeDescriptionCreator
 {
 public:
-    KVTableMergeDescriptionCreator(const std::shared_ptr<config::ITabletSchema>& schema);
+    KVTableMergeDescriptionCreator(const std::shared_ptr<config::ITabletSchema>& schema,
+                                   int64_t externalSortMemoryQuotaInMB = 0);
     ~KVTableMergeDescriptionCreator();
 
 protected:
@@ -34,6 +35,7 @@ protected:
 
 private:
     int64_t _currentTimestamp = -1;
+    int64_t _externalSortMemoryQuotaInMB = 0;
     friend class KVTableMergeDescriptionCreatorTest;
     AUTIL_LOG_DECLARE();
 };
@@ -33,6 +33,7 @@
 #include "indexlib/framework/index_task/IndexTaskPlan.h"
 #include "indexlib/framework/index_task/IndexTaskResource.h"
 #include "indexlib/framework/index_task/IndexTaskResourceManager.h"
+#include "indexlib/index/kv/Common.h"
 #include "indexlib/table/index_task/IndexTaskConstant.h"
 #include "indexlib/table/index_task/merger/MergeStrategy.h"
 #include "indexlib/table/index_task/merger/MergeStrategyDefine.h"
@@ -88,7 +89,13 @@ KVTableMergePlanCreator::CreateTaskPlan(const framework::IndexTaskContext* taskC
     }
 
     auto indexTaskPlan = std::make_unique<framework::IndexTaskPlan>(_taskName, TASK_TYPE);
-    KVTableMergeDescriptionCreator decriptionCreator(taskContext->GetTabletSchema());
+    int64_t externalSortMemoryQuotaInMB = 0;
+    auto mergeConfig = taskContext->GetMergeConfig();
+    auto memoryQuotaOption = mergeConfig.GetHookOption(index::KV_EXTERNAL_SORT_MERGE_MEMORY_QUOTA_MB);
+    if (memoryQuotaOption) {
+        externalSortMemoryQuotaInMB = std::any_cast<int64_t>(*memoryQuotaOption);
+    }
+    KVTableMergeDescriptionCreator decriptionCreator(taskContext->GetTabletSchema(), externalSortMemoryQuotaInMB);
     auto [status1, operationDescriptions] = decriptionCreator.CreateMergeOperationDescriptions(mergePlan);
     if (!status1.IsOK()) {
         AUTIL_LOG(ERROR, "create merge operation desc failed");
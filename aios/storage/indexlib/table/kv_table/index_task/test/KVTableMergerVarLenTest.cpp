@@ -197,6 +197,26 @@ TEST_F(KVTableMergerVarLenTest, TestMergeDifferentLevel)
     kvIndexFactory->TEST_SetMemoryFactor(2);
 }
 
+TEST_F(KVTableMergerVarLenTest, TestExternalSortMerge)
+{
+    framework::IndexRoot indexRoot(GET_TEMP_DATA_PATH(), GET_TEMP_DATA_PATH());
+    auto tabletOptions = CreateMultiShardOptions();
+    auto memoryQuota = tabletOptions->TEST_GetOfflineConfig().TEST_GetMergeConfig().TEST_GetHookOption(
+        index::KV_EXTERNAL_SORT_MERGE_MEMORY_QUOTA_MB);
+    ASSERT_TRUE(memoryQuota);
+    *memoryQuota = (int64_t)1;
+
+    KVTableTestHelper mainHelper;
+    ASSERT_TRUE(mainHelper.Open(indexRoot, _tabletSchema, std::move(tabletOptions)).IsOK());
+    ASSERT_TRUE(mainHelper.BuildSegment(_docs1).IsOK());
+    ASSERT_TRUE(mainHelper.BuildSegment(_docs2).IsOK());
+    ASSERT_TRUE(mainHelper.BuildSegment(_docs3).IsOK());
+    ASSERT_TRUE(mainHelper.Merge(TableTestHelper::MergeOption::MergeAutoReadOption(true)).IsOK());
+    const auto& version = mainHelper.GetCurrentVersion();
+    ASSERT_TRUE(framework::Version::PUBLIC_VERSION_ID_MASK & version.GetVersionId()) << version.GetVersionId();
+    CheckDoc(mainHelper, {1, 5});
+}
+
 TEST_F(KVTableMergerVarLenTest, TestTTLFilter)
 {
     framework::IndexRoot indexRoot(GET_TEMP_DATA_PATH(), GET_TEMP_DATA_PATH());
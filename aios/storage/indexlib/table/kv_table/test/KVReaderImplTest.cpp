@@ -1,6 +1,8 @@
 
 #include "indexlib/table/kv_table/KVReaderImpl.h"
 
+#include <thread>
+
 #include "FakeSegmentReader.h"
 #include "future_lite/CoroInterface.h"
 #include "future_lite/executors/SimpleExecutor.h"
@@ -49,6 +51,8 @@ private:
     void InnerTestGet(const std::string& offlineValues, uint64_t ttl, uint64_t key, uint64_t searchTs,
                       bool successWithTTL, bool successWithoutTTL, const std::string& expectValue,
                       size_t shardCount = 1, std::shared_ptr<autil::TimeoutTerminator> timeoutTerminator = nullptr);
+    void InnerTestCoalescedGet(KVResultStatus leaderStatus, const std::string& leaderValue,
+                               const std::string& expectValue);
 
 private:
     autil::mem_pool::Pool* _pool = nullptr;
@@ -88,6 +92,56 @@ TEST_F(KVReaderImplTest, TestGet)
     InnerTestGet("2,2,false,1", 1, 2, 0, false, false, "2", 1, timeoutTerminator);
 }
 
+TEST_F(KVReaderImplTest, TestCoalescedGetFollower)
+{
+    // follower takes the value published by the in-flight leader
+    InnerTestCoalescedGet(KVResultStatus::FOUND, "x", "x");
+}
+
+TEST_F(KVReaderImplTest, TestCoalescedGetLeaderFailRetry)
+{
+    // leader failed, follower looks the key up by itself
+    InnerTestCoalescedGet(KVResultStatus::FAIL, "", "2");
+    InnerTestCoalescedGet(KVResultStatus::TIMEOUT, "", "2");
+}
+
+void KVReaderImplTest::InnerTestCoalescedGet(KVResultStatus leaderStatus, const std::string& leaderValue,
+                                             const std::string& expectValue)
+{
+    KVReaderImpl reader(DEFAULT_SCHEMAID);
+    reader._hasTTL = false;
+    reader._lookupCoalescer = std::make_unique<KVLookupCoalescer>();
+    PrepareSegmentReader("2,2,false,1", reader);
+
+    keytype_t key = 2;
+    auto leader = reader._lookupCoalescer->Join(key);
+    ASSERT_TRUE(leader.IsLeader());
+
+    KVReadOptions readOptions;
+    readOptions.timestamp = 0;
+    readOptions.searchCacheType = indexlib::tsc_no_cache;
+    readOptions.pool = _pool;
+    KVResultStatus status = KVResultStatus::NOT_FOUND;
+    std::string followerValue;
+    std::thread follower([&]() {
+        future_lite::executors::SimpleExecutor ex(1);
+        autil::StringView value;
+        status = future_lite::interface::syncAwait(reader.InnerGet(&readOptions, key, value), &ex);
+        followerValue = value.to_string();
+    });
+    // coalesced count is raised only after the follower is registered on the flight
+    while (reader._lookupCoalescer->GetCoalescedCount() == 0) {
+        std::this_thread::yield();
+    }
+    leader.Complete(leaderStatus, autil::StringView(leaderValue), 1);
+    follower.join();
+
+    ASSERT_EQ(KVResultStatus::FOUND, status);
+    ASSERT_EQ(expectValue, followerValue);
+    ASSERT_EQ(2, reader._lookupCoalescer->GetLookupCount());
+    ASSERT_EQ(1, reader._lookupCoalescer->GetCoalescedCount());
+}
+
 void KVReaderImplTest::InnerTestGet(const string& offlineValues, uint64_t ttl, uint64_t key, uint64_t searchTs,
                                     bool successWithTTL, bool successWithoutTTL, const string& expectValue,
                                     size_t shardCount, std::shared_ptr<autil::TimeoutTerminator> timeoutTerminator)
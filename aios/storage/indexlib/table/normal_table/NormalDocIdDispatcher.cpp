@@ -50,6 +50,20 @@ void NormalDocIdDispatcher::DispatchDocId(const std::shared_ptr<indexlibv2::docu
     }
 }
 
+void NormalDocIdDispatcher::PrefetchDocIds(const std::vector<std::string>& pkStrs)
+{
+    // parallel lookup on build already spreads each lookup over segments
+    if (!_pkReader || pkStrs.empty() || _pkReader->GetBuildExecutor()) {
+        return;
+    }
+    std::vector<docid_t> docIds;
+    _pkReader->BatchLookup(pkStrs, &docIds);
+    _prefetchedDocIds.reserve(pkStrs.size());
+    for (size_t i = 0; i < pkStrs.size(); ++i) {
+        _prefetchedDocIds.emplace(pkStrs[i], docIds[i]);
+    }
+}
+
 void NormalDocIdDispatcher::ProcessAddDocument(const std::shared_ptr<indexlibv2::document::NormalDocument>& doc)
 {
     const std::string& pkStr = doc->GetPrimaryKey();
@@ -99,6 +113,10 @@ docid_t NormalDocIdDispatcher::Lookup(const std::string& pkStr) const
     if (_pkToDocIdMap.find(pkStr) != _pkToDocIdMap.end()) {
         return _pkToDocIdMap.at(pkStr);
     }
+    auto iter = _prefetchedDocIds.find(pkStr);
+    if (iter != _prefetchedDocIds.end()) {
+        return iter->second;
+    }
     return _pkReader->Lookup(pkStr, _pkReader->GetBuildExecutor());
 }
 
@@ -15,6 +15,11 @@
  */
 #pragma once
 
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "autil/Log.h"
 #include "autil/NoCopyable.h"
 #include "indexlib/base/Types.h"
@@ -35,6 +40,8 @@ public:
                           docid_t buildingSegmentBaseDocId, docid_t currentSegmentDocCount);
     virtual ~NormalDocIdDispatcher() {};
     void DispatchDocId(const std::shared_ptr<indexlibv2::document::NormalDocument>& doc);
+    // resolve pks of a whole batch against the pk reader in one BatchLookup, DispatchDocId then uses the result
+    void PrefetchDocIds(const std::vector<std::string>& pkStrs);
 
 protected:
     void ProcessAddDocument(const std::shared_ptr<indexlibv2::document::NormalDocument>& doc);
@@ -53,6 +60,7 @@ private:
     docid_t _currentSegmentDocCount;
     std::map<std::string, docid_t> _pkToDocIdMap;
     std::map<docid_t, std::string> _docIdToPkMap;
+    std::unordered_map<std::string, docid_t> _prefetchedDocIds;
 
 private:
     AUTIL_LOG_DECLARE();
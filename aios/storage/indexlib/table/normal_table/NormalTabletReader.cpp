@@ -15,6 +15,8 @@
  */
 #include "indexlib/table/normal_table/NormalTabletReader.h"
 
+#include <algorithm>
+
 #include "indexlib/config/MutableJson.h"
 #include "indexlib/config/TabletSchema.h"
 #include "indexlib/framework/ITabletReader.h"
@@ -428,6 +430,63 @@ bool NormalTabletReader::GetSortedDocIdRanges(
     return _sortedDocIdRangeSearcher->GetSortedDocIdRanges(dimensions, rangeLimits, resultRanges);
 }
 
+bool NormalTabletReader::GetZoneMapDocIdRanges(
+    const std::vector<std::shared_ptr<indexlib::table::DimensionDescription>>& dimensions,
+    const DocIdRange& rangeLimits, DocIdRangeVector& resultRanges) const
+{
+    bool pruned = false;
+    DocIdRangeVector candidates {rangeLimits};
+    for (const auto& dimension : dimensions) {
+        if (!dimension || candidates.empty()) {
+            continue;
+        }
+        auto attrReader = GetAttributeReader(dimension->name);
+        if (!attrReader) {
+            continue;
+        }
+        std::vector<indexlib::table::DimensionDescription::Range> ranges = dimension->ranges;
+        for (const auto& value : dimension->values) {
+            ranges.emplace_back(value, value);
+        }
+        if (ranges.empty()) {
+            continue;
+        }
+        bool hasZoneMap = true;
+        DocIdRangeVector dimensionRanges;
+        for (const auto& candidate : candidates) {
+            DocIdRangeVector pieceRanges;
+            for (const auto& range : ranges) {
+                if (!attrReader->GetZoneMapDocIdRanges(range, candidate, pieceRanges)) {
+                    hasZoneMap = false;
+                    break;
+                }
+            }
+            if (!hasZoneMap) {
+                break;
+            }
+            // ranges of different values may overlap, union them inside the candidate
+            std::sort(pieceRanges.begin(), pieceRanges.end());
+            for (const auto& pieceRange : pieceRanges) {
+                if (!dimensionRanges.empty() && dimensionRanges.back().second >= pieceRange.first) {
+                    dimensionRanges.back().second = std::max(dimensionRanges.back().second, pieceRange.second);
+                } else {
+                    dimensionRanges.push_back(pieceRange);
+                }
+            }
+        }
+        if (!hasZoneMap) {
+            continue;
+        }
+        candidates.swap(dimensionRanges);
+        pruned = true;
+    }
+    if (!pruned) {
+        return false;
+    }
+    resultRanges = std::move(candidates);
+    return true;
+}
+
 bool NormalTabletReader::GetPartedDocIdRanges(const DocIdRangeVector& rangeHint, size_t totalWayCount, size_t wayIdx,
                                               DocIdRangeVector& ranges) const
 {
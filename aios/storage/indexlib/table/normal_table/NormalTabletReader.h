@@ -86,6 +86,10 @@ public:
 
     bool GetSortedDocIdRanges(const std::vector<std::shared_ptr<indexlib::table::DimensionDescription>>& dimensions,
                               const DocIdRange& rangeLimits, DocIdRangeVector& resultRanges) const;
+    // conjunction of dimensions, each dimension is checked against the attribute zone maps, returns false
+    // when no dimension could prune rangeLimits
+    bool GetZoneMapDocIdRanges(const std::vector<std::shared_ptr<indexlib::table::DimensionDescription>>& dimensions,
+                               const DocIdRange& rangeLimits, DocIdRangeVector& resultRanges) const;
     bool GetPartedDocIdRanges(const DocIdRangeVector& rangeHint, size_t totalWayCount, size_t wayIdx,
                               DocIdRangeVector& ranges) const;
     bool GetPartedDocIdRanges(const DocIdRangeVector& rangeHint, size_t totalWayCount,
@@ -70,6 +70,11 @@ public:
     {
         return _impl->GetSortedDocIdRanges(dimensions, rangeLimits, resultRanges);
     }
+    bool GetZoneMapDocIdRanges(const std::vector<std::shared_ptr<indexlib::table::DimensionDescription>>& dimensions,
+                               const DocIdRange& rangeLimits, DocIdRangeVector& resultRanges) const
+    {
+        return _impl->GetZoneMapDocIdRanges(dimensions, rangeLimits, resultRanges);
+    }
 
     bool GetPartedDocIdRanges(const DocIdRangeVector& rangeHint, size_t totalWayCount, size_t wayIdx,
                               DocIdRangeVector& ranges) const
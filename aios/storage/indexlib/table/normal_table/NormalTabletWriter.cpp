@@ -19,6 +19,7 @@
 
 #include "autil/TimeUtility.h"
 #include "future_lite/Future.h"
+#include "indexlib/config/BuildConfig.h"
 #include "indexlib/config/BuildOptionConfig.h"
 #include "indexlib/config/TabletSchema.h"
 #include "indexlib/document/DocumentIterator.h"
@@ -121,13 +122,20 @@ void NormalTabletWriter::DispatchDocIds(document::IDocumentBatch* batch)
     auto docIdDiapatcher = std::make_unique<indexlib::table::NormalDocIdDispatcher>(
         _schema->GetTableName(), _pkReader, _buildingSegmentBaseDocId,
         /*currentSegmentDocCount=*/_normalBuildingSegment->GetSegmentInfo()->docCount);
+    std::vector<std::shared_ptr<document::NormalDocument>> normalDocs;
+    std::vector<std::string> pkStrs;
     auto iter = indexlibv2::document::DocumentIterator<indexlibv2::document::IDocument>::Create(batch);
     while (iter->HasNext()) {
         auto normalDoc = std::dynamic_pointer_cast<document::NormalDocument>(iter->Next());
         if (normalDoc) {
-            docIdDiapatcher->DispatchDocId(normalDoc);
+            pkStrs.push_back(normalDoc->GetPrimaryKey());
+            normalDocs.push_back(std::move(normalDoc));
         }
     }
+    docIdDiapatcher->PrefetchDocIds(pkStrs);
+    for (const auto& normalDoc : normalDocs) {
+        docIdDiapatcher->DispatchDocId(normalDoc);
+    }
 }
 
 Status NormalTabletWriter::PrepareBuiltinIndex(const std::shared_ptr<framework::TabletData>& tabletData)
@@ -375,7 +383,8 @@ std::unique_ptr<SegmentDumper> NormalTabletWriter::CreateSegmentDumper()
     _buildingSegment->Seal();
     return std::make_unique<SegmentDumper>(_tabletData->GetTabletName(), _buildingSegment,
                                            GetBuildingSegmentDumpExpandSize(),
-                                           _buildResource.metricsManager->GetMetricsReporter());
+                                           _buildResource.metricsManager->GetMetricsReporter(),
+                                           _options->GetBuildConfig().GetDumpThreadCount());
 }
 
 } // namespace indexlibv2::table
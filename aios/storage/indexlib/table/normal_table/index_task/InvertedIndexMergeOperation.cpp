@@ -181,6 +181,13 @@ Status InvertedIndexMergeOperation::GetAllParameters(
         AUTIL_LOG(ERROR, "%s", status.ToString().c_str());
         return status;
     }
+    const auto* termMergeThreadCount =
+        std::any_cast<uint32_t>(mergeConfig.GetHookOption(index::TERM_MERGE_THREAD_COUNT));
+    if (termMergeThreadCount) {
+        params[index::TERM_MERGE_THREAD_COUNT] = *termMergeThreadCount;
+    }
+    params[index::MERGE_METRIC_PROVIDER] = context.GetMetricProvider();
+
     auto truncateOptionConfig = std::make_shared<indexlibv2::config::TruncateOptionConfig>(*truncateStrategy);
     truncateOptionConfig->Init({_indexConfig}, truncateProfileConfigs);
     params[TRUNCATE_OPTION_CONFIG] = truncateOptionConfig;
@@ -0,0 +1,125 @@
+#include <map>
+#include <memory>
+#include <string>
+
+#include "autil/StringUtil.h"
+#include "autil/legacy/jsonizable.h"
+#include "indexlib/config/TabletOptions.h"
+#include "indexlib/file_system/fslib/FslibWrapper.h"
+#include "indexlib/framework/IndexRoot.h"
+#include "indexlib/table/normal_table/test/NormalTableTestHelper.h"
+#include "unittest/unittest.h"
+
+namespace indexlibv2::table {
+
+// merging term ranges with several threads must write the same files as the sequential merge
+class NormalTableParallelTermMergeTest : public TESTBASE
+{
+public:
+    NormalTableParallelTermMergeTest() = default;
+    ~NormalTableParallelTermMergeTest() = default;
+
+public:
+    void BuildAndMerge(uint32_t termMergeThreadCount, std::map<std::string, std::string>& indexFiles);
+
+private:
+    std::shared_ptr<config::TabletOptions> CreateTabletOptions(uint32_t termMergeThreadCount) const;
+    // terms are spread over segments, enough of them to cut several ranges per thread
+    static std::string MakeDocs(int64_t begin, int64_t end);
+
+private:
+    static constexpr int64_t SEGMENT_DOC_COUNT = 8000;
+    static constexpr int64_t DISTINCT_TERM_COUNT = 20000;
+};
+
+std::shared_ptr<config::TabletOptions>
+NormalTableParallelTermMergeTest::CreateTabletOptions(uint32_t termMergeThreadCount) const
+{
+    std::string jsonStr = R"( {
+    "online_index_config": {
+        "build_config": {
+            "sharding_column_num" : 1,
+            "level_num" : 3
+        }
+    },
+    "offline_index_config": {
+        "merge_config": {
+            "inverted_index_term_merge_thread_count" : )" +
+                          autil::StringUtil::toString(termMergeThreadCount) + R"(
+        }
+    }
+    } )";
+    auto tabletOptions = std::make_shared<config::TabletOptions>();
+    FromJsonString(*tabletOptions, jsonStr);
+    tabletOptions->SetIsOnline(true);
+    tabletOptions->SetIsLeader(true);
+    tabletOptions->SetFlushLocal(false);
+    tabletOptions->SetFlushRemote(true);
+    tabletOptions->TEST_GetOnlineConfig().TEST_GetBuildConfig().TEST_SetBuildingMemoryLimit(64 * 1024 * 1024);
+    return tabletOptions;
+}
+
+std::string NormalTableParallelTermMergeTest::MakeDocs(int64_t begin, int64_t end)
+{
+    std::string docs;
+    for (int64_t pk = begin; pk < end; ++pk) {
+        docs += "cmd=add,pk=" + autil::StringUtil::toString(pk) + ",title=t" +
+                autil::StringUtil::toString(pk * 7919 % DISTINCT_TERM_COUNT) + ";";
+    }
+    return docs;
+}
+
+void NormalTableParallelTermMergeTest::BuildAndMerge(uint32_t termMergeThreadCount,
+                                                     std::map<std::string, std::string>& indexFiles)
+{
+    std::string rootPath = GET_TEMP_DATA_PATH() + "/thread_" + autil::StringUtil::toString(termMergeThreadCount);
+    framework::IndexRoot indexRoot(rootPath, rootPath);
+    auto schema = NormalTableTestHelper::MakeSchema("pk:uint64;title:string",                 // fields
+                                                    "pk:primarykey64:pk;title:string:title", // indexes
+                                                    "pk",                                    // attributes
+                                                    "");                                     // summarys
+    ASSERT_TRUE(schema);
+    NormalTableTestHelper helper;
+    ASSERT_TRUE(helper.Open(indexRoot, schema, CreateTabletOptions(termMergeThreadCount)).IsOK());
+    ASSERT_TRUE(helper.BuildSegment(MakeDocs(0, SEGMENT_DOC_COUNT)).IsOK());
+    ASSERT_TRUE(helper.BuildSegment(MakeDocs(SEGMENT_DOC_COUNT, 2 * SEGMENT_DOC_COUNT)).IsOK());
+    // deletions move doc ids of the merged segment
+    std::string docs = MakeDocs(2 * SEGMENT_DOC_COUNT, 3 * SEGMENT_DOC_COUNT);
+    for (int64_t pk = 0; pk < 2 * SEGMENT_DOC_COUNT; pk += 3) {
+        docs += "cmd=delete,pk=" + autil::StringUtil::toString(pk) + ";";
+    }
+    ASSERT_TRUE(helper.BuildSegment(docs).IsOK());
+    ASSERT_TRUE(helper.Merge(TableTestHelper::MergeOption::OptimizeMergeOption()).IsOK());
+
+    fslib::FileList fileList;
+    ASSERT_TRUE(indexlib::file_system::FslibWrapper::ListDirRecursive(rootPath, fileList).OK());
+    for (const auto& file : fileList) {
+        auto pos = file.find("segment_");
+        if (pos == std::string::npos ||
+            (!autil::StringUtil::endsWith(file, "index/title/posting") &&
+             !autil::StringUtil::endsWith(file, "index/title/dictionary"))) {
+            continue;
+        }
+        std::string content;
+        ASSERT_TRUE(indexlib::file_system::FslibWrapper::Load(rootPath + "/" + file, content).OK());
+        indexFiles[file.substr(pos)] = content;
+    }
+}
+
+TEST_F(NormalTableParallelTermMergeTest, TestSameAsSequentialMerge)
+{
+    std::map<std::string, std::string> sequentialFiles;
+    ASSERT_NO_FATAL_FAILURE(BuildAndMerge(1, sequentialFiles));
+    std::map<std::string, std::string> parallelFiles;
+    ASSERT_NO_FATAL_FAILURE(BuildAndMerge(4, parallelFiles));
+    ASSERT_FALSE(sequentialFiles.empty());
+    ASSERT_EQ(sequentialFiles.size(), parallelFiles.size());
+    for (const auto& [path, content] : sequentialFiles) {
+        auto iter = parallelFiles.find(path);
+        ASSERT_TRUE(iter != parallelFiles.end()) << path;
+        ASSERT_EQ(content.size(), iter->second.size()) << path;
+        ASSERT_TRUE(content == iter->second) << path;
+    }
+}
+
+} // namespace indexlibv2::table
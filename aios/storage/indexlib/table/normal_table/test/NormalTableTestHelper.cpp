@@ -0,0 +1,110 @@
+#include "indexlib/table/normal_table/test/NormalTableTestHelper.h"
+
+#include "indexlib/document/DocumentBatch.h"
+#include "indexlib/document/DocumentIterator.h"
+#include "indexlib/document/ExtendDocument.h"
+#include "indexlib/document/IDocumentParser.h"
+#include "indexlib/document/normal/NormalDocumentFactory.h"
+#include "indexlib/document/raw_document/test/RawDocumentMaker.h"
+#include "indexlib/framework/Locator.h"
+#include "indexlib/table/normal_table/test/NormalTabletSchemaMaker.h"
+
+namespace indexlibv2::table {
+AUTIL_LOG_SETUP(indexlib.table, NormalTableTestHelper);
+
+std::shared_ptr<TableTestHelper> NormalTableTestHelper::CreateMergeHelper()
+{
+    std::shared_ptr<TableTestHelper> ptr(new NormalTableTestHelper);
+    return ptr;
+}
+
+bool NormalTableTestHelper::DoQuery(std::string indexType, std::string indexName, std::string queryStr,
+                                    std::string expectValue)
+{
+    AUTIL_LOG(ERROR, "query is not supported by normal table test helper, index [%s:%s]", indexType.c_str(),
+              indexName.c_str());
+    return false;
+}
+
+Status NormalTableTestHelper::DoBuild(std::string docs, bool oneBatch)
+{
+    assert(_schema->GetTableType() == "normal");
+    auto batchVec = MakeBatchVec(docs, /*locator*/ nullptr);
+    if (batchVec.empty()) {
+        return Status::InternalError("make document batch from %s failed", docs.c_str());
+    }
+    if (!oneBatch) {
+        for (const auto& docBatch : batchVec) {
+            RETURN_IF_STATUS_ERROR(BuildBatch(docBatch), "build docs failed");
+        }
+        return Status::OK();
+    }
+    auto docBatch = std::make_shared<document::DocumentBatch>();
+    for (const auto& singleDocBatch : batchVec) {
+        auto iter = document::DocumentIterator<document::IDocument>::Create(singleDocBatch.get());
+        while (iter->HasNext()) {
+            docBatch->AddDocument(iter->Next());
+        }
+    }
+    return BuildBatch(docBatch);
+}
+
+Status NormalTableTestHelper::DoBuild(const std::string& docStr, const framework::Locator& locator)
+{
+    assert(_schema->GetTableType() == "normal");
+    auto batchVec = MakeBatchVec(docStr, &locator);
+    if (batchVec.empty()) {
+        return Status::InternalError("make document batch from %s failed", docStr.c_str());
+    }
+    for (const auto& docBatch : batchVec) {
+        RETURN_IF_STATUS_ERROR(BuildBatch(docBatch), "build docs failed");
+    }
+    return Status::OK();
+}
+
+Status NormalTableTestHelper::BuildBatch(const std::shared_ptr<document::IDocumentBatch>& docBatch)
+{
+    auto status = GetITablet()->Build(docBatch);
+    if (status.IsUninitialize()) {
+        status = GetITablet()->Build(docBatch);
+    }
+    return status;
+}
+
+std::vector<std::shared_ptr<document::IDocumentBatch>>
+NormalTableTestHelper::MakeBatchVec(const std::string& docs, const framework::Locator* locator)
+{
+    document::NormalDocumentFactory factory;
+    auto parser = factory.CreateDocumentParser(_schema, nullptr);
+    if (!parser) {
+        AUTIL_LOG(ERROR, "create document parser failed for table [%s]", _schema->GetTableName().c_str());
+        return {};
+    }
+    std::vector<std::shared_ptr<document::IDocumentBatch>> batchVec;
+    for (const auto& rawDoc : document::RawDocumentMaker::MakeBatch(docs)) {
+        auto extendDoc = factory.CreateExtendDocument();
+        extendDoc->setRawDocument(rawDoc);
+        auto [status, docBatch] = parser->Parse(*extendDoc);
+        if (!status.IsOK() || !docBatch) {
+            AUTIL_LOG(ERROR, "parse failed, error: %s, raw doc: %s", status.ToString().c_str(),
+                      rawDoc->toString().c_str());
+            return {};
+        }
+        auto iter = document::DocumentIterator<document::IDocument>::Create(docBatch.get());
+        while (iter->HasNext()) {
+            iter->Next()->SetLocator(locator ? *locator : rawDoc->getLocator());
+        }
+        batchVec.emplace_back(std::move(docBatch));
+    }
+    return batchVec;
+}
+
+std::shared_ptr<config::ITabletSchema> NormalTableTestHelper::MakeSchema(const std::string& fieldNames,
+                                                                         const std::string& indexNames,
+                                                                         const std::string& attributeNames,
+                                                                         const std::string& summaryNames)
+{
+    return NormalTabletSchemaMaker::Make(fieldNames, indexNames, attributeNames, summaryNames);
+}
+
+} // namespace indexlibv2::table
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "indexlib/table/test/TableTestHelper.h"
+
+namespace indexlibv2::framework {
+class Locator;
+}
+namespace indexlibv2::document {
+class IDocumentBatch;
+}
+
+namespace indexlibv2 { namespace table {
+class NormalTableTestHelper : public TableTestHelper
+{
+public:
+    NormalTableTestHelper(bool autoCleanIndex = true, bool needDeploy = true)
+        : TableTestHelper(autoCleanIndex, needDeploy)
+    {
+    }
+    ~NormalTableTestHelper() = default;
+
+    Status DoBuild(std::string docs, bool oneBatch = false) override;
+    Status DoBuild(const std::string& docStr, const framework::Locator& locator) override;
+
+    // normal tables are queried through their readers, e.g. by sql scan tests
+    bool DoQuery(std::string indexType, std::string indexName, std::string queryStr, std::string expectValue) override;
+
+public:
+    // see NormalTabletSchemaMaker for formats
+    static std::shared_ptr<config::ITabletSchema> MakeSchema(const std::string& fieldNames,
+                                                             const std::string& indexNames,
+                                                             const std::string& attributeNames,
+                                                             const std::string& summaryNames);
+
+protected:
+    std::shared_ptr<TableTestHelper> CreateMergeHelper() override;
+
+private:
+    Status BuildBatch(const std::shared_ptr<document::IDocumentBatch>& docBatch);
+    std::vector<std::shared_ptr<document::IDocumentBatch>> MakeBatchVec(const std::string& docs,
+                                                                        const framework::Locator* locator);
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+}} // namespace indexlibv2::table
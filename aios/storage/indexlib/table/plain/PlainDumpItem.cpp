@@ -44,4 +44,6 @@ Status PlainDumpItem::Dump() noexcept
     return status;
 }
 
+std::string PlainDumpItem::GetName() const { return _buildingIndex->GetIndexName(); }
+
 } // namespace indexlibv2::plain
@@ -50,6 +50,8 @@ public:
 
     Status Dump() noexcept override;
     bool IsDumped() const override { return _dumped; }
+    bool CanDumpConcurrently() const override { return true; }
+    std::string GetName() const override;
 
 private:
     std::shared_ptr<autil::mem_pool::PoolBase> _dumpPool;
@@ -179,7 +179,6 @@ std::pair<Status, std::vector<std::shared_ptr<framework::SegmentDumpItem>>> Plai
     RETURN2_IF_STATUS_ERROR(st, std::vector<std::shared_ptr<framework::SegmentDumpItem>> {},
                             "create dump params failed");
     std::vector<std::shared_ptr<framework::SegmentDumpItem>> segmentDumpItems;
-    std::shared_ptr<autil::mem_pool::PoolBase> dumpPool = std::make_shared<indexlib::util::SimplePool>();
     auto indexFactoryCreator = index::IndexFactoryCreator::GetInstance();
     for (const auto& [indexMapKey, indexerAndMemUpdater] : _indexMap) {
         auto& indexType = indexMapKey.first;
@@ -188,6 +187,8 @@ std::pair<Status, std::vector<std::shared_ptr<framework::SegmentDumpItem>>> Plai
         assert(status.IsOK());
         auto indexDirectory = GetSegmentDirectory()->MakeDirectory(indexFactory->GetIndexPath());
         if (memIndexer->IsDirty()) {
+            // index dump items may run concurrently, SimplePool is not thread safe
+            std::shared_ptr<autil::mem_pool::PoolBase> dumpPool = std::make_shared<indexlib::util::SimplePool>();
             auto dumpItem = std::make_shared<PlainDumpItem>(dumpPool, memIndexer, indexDirectory, dumpParams);
             segmentDumpItems.push_back(dumpItem);
         }
@@ -23,27 +23,21 @@ class EventTags;
 
 #define IE_RAW_DOC_TRACE(rawDoc, msg)                                                                                  \
     do {                                                                                                               \
-        if (rawDoc) {                                                                                                  \
-            std::string traceId = rawDoc->GetTraceId();                                                                \
-            if (!traceId.empty()) {                                                                                    \
-                beeper::EventTags traceTags;                                                                           \
-                traceTags.AddTag("pk", traceId);                                                                       \
-                BEEPER_REPORT(IE_DOC_TRACER_COLLECTOR_NAME, msg, traceTags);                                           \
-            }                                                                                                          \
+        if (rawDoc && rawDoc->NeedTrace()) {                                                                           \
+            beeper::EventTags traceTags;                                                                               \
+            traceTags.AddTag("pk", rawDoc->GetTraceId());                                                              \
+            BEEPER_REPORT(IE_DOC_TRACER_COLLECTOR_NAME, msg, traceTags);                                               \
         }                                                                                                              \
     } while (0)
 
 #define IE_RAW_DOC_FORMAT_TRACE(rawDoc, format, args...)                                                               \
     do {                                                                                                               \
-        if (rawDoc) {                                                                                                  \
-            std::string traceId = rawDoc->GetTraceId();                                                                \
-            if (!traceId.empty()) {                                                                                    \
-                beeper::EventTags traceTags;                                                                           \
-                traceTags.AddTag("pk", traceId);                                                                       \
-                char msg[1024];                                                                                        \
-                sprintf(msg, format, args);                                                                            \
-                BEEPER_REPORT(IE_DOC_TRACER_COLLECTOR_NAME, msg, traceTags);                                           \
-            }                                                                                                          \
+        if (rawDoc && rawDoc->NeedTrace()) {                                                                           \
+            beeper::EventTags traceTags;                                                                               \
+            traceTags.AddTag("pk", rawDoc->GetTraceId());                                                              \
+            char msg[1024];                                                                                            \
+            sprintf(msg, format, args);                                                                                \
+            BEEPER_REPORT(IE_DOC_TRACER_COLLECTOR_NAME, msg, traceTags);                                               \
         }                                                                                                              \
     } while (0)
 
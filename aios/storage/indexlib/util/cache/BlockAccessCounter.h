@@ -27,6 +27,9 @@ struct BlockAccessCounter {
     int64_t blockCacheReadLatency = 0;
     int64_t blockCacheIOCount = 0;
     int64_t blockCacheIODataSize = 0;
+    // compressed file blocks touched by batch reads, and how many of them had to be loaded and decompressed
+    int64_t compressBlockAccessCount = 0;
+    int64_t compressBlockLoadCount = 0;
     std::unique_ptr<HistogramCounter> histCounter = nullptr;
 
     BlockAccessCounter(size_t histogramBucketSize = 0) noexcept
@@ -35,6 +38,8 @@ struct BlockAccessCounter {
         , blockCacheReadLatency(0)
         , blockCacheIOCount(0)
         , blockCacheIODataSize(0)
+        , compressBlockAccessCount(0)
+        , compressBlockLoadCount(0)
     {
         if (histogramBucketSize) {
             histCounter = std::make_unique<HistogramCounter>(histogramBucketSize);
@@ -47,6 +52,8 @@ struct BlockAccessCounter {
         , blockCacheReadLatency(other.blockCacheReadLatency)
         , blockCacheIOCount(other.blockCacheIOCount)
         , blockCacheIODataSize(other.blockCacheIODataSize)
+        , compressBlockAccessCount(other.compressBlockAccessCount)
+        , compressBlockLoadCount(other.compressBlockLoadCount)
     {
         if (other.histCounter) {
             histCounter = std::make_unique<HistogramCounter>(*(other.histCounter));
@@ -59,6 +66,8 @@ struct BlockAccessCounter {
         , blockCacheReadLatency(other.blockCacheReadLatency)
         , blockCacheIOCount(other.blockCacheIOCount)
         , blockCacheIODataSize(other.blockCacheIODataSize)
+        , compressBlockAccessCount(other.compressBlockAccessCount)
+        , compressBlockLoadCount(other.compressBlockLoadCount)
     {
         if (other.histCounter) {
             histCounter.reset(other.histCounter.release());
@@ -72,6 +81,8 @@ struct BlockAccessCounter {
         blockCacheReadLatency = other.blockCacheReadLatency;
         blockCacheIOCount = other.blockCacheIOCount;
         blockCacheIODataSize = other.blockCacheIODataSize;
+        compressBlockAccessCount = other.compressBlockAccessCount;
+        compressBlockLoadCount = other.compressBlockLoadCount;
         if (other.histCounter) {
             histCounter.reset(new HistogramCounter(*other.histCounter));
         } else {
@@ -89,6 +100,8 @@ struct BlockAccessCounter {
         blockCacheReadLatency = 0;
         blockCacheIOCount = 0;
         blockCacheIODataSize = 0;
+        compressBlockAccessCount = 0;
+        compressBlockLoadCount = 0;
         if (histCounter) {
             histCounter->Reset();
         }
@@ -101,6 +114,8 @@ struct BlockAccessCounter {
         blockCacheReadLatency += other.blockCacheReadLatency;
         blockCacheIOCount += other.blockCacheIOCount;
         blockCacheIODataSize += other.blockCacheIODataSize;
+        compressBlockAccessCount += other.compressBlockAccessCount;
+        compressBlockLoadCount += other.compressBlockLoadCount;
         if (histCounter && other.histCounter) {
             *histCounter += *other.histCounter;
         }
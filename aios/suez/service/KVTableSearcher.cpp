@@ -56,6 +56,8 @@ public:
         REGISTER_GAUGE_MUTABLE_METRIC(_docsCount, "KVTableSearcher.docsCount");
         REGISTER_GAUGE_MUTABLE_METRIC(_failedDocsCount, "KVTableSearcher.failedDocsCount");
         REGISTER_GAUGE_MUTABLE_METRIC(_notFoundDocsCount, "KVTableSearcher.notFoundDocsCount");
+        REGISTER_GAUGE_MUTABLE_METRIC(_coalescedCount, "KVTableSearcher.coalescedCount");
+        REGISTER_GAUGE_MUTABLE_METRIC(_coalescedRatio, "KVTableSearcher.coalescedRatio");
 
         REGISTER_LATENCY_MUTABLE_METRIC(_convertTime, "KVTableSearcher.convertTime");
         REGISTER_LATENCY_MUTABLE_METRIC(_lookupTime, "KVTableSearcher.lookupTime");
@@ -72,6 +74,11 @@ public:
         REPORT_MUTABLE_METRIC(_docsCount, kvMetrics->docsCount);
         REPORT_MUTABLE_METRIC(_failedDocsCount, kvMetrics->failedDocsCount);
         REPORT_MUTABLE_METRIC(_notFoundDocsCount, kvMetrics->notFoundDocsCount);
+        REPORT_MUTABLE_METRIC(_coalescedCount, kvMetrics->indexCollector.GetCoalescedCount());
+        if (kvMetrics->docsCount > 0) {
+            REPORT_MUTABLE_METRIC(_coalescedRatio,
+                                  (double)kvMetrics->indexCollector.GetCoalescedCount() / kvMetrics->docsCount);
+        }
 
         REPORT_MUTABLE_METRIC(_convertTime, kvMetrics->convertTime / 1000.0f);
         REPORT_MUTABLE_METRIC(_lookupTime, kvMetrics->lookupTime / 1000.0f);
@@ -86,6 +93,8 @@ private:
     MutableMetric *_docsCount = nullptr;
     MutableMetric *_failedDocsCount = nullptr;
     MutableMetric *_notFoundDocsCount = nullptr;
+    MutableMetric *_coalescedCount = nullptr;
+    MutableMetric *_coalescedRatio = nullptr;
     MutableMetric *_convertTime = nullptr;
     MutableMetric *_lookupTime = nullptr;
 };
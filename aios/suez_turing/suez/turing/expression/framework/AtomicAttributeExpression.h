@@ -17,14 +17,19 @@
 
 #include <assert.h>
 #include <stdint.h>
+#include <algorithm>
 #include <string>
+#include <vector>
 
+#include "autil/MultiValueType.h"
 #include "autil/mem_pool/PoolBase.h"
+#include "future_lite/coro/Lazy.h"
 #include "indexlib/index/normal/attribute/accessor/attribute_iterator_typed.h"
 #include "indexlib/indexlib.h"
 #include "indexlib/misc/common.h"
 #include "matchdoc/MatchDoc.h"
 #include "suez/turing/expression/framework/AttributeExpression.h"
+#include "suez/turing/expression/framework/ColumnBuffer.h"
 #include "suez/turing/expression/framework/DocIdAccessor.h"
 
 namespace suez {
@@ -49,17 +54,25 @@ public:
     bool evaluate(matchdoc::MatchDoc matchDoc) override;
     T evaluateAndReturn(matchdoc::MatchDoc matchDoc) override;
     bool batchEvaluate(matchdoc::MatchDoc *matchDocs, uint32_t matchDocCount) override;
+    bool evaluateColumn(matchdoc::MatchDoc *matchDocs, uint32_t matchDocCount, T *values) override;
     bool operator==(const AttributeExpression *checkExpr) const override;
     ExpressionType getExpressionType() const override { return ET_ATOMIC; }
+    void setBatchSeekThreshold(uint32_t threshold) override { _batchSeekThreshold = threshold; }
 
 public:
     // for test
     Iterator *getAttributeIterator() const { return _iterator; }
 
+private:
+    bool tryBatchSeek(matchdoc::MatchDoc *matchDocs, uint32_t matchDocCount, T *values);
+
 private:
     const std::string _attributeName;
     Iterator *_iterator;
     DocIdAccessor _docIdAccessor;
+    uint32_t _batchSeekThreshold = 0;
+    std::vector<docid_t> _docIds;
+    ColumnBuffer<T> _column;
 };
 
 template <typename T, typename DocIdAccessor, typename AttrIterator>
@@ -92,6 +105,15 @@ inline bool AtomicAttributeExpression<T, DocIdAccessor, AttrIterator>::batchEval
     if (this->isEvaluated()) {
         return true;
     }
+    if (_batchSeekThreshold > 0 && matchDocCount >= _batchSeekThreshold) {
+        T *values = _column.reserve(matchDocCount);
+        if (tryBatchSeek(matchDocs, matchDocCount, values)) {
+            for (uint32_t i = 0; i < matchDocCount; ++i) {
+                this->storeValue(matchDocs[i], values[i]);
+            }
+            return true;
+        }
+    }
     for (uint32_t i = 0; i < matchDocCount; ++i) {
         matchdoc::MatchDoc matchDoc = matchDocs[i];
         docid_t docId = _docIdAccessor.getDocId(matchDoc);
@@ -102,6 +124,58 @@ inline bool AtomicAttributeExpression<T, DocIdAccessor, AttrIterator>::batchEval
     return true;
 }
 
+template <typename T, typename DocIdAccessor, typename AttrIterator>
+inline bool AtomicAttributeExpression<T, DocIdAccessor, AttrIterator>::evaluateColumn(matchdoc::MatchDoc *matchDocs,
+                                                                                      uint32_t matchDocCount,
+                                                                                      T *values) {
+    if (this->isEvaluated()) {
+        for (uint32_t i = 0; i < matchDocCount; ++i) {
+            values[i] = this->_ref->get(matchDocs[i]);
+        }
+        return true;
+    }
+    if (_batchSeekThreshold > 0 && matchDocCount >= _batchSeekThreshold &&
+        tryBatchSeek(matchDocs, matchDocCount, values)) {
+        return true;
+    }
+    for (uint32_t i = 0; i < matchDocCount; ++i) {
+        values[i] = T();
+        _iterator->Seek(_docIdAccessor.getDocId(matchDocs[i]), values[i]);
+    }
+    return true;
+}
+
+template <typename T, typename DocIdAccessor, typename AttrIterator>
+bool AtomicAttributeExpression<T, DocIdAccessor, AttrIterator>::tryBatchSeek(matchdoc::MatchDoc *matchDocs,
+                                                                             uint32_t matchDocCount,
+                                                                             T *values) {
+    if constexpr (autil::IsMultiType<T>::value) {
+        return false;
+    } else {
+        _docIds.resize(matchDocCount);
+        for (uint32_t i = 0; i < matchDocCount; ++i) {
+            _docIds[i] = _docIdAccessor.getDocId(matchDocs[i]);
+        }
+        if (!std::is_sorted(_docIds.begin(), _docIds.end())) {
+            return false;
+        }
+        std::vector<T> batchValues;
+        std::vector<bool> isNulls;
+        auto ecs = future_lite::coro::syncAwait(
+            _iterator->BatchSeek(_docIds, indexlib::file_system::ReadOption(), &batchValues, &isNulls));
+        for (uint32_t i = 0; i < matchDocCount; ++i) {
+            if (ecs[i] == indexlib::index::ErrorCode::OK) {
+                values[i] = batchValues[i];
+            } else {
+                // keep per doc semantic for docs the batch path can not serve
+                values[i] = T();
+                _iterator->Seek(_docIds[i], values[i]);
+            }
+        }
+        return true;
+    }
+}
+
 template <typename T, typename DocIdAccessor, typename AttrIterator>
 bool AtomicAttributeExpression<T, DocIdAccessor, AttrIterator>::operator==(const AttributeExpression *checkExpr) const {
     assert(checkExpr);
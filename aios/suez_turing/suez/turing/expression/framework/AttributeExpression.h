@@ -76,6 +76,8 @@ public:
     }
     virtual void setEvaluated() = 0;
     virtual uint64_t evaluateHash(matchdoc::MatchDoc matchDoc) = 0;
+    // batches of at least threshold docs are read column-wise from the attribute, 0 disables it
+    virtual void setBatchSeekThreshold(uint32_t threshold) {}
     template <typename T>
     bool getConstValue(T &value) const {
         if (ET_ARGUMENT != getExpressionType()) {
@@ -167,6 +169,14 @@ public:
     bool batchEvaluate(matchdoc::MatchDoc *matchDocs, uint32_t matchDocCount) override {
         return defaultBatchEvaluate(matchDocs, matchDocCount);
     }
+    // columnar evaluation: writes the value of matchDocs[i] to values[i], leaf and operator
+    // expressions override it to work on whole columns instead of one matchdoc at a time
+    virtual bool evaluateColumn(matchdoc::MatchDoc *matchDocs, uint32_t matchDocCount, T *values) {
+        for (uint32_t i = 0; i < matchDocCount; i++) {
+            values[i] = evaluateAndReturn(matchDocs[i]);
+        }
+        return true;
+    }
     void setEvaluated() override { _isEvaluated = (_ref != NULL); }
     virtual T getValue(matchdoc::MatchDoc matchDoc) const {
         if (_ref) {
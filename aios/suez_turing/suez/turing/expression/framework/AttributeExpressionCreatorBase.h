@@ -73,6 +73,8 @@ public:
 
     autil::mem_pool::Pool *getPool() { return _pool; }
 
+    bool isDeterministic() const { return _exprPool->isDeterministic(); }
+
     void swapCache(AttributeExpressionPool *&exprPool) { std::swap(exprPool, _exprPool); }
 
 protected:
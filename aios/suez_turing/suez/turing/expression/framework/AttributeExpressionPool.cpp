@@ -30,7 +30,7 @@ namespace turing {
 
 AUTIL_LOG_SETUP(expression, AttributeExpressionPool);
 
-AttributeExpressionPool::AttributeExpressionPool() {}
+AttributeExpressionPool::AttributeExpressionPool() : _isDeterministic(true) {}
 
 AttributeExpressionPool::~AttributeExpressionPool() {
     assert(assertNoDupExpression());
@@ -45,6 +45,7 @@ void AttributeExpressionPool::addPair(const std::string &exprStr, AttributeExpre
         return;
     }
     if (!attrExpr->isDeterministic()) {
+        _isDeterministic = false;
         AUTIL_LOG(DEBUG,
                   "expression[%s] is not deterministic,"
                   "not optimize this expression",
@@ -61,6 +62,7 @@ void AttributeExpressionPool::addNeedDeleteExpr(AttributeExpression *attrExpr) {
     if (attrExpr == nullptr) {
         return;
     }
+    _isDeterministic = _isDeterministic && attrExpr->isDeterministic();
     _exprVecs.push_back(attrExpr);
 }
 
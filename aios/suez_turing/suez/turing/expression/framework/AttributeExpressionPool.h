@@ -49,6 +49,8 @@ public:
 
     void addPair(const std::string &exprStr, AttributeExpression *attrExpr, bool needDelete = true);
     void addNeedDeleteExpr(AttributeExpression *attrExpr);
+    // false once any expression created through this pool is not deterministic
+    bool isDeterministic() const { return _isDeterministic; }
 
 private:
     bool assertNoDupExpression();
@@ -56,6 +58,7 @@ private:
 private:
     std::vector<AttributeExpression *> _exprVecs;
     std::map<std::string, AttributeExpression *> _exprMap;
+    bool _isDeterministic;
 
 private:
     AUTIL_LOG_DECLARE();
@@ -21,10 +21,12 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <typeinfo>
+#include <vector>
 
 #include "autil/MultiValueType.h"
 #include "matchdoc/MatchDoc.h"
 #include "suez/turing/expression/framework/AttributeExpression.h"
+#include "suez/turing/expression/framework/ColumnBuffer.h"
 
 namespace suez {
 namespace turing {
@@ -180,6 +182,24 @@ public:
         return resultValue;
     }
 
+    bool evaluateColumn(matchdoc::MatchDoc *matchDocs, uint32_t matchDocCount, ResultType *values) override {
+        assert(_leftExpr);
+        assert(_rightExpr);
+        if (this->isEvaluated()) {
+            return AttributeExpressionTyped<ResultType>::evaluateColumn(matchDocs, matchDocCount, values);
+        }
+        LeftArgType *leftValues = _leftColumn.reserve(matchDocCount);
+        RightArgType *rightValues = _rightColumn.reserve(matchDocCount);
+        if (!_leftExpr->evaluateColumn(matchDocs, matchDocCount, leftValues) ||
+            !_rightExpr->evaluateColumn(matchDocs, matchDocCount, rightValues)) {
+            return false;
+        }
+        for (uint32_t i = 0; i < matchDocCount; i++) {
+            values[i] = _binaryOperator(leftValues[i], rightValues[i]);
+        }
+        return true;
+    }
+
     ExpressionType getExpressionType() const override { return ET_BINARY; }
 
     void setEvaluated() override {
@@ -201,10 +221,43 @@ public:
         return (expr && (*_leftExpr) == expr->_leftExpr && (*_rightExpr) == expr->_rightExpr);
     }
 
+private:
+    // evaluates the right operand only for docs whose left value is not decided by the left operand,
+    // results of the right operand are scattered back into values
+    bool evaluateRightOnSelection(matchdoc::MatchDoc *matchDocs,
+                                  uint32_t matchDocCount,
+                                  bool decidedValue,
+                                  ResultType *values) {
+        _selection.clear();
+        _selectedDocs.clear();
+        for (uint32_t i = 0; i < matchDocCount; i++) {
+            if (values[i] != decidedValue) {
+                _selection.push_back(i);
+                _selectedDocs.push_back(matchDocs[i]);
+            }
+        }
+        if (_selection.empty()) {
+            return true;
+        }
+        uint32_t selectedCount = _selection.size();
+        RightArgType *rightValues = _rightColumn.reserve(selectedCount);
+        if (!_rightExpr->evaluateColumn(_selectedDocs.data(), selectedCount, rightValues)) {
+            return false;
+        }
+        for (uint32_t i = 0; i < selectedCount; i++) {
+            values[_selection[i]] = rightValues[i];
+        }
+        return true;
+    }
+
 private:
     LeftAttrExpr *_leftExpr;
     RightAttrExpr *_rightExpr;
     BinaryOperatorType<LeftArgType> _binaryOperator;
+    ColumnBuffer<LeftArgType> _leftColumn;
+    ColumnBuffer<RightArgType> _rightColumn;
+    std::vector<uint32_t> _selection;
+    std::vector<matchdoc::MatchDoc> _selectedDocs;
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -251,6 +304,36 @@ inline bool BinaryAttributeExpression<std::logical_or, bool>::evaluateAndReturn(
     return resultValue;
 }
 
+template <>
+inline bool BinaryAttributeExpression<std::logical_and, bool>::evaluateColumn(matchdoc::MatchDoc *matchDocs,
+                                                                            uint32_t matchDocCount,
+                                                                            bool *values) {
+    assert(_leftExpr);
+    assert(_rightExpr);
+    if (this->isEvaluated()) {
+        return AttributeExpressionTyped<bool>::evaluateColumn(matchDocs, matchDocCount, values);
+    }
+    if (!_leftExpr->evaluateColumn(matchDocs, matchDocCount, values)) {
+        return false;
+    }
+    return evaluateRightOnSelection(matchDocs, matchDocCount, false, values);
+}
+
+template <>
+inline bool BinaryAttributeExpression<std::logical_or, bool>::evaluateColumn(matchdoc::MatchDoc *matchDocs,
+                                                                           uint32_t matchDocCount,
+                                                                           bool *values) {
+    assert(_leftExpr);
+    assert(_rightExpr);
+    if (this->isEvaluated()) {
+        return AttributeExpressionTyped<bool>::evaluateColumn(matchDocs, matchDocCount, values);
+    }
+    if (!_leftExpr->evaluateColumn(matchDocs, matchDocCount, values)) {
+        return false;
+    }
+    return evaluateRightOnSelection(matchDocs, matchDocCount, true, values);
+}
+
 template <>
 inline void BinaryAttributeExpression<std::logical_or, bool>::setEvaluated() {
     AttributeExpressionTyped<bool>::setEvaluated();
@@ -0,0 +1,44 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+
+namespace suez {
+namespace turing {
+
+// reusable contiguous value storage for columnar expression evaluation,
+// unlike std::vector<bool> it hands out a plain T array for every T
+template <typename T>
+class ColumnBuffer {
+public:
+    T *reserve(uint32_t count) {
+        if (count > _capacity) {
+            _data.reset(new T[count]);
+            _capacity = count;
+        }
+        return _data.get();
+    }
+    T *data() const { return _data.get(); }
+
+private:
+    std::unique_ptr<T[]> _data;
+    uint32_t _capacity = 0;
+};
+
+} // namespace turing
+} // namespace suez
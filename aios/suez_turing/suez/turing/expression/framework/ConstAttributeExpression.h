@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <assert.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -51,6 +52,10 @@ public:
         }
         return true;
     }
+    bool evaluateColumn(matchdoc::MatchDoc *matchDocs, uint32_t count, T *values) override {
+        std::fill(values, values + count, this->_value);
+        return true;
+    }
     void setEvaluated() override { this->_isEvaluated = true; }
     ExpressionType getExpressionType() const override { return ET_CONST; }
     bool operator==(const AttributeExpression *checkExpr) const override;